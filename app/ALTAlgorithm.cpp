@@ -0,0 +1,93 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file ALTAlgorithm.cpp
+ *  @brief Implementation of class ALTAlgorithm methods
+ *
+ *  This file implements class ALTAlgorithm methods.
+ *
+ *  ALTAlgorithm derives from PathFindAlgorithm class, builds the same
+ *  graph as A star and runs A star on it with the largest landmark
+ *  lower bound as heuristic.  Landmark tables are built once per map
+ *  or read back from a file saved by an earlier run.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "ALTAlgorithm.hpp"
+#include "GraphSearch.hpp"
+#include <algorithm>
+#include <limits>
+
+
+bool ALTAlgorithm::buildGraph(void) {
+    if (!PathFindingAlgorithm::buildGraph())
+        return false;
+
+    if (!tableFile.empty() && landmarks.load(tableFile, graph))
+        return true;
+
+    landmarks.build(graph, numLandmarks, strategy, numThreads);
+
+    if (!tableFile.empty())
+        landmarks.save(tableFile);
+
+    return true;
+}
+
+
+bool ALTAlgorithm::computPath(double weight) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    int goalId = goal - 1;
+    // nodes that cannot reach goal sort last; largest double rather
+    // than infinity, as weight 0 times infinity is NaN
+    auto heuristic = [this, goalId](int id) {
+        double bound = landmarks.getLowerBound(id, goalId);
+        return std::min(bound, std::numeric_limits<double>::max());
+    };
+
+    if (!aStarSearch(graph, context, start-1, goalId, weight, heuristic,
+                     numExpanded)) {
+        return false;
+    }
+
+    totalCost = context.getCost(goalId);
+
+    // reconstruct path from start to goal in node indices
+    context.extractPath(goalId, path);
+    for (auto& n : path)
+        ++n;
+
+    return true;
+}
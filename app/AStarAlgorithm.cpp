@@ -32,218 +32,610 @@
  *  virtual function ComputPath to compute shortest path using A star
  *  algorithm.  The heuristic estimation used in A star algorithm
  *  here is implemented using Euclidean distance.
- *  
+ *
+ *  The open set is an indexed priority queue chosen by the Queue
+ *  policy parameter, so popping the lowest cost node is O(log n) and
+ *  open/closed membership checks are O(1).  Cost, parent and set
+ *  membership are kept in a SearchContext reused across queries.
+ *
+ *  Cost matrices run one Dijkstra search per distinct source on the
+ *  worker threads of computPaths, each stopping once every distinct
+ *  target is settled.
+ *
+ *  Anytime search is ARA*: each round runs weighted A* until no open
+ *  node has a lower key than the cost of goal, and nodes improved
+ *  after being closed in the round are set aside as inconsistent
+ *  instead of being expanded again.  The next round lowers the weight
+ *  and starts from the open and inconsistent nodes with their costs,
+ *  so only the part of the search the new weight changes is redone.
+ *  The bound is the lower of the weight and the path cost over the
+ *  lowest cost plus heuristic among those nodes.
+ *
+ *  Cell changes update the cost of edges into the changed cells in
+ *  place.  The map version, which keys the results kept in an
+ *  optional PathCache, is the fingerprint of the built graph mixed
+ *  with each change, so searches of different maps never share
+ *  results.
  *
  *  @author Huei Tzu Tsai
  *  @date   03/07/2017
 */
 
 #include "AStarAlgorithm.hpp"
+#include "GraphSearch.hpp"
 #include <math.h>
+#include <algorithm>
 #include <iostream>
 #include <limits>
-#include <memory>
+#include <tuple>
+#include <unordered_map>
 
 
 using std::cout;
 using std::endl;
 using std::string;
-using std::list;
-using std::shared_ptr;
 
 
-bool AStarAlgorithm::computPath(double weight) {
+namespace {
+
+/**
+ *   @brief  Mix cell changes into map version
+ *
+ *   @param  map version before the changes
+ *   @param  reference to cell changes
+ *   @return map version after the changes
+*/
+uint64_t mixVersion(uint64_t version,
+                    const std::vector<CellChange> &changes) {
+    // FNV-1a over index and cost of each change
+    auto mix = [&version](uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            version ^= (value >> (8 * i)) & 0xff;
+            version *= 1099511628211ULL;
+        }
+    };
+
+    for (auto& c : changes) {
+        mix(static_cast<uint32_t>(c.index));
+        mix(static_cast<uint32_t>(c.cost));
+    }
+
+    return version;
+}
+
+}  // namespace
+
+
+template <class Queue>
+bool BasicAStarAlgorithm<Queue>::computPath(double weight) {
     // cout << "*** A Star Path Searching Algorithm ***" << endl;
 
     // initialize
     path.clear();
-    openSet.clear();
-    closedSet.clear();
+    numExpanded = 0;
 
     // start and goal cannot be less than index lower bound
     if ((start < 1) || (goal < 1)) {
         return false;
     }
 
-    // initialize start node's cost and heuristic cost to goal
-    nodes[start-1]->setCost(0);
-    nodes[start-1]->setEstimateCost(weight * getHeuristicCost(nodes[start-1],
-                                   nodes[goal-1]));
+    PathQuery query {start, goal, weight};
+    PathResult result;
 
-    // add start node to open set
-    openSet.emplace_back(nodes[start-1]);
+    if (cache && cache->find(query, mapVersion, result)) {
+        path.swap(result.path);
+        if (result.found)
+            totalCost = result.totalCost;
+        return result.found;
+    }
 
-#if 0
-    double curXPos = 0;
-    double curYPos = 0;
-    std::tie(curXPos, curYPos) = openSet.front()->getPos();
-    cout << openSet.front()->getIndex() << " " << curXPos << " "
-         << curYPos << endl;
-    cout << "cost = " << openSet.front()->getCost() << " estimatedCost = "
-         << openSet.front()->getEstimateCost() << endl;
-#endif
+    auto heuristic = [this](int id) {
+        return getHeuristicCost(id, goal-1);
+    };
 
-    while (!openSet.empty()) {
-        openSet.sort(compareCost);
+    result.found = aStarSearch(graph, context, start-1, goal-1, weight,
+                               heuristic, numExpanded);
+    result.totalCost = 0;
+    result.numExpanded = numExpanded;
 
-        // current node in open set with lowest cost
-        shared_ptr<Node> curNode = openSet.front();
+    if (result.found) {
+        totalCost = context.getCost(goal-1);
+        // cout << "cost is " << totalCost << endl;
 
-        // cout << "pop open front index: " << curNode->getIndex() << endl;
+        // reconstruct path from start to goal in node indices
+        context.extractPath(goal-1, path);
+        for (auto& n : path)
+            ++n;
 
-        // check if current equals to goal
-        if (curNode->getIndex() == goal) {
-            totalCost = curNode->getEstimateCost();
-            // cout << "cost is " << totalCost << endl;
-            reconstructPath(curNode);
-            return true;
-        }
+        result.totalCost = totalCost;
+    }
 
+    if (cache) {
+        result.path.swap(path);
+        cache->insert(query, mapVersion, result);
+        result.path.swap(path);
+    }
 
-        if (curNode->getCost() >= std::numeric_limits<int>::max()) {
-            // if front node's cost is infinite
-            // path cannot be found
-            break;
-        }
+    return result.found;
+}
 
-        // remove current from open set
-        openSet.pop_front();
-
-        // add current to closed set
-        closedSet.emplace_back(curNode);
-
-#if 0
-        cout << "Closed Set:" << endl;
-        for (auto& n : closedSet) {
-            double xPos = 0;
-            double yPos = 0;
-            std::tie(xPos, yPos) = n->getPos();
-            cout << n->getIndex() << "(" << xPos << "," << yPos << ")";
-            cout << " (" << n->getCost() << "," << n->getEstimateCost()
-                 << ")" << endl;
-        }
-#endif
-        list<shared_ptr<Node>> neighbors;
-        findNeighbors(curNode->getIndex(), neighbors);
 
-        // cout << "Neighbors:" << endl;
+template <class Queue>
+bool BasicAStarAlgorithm<Queue>::buildGraph(void) {
+    reverseBuilt = false;
 
-        // for each neighbor of current
-        for (auto& n : neighbors) {
-            // if neighbor in closed set, continue
-            if (checkList(n->getIndex(), closedSet)) {
-                // cout << "neighbor in closed set, continue" << endl;
-                continue;
-            }
+    bool built = PathFindingAlgorithm::buildGraph();
 
-            double tempCost = curNode->getCost() +
-                              getCostToNeighbor(curNode->getIndex(),
-                                                n->getIndex());
-            // cout << "node = " << curNode->getIndex() << ", tempCost = "
-            //     << tempCost << endl;
+    // a new map may differ anywhere, so results of another one go
+    mapVersion = graph.getFingerprint();
+    if (cache)
+        cache->follow(mapVersion);
 
+    if (!built)
+        return false;
 
-            if (!checkList(n->getIndex(), openSet)) {
-                // if neighbor not in open set, add
-                openSet.emplace_back(n);
-            } else if (tempCost >= n->getCost()) {
-                // not a better path
-                continue;
-            }
+    // size search state now, so searches under a deadline do not
+    // spend it allocating
+    context.reset(graph.getNumNodes());
+    closedStamp.assign(graph.getNumNodes(), 0);
+    iteration = 0;
+
+    return true;
+}
+
+
+template <class Queue>
+bool BasicAStarAlgorithm<Queue>::updateCells(
+                                     const std::vector<CellChange> &changes) {
+    const int obstacle = std::numeric_limits<int>::max();
+    int numCols = map.getCol();
+    int numCells = map.getRow() * numCols;
+
+    // check every change first, so a bad one leaves the map as it is
+    for (auto& c : changes) {
+        if ((c.index < 1) || (c.index > numCells))
+            return false;
+
+        if ((c.cost != obstacle) && ((c.cost < 1) || (c.cost > 255)))
+            return false;
+    }
+
+    std::vector<int> indices;
+    bool costLowered = false;
+
+    for (auto& c : changes) {
+        int id = c.index - 1;
 
-            // update neighbor's parent to current
-            n->setParentIndex(curNode->getIndex());
-
-            // update neighbor's cost (i.e. total cost to this node)
-            // to tempCost
-            n->setCost(tempCost);
-
-            // update neighbor's goal cost (i.e. cost to goal) to
-            // tempCost + heuristic estimate
-            double heuristic = weight * getHeuristicCost(n, nodes[goal-1]);
-            n->setEstimateCost(tempCost + heuristic);
-#if 0
-            double xPos = 0;
-            double yPos = 0;
-            std::tie(xPos, yPos) = n->getPos();
-            cout << n->getIndex() << "(" << xPos << "," << yPos << ")";
-            cout << " (" << n->getCost() << "," << n->getEstimateCost() << ","
-                 << heuristic << ")" << endl;
-#endif
+        costLowered = costLowered || (c.cost < map.getCost(c.index));
+        map.setCost(c.index, c.cost);
+        indices.push_back(c.index);
+
+        // moves are symmetric, so cells with an edge into this one are
+        // the targets of its own edges
+        for (int e = graph.beginEdge(id); e < graph.endEdge(id); ++e) {
+            int n = graph.getTarget(e);
+            bool diagonal = (n / numCols != id / numCols) &&
+                            (n % numCols != id % numCols);
+            double cost = Graph::infinity();
+
+            // setting cost to 1.5x for diagonal movement
+            if (c.cost != obstacle)
+                cost = c.cost * (diagonal ? 1.5 : 1.0);
+
+            graph.setCost(n, id, cost);
         }
     }
 
-    // cout << "Fail to find path" << endl;
-    return false;
+    reverseBuilt = false;
+
+    uint64_t oldVersion = mapVersion;
+    mapVersion = mixVersion(mapVersion, changes);
+    if (cache)
+        cache->invalidate(indices, costLowered, oldVersion, mapVersion);
+
+    return true;
 }
 
 
-double AStarAlgorithm::getHeuristicCost(shared_ptr<Node> &start,
-                                        shared_ptr<Node> &end) {
-    double xdiff = 0;
-    double ydiff = 0;
+template <class Queue>
+void BasicAStarAlgorithm<Queue>::setPathCache(std::shared_ptr<PathCache> c) {
+    cache = c;
 
-    double startX = 0;
-    double startY = 0;
-    double endX = 0;
-    double endY = 0;
+    // results of another map are no longer valid
+    if (cache)
+        cache->follow(mapVersion);
+}
 
-    std::tie(startX, startY) = start->getPos();
-    std::tie(endX, endY) = end->getPos();
 
-    xdiff = startX - endX;
-    ydiff = startY - endY;
+template <class Queue>
+bool BasicAStarAlgorithm<Queue>::computPathBidirectional(double weight) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
 
-    return sqrt((xdiff*xdiff) + (ydiff*ydiff));
-}
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    // edge cost depends on end node, so backward search needs edges
+    // reversed instead of forward ones
+    if (!reverseBuilt) {
+        graph.buildReverse(reverseGraph);
+        reverseBuilt = true;
+    }
 
+    // average of forward and backward heuristics keeps both searches
+    // consistent with each other
+    auto potential = [this, weight](int id) {
+        return weight * (getHeuristicCost(id, goal-1) -
+                         getHeuristicCost(start-1, id)) / 2;
+    };
 
-double AStarAlgorithm::getCostToNeighbor(int startIndex, int endIndex) {
     double cost = 0;
+    int meetId = -1;
+    if (!bidirectionalSearch(graph, reverseGraph, context, backwardContext,
+                             start-1, goal-1, potential, cost, meetId,
+                             numExpanded)) {
+        return false;
+    }
+
+    totalCost = cost;
+
+    // join path from start to meeting node with path from meeting
+    // node to goal
+    context.extractPath(meetId, path);
+    for (int n = backwardContext.getParent(meetId); n >= 0;
+         n = backwardContext.getParent(n)) {
+        path.push_back(n);
+    }
+
+    for (auto& n : path)
+        ++n;
+
+    return true;
+}
+
+
+template <class Queue>
+bool BasicAStarAlgorithm<Queue>::computPathAnytime(
+                             double weight,
+                             std::chrono::steady_clock::time_point deadline,
+                             double weightStep) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // initialize
+    path.clear();
+    numExpanded = 0;
+    suboptimalityBound = inf;
+
+    if (!isPassable(start) || !isPassable(goal))
+        return false;
+
+    int n = graph.getNumNodes();
+    int startId = start - 1;
+    int goalId = goal - 1;
+    double epsilon = std::max(weight, 1.0);
+    int count = 0;
+
+    auto heuristic = [&](int id) {
+        return getHeuristicCost(id, goalId);
+    };
+
+    // closed in current round: stamp == iteration, closed and
+    // inconsistent: stamp == iteration + 1
+    if (static_cast<int>(closedStamp.size()) < n)
+        closedStamp.resize(n, 0);
+    if (iteration >= std::numeric_limits<uint32_t>::max() - 4) {
+        std::fill(closedStamp.begin(), closedStamp.end(), 0);
+        iteration = 0;
+    }
+    iteration += 2;
+
+    context.reset(n);
+    Queue &openSet = context.getOpenSet();
+    inconsistent.clear();
+
+    context.visit(startId, 0, epsilon * heuristic(startId), -1);
+    openSet.push(startId, context.getEstimateCost(startId));
+
+    while (true) {
+        bool timedOut = false;
+
+        // improve path until no open node can give a cheaper goal
+        while (!openSet.empty() &&
+               (context.getCost(goalId) > openSet.topKey())) {
+            if ((++count % 256 == 0) &&
+                (std::chrono::steady_clock::now() >= deadline)) {
+                timedOut = true;
+                break;
+            }
+
+            int cur = openSet.pop();
+            double curCost = context.getCost(cur);
+
+            closedStamp[cur] = iteration;
+            ++numExpanded;
+
+            graph.forEachNeighbor(cur, [&](int nb, double edgeCost) {
+                double tempCost = curCost + edgeCost;
+
+                if (tempCost >= context.getCost(nb))
+                    return;
+
+                double estimate = tempCost + epsilon * heuristic(nb);
+                context.visit(nb, tempCost, estimate, cur);
+
+                // closed nodes wait for the next round
+                if (closedStamp[nb] == iteration) {
+                    closedStamp[nb] = iteration + 1;
+                    inconsistent.push_back(nb);
+                } else if (closedStamp[nb] == iteration + 1) {
+                    return;
+                } else if (openSet.contains(nb)) {
+                    openSet.decreaseKey(nb, estimate);
+                } else {
+                    openSet.push(nb, estimate);
+                }
+            });
+        }
 
-    for (auto& e : edges) {
-        if (e->getStartIndex() == startIndex && e->getEndIndex() == endIndex) {
-            cost = e->getCost();
+        // keep best path of earlier rounds if this one is cut short
+        if (timedOut || (context.getCost(goalId) == inf))
             break;
+
+        // gather open and inconsistent nodes for the next round
+        while (!openSet.empty())
+            inconsistent.push_back(openSet.pop());
+
+        double minCost = inf;
+        for (int id : inconsistent)
+            minCost = std::min(minCost, context.getCost(id) + heuristic(id));
+
+        context.extractPath(goalId, path);
+        totalCost = 0;
+        for (size_t i = 1; i < path.size(); ++i)
+            totalCost += graph.getCost(path[i - 1], path[i]);
+        for (auto& id : path)
+            ++id;
+
+        suboptimalityBound = (totalCost <= minCost) ?
+                             1 : std::min(epsilon, totalCost / minCost);
+
+        if ((suboptimalityBound <= 1) || (epsilon <= 1) ||
+            (weightStep <= 0) ||
+            (std::chrono::steady_clock::now() >= deadline))
+            break;
+
+        // lower weight and key every carried over node with it
+        epsilon = std::max(1.0, epsilon - weightStep);
+        iteration += 2;
+
+        for (int id : inconsistent) {
+            double estimate = context.getCost(id) + epsilon * heuristic(id);
+            context.visit(id, context.getCost(id), estimate,
+                          context.getParent(id));
+            openSet.push(id, estimate);
         }
+        inconsistent.clear();
     }
 
-    return cost;
+    return !path.empty();
 }
 
 
-void AStarAlgorithm::findNeighbors(int index,
-                                   list<shared_ptr<Node>> &neighbors) {
-    for (auto& e : edges) {
-        if (e->getStartIndex() == index) {
-            neighbors.emplace_back(nodes[e->getEndIndex()-1]);
-        }
+template <class Queue>
+int BasicAStarAlgorithm<Queue>::computPaths(
+                                     const std::vector<PathQuery> &queries,
+                                     std::vector<PathResult> &results,
+                                     int numThreads) {
+    results.resize(queries.size());
+
+    // threads are kept between calls unless a different number is asked
+    if (!pool || ((numThreads > 0) && (pool->getNumThreads() != numThreads)))
+        pool.reset(new ThreadPool(numThreads));
+
+    workerContexts.resize(pool->getNumThreads());
+
+    pool->parallelFor(static_cast<int>(queries.size()),
+                      [&](int worker, int i) {
+        computQuery(queries[i], workerContexts[worker], results[i]);
+    });
+
+    int numFound = 0;
+    for (auto& r : results) {
+        if (r.found)
+            ++numFound;
     }
 
-    return;
+    return numFound;
 }
 
 
-bool checkList(int index, list<shared_ptr<Node>> const &nodes) {
-    bool found = false;
+template <class Queue>
+int BasicAStarAlgorithm<Queue>::computCostMatrix(
+                                     const std::vector<int> &sources,
+                                     const std::vector<int> &targets,
+                                     std::vector<double> &costs,
+                                     std::vector<std::vector<int>> *paths,
+                                     int numThreads) {
+    int numSources = static_cast<int>(sources.size());
+    int numTargets = static_cast<int>(targets.size());
+
+    costs.assign(sources.size() * targets.size(),
+                 std::numeric_limits<double>::infinity());
+    if (paths) {
+        paths->resize(costs.size());
+        for (auto& p : *paths)
+            p.clear();
+    }
+
+    // slot of each distinct target node, -1 for other nodes
+    std::vector<int> targetSlot(graph.getNumNodes(), -1);
+    std::vector<int> columnSlot(numTargets, -1);
+    std::vector<int> targetIds;
 
-    for (auto& n : nodes) {
-        if (n->getIndex() == index) {
-            found = true;
-            break;
+    for (int j = 0; j < numTargets; ++j) {
+        if (!isPassable(targets[j]))
+            continue;
+
+        int id = targets[j] - 1;
+        if (targetSlot[id] < 0) {
+            targetSlot[id] = static_cast<int>(targetIds.size());
+            targetIds.push_back(id);
+        }
+        columnSlot[j] = targetSlot[id];
+    }
+
+    // one search per distinct source, filling the row where it first
+    // appears
+    std::unordered_map<int, int> searchOfSource;
+    std::vector<int> searchRows;
+    std::vector<int> rowSearch(numSources, -1);
+
+    for (int i = 0; i < numSources; ++i) {
+        if (!isPassable(sources[i]))
+            continue;
+
+        auto inserted = searchOfSource.insert(std::make_pair(
+                            sources[i], static_cast<int>(searchRows.size())));
+        if (inserted.second)
+            searchRows.push_back(i);
+        rowSearch[i] = inserted.first->second;
+    }
+
+    // threads are kept between calls unless a different number is asked
+    if (!pool || ((numThreads > 0) && (pool->getNumThreads() != numThreads)))
+        pool.reset(new ThreadPool(numThreads));
+
+    workerContexts.resize(pool->getNumThreads());
+
+    int numDistinctTargets = static_cast<int>(targetIds.size());
+
+    pool->parallelFor(static_cast<int>(searchRows.size()),
+                      [&](int worker, int s) {
+        SearchContext<Queue> &searchContext = workerContexts[worker];
+        int row = searchRows[s];
+        int expanded = 0;
+
+        settleTargets(graph, searchContext, sources[row] - 1,
+                      numDistinctTargets,
+                      [&](int id) { return targetSlot[id] >= 0; },
+                      expanded);
+
+        // cost and path of each distinct target, copied to its columns
+        std::vector<std::vector<int>> slotPaths;
+        if (paths) {
+            slotPaths.resize(numDistinctTargets);
+
+            for (int t = 0; t < numDistinctTargets; ++t) {
+                if (!searchContext.isClosed(targetIds[t]))
+                    continue;
+
+                searchContext.extractPath(targetIds[t], slotPaths[t]);
+                for (auto& n : slotPaths[t])
+                    ++n;
+            }
+        }
+
+        for (int j = 0; j < numTargets; ++j) {
+            int t = columnSlot[j];
+            if ((t < 0) || !searchContext.isClosed(targetIds[t]))
+                continue;
+
+            size_t entry = static_cast<size_t>(row) * numTargets + j;
+            costs[entry] = searchContext.getCost(targetIds[t]);
+            if (paths)
+                (*paths)[entry] = slotPaths[t];
+        }
+    });
+
+    int numFound = 0;
+
+    for (int i = 0; i < numSources; ++i) {
+        if (rowSearch[i] < 0)
+            continue;
+
+        // repeated source copies the row of its search
+        int row = searchRows[rowSearch[i]];
+        size_t begin = static_cast<size_t>(i) * numTargets;
+        size_t from = static_cast<size_t>(row) * numTargets;
+
+        for (int j = 0; j < numTargets; ++j) {
+            if (row != i) {
+                costs[begin + j] = costs[from + j];
+                if (paths)
+                    (*paths)[begin + j] = (*paths)[from + j];
+            }
+
+            if (costs[begin + j] < std::numeric_limits<double>::infinity())
+                ++numFound;
         }
     }
 
-    return found;
+    return numFound;
 }
 
 
-bool compareCost(const shared_ptr<Node> &first,
-                 const shared_ptr<Node> &second) {
-    if (first->getEstimateCost() < second->getEstimateCost())
-        return true;
-    else
-        return false;
+template <class Queue>
+void BasicAStarAlgorithm<Queue>::computQuery(const PathQuery &query,
+                                             SearchContext<Queue> &searchContext,
+                                             PathResult &result) {
+    result.found = false;
+    result.totalCost = 0;
+    result.numExpanded = 0;
+    result.path.clear();
+
+    if (!isPassable(query.start) || !isPassable(query.goal))
+        return;
+
+    if (cache && cache->find(query, mapVersion, result)) {
+        result.numExpanded = 0;
+        return;
+    }
+
+    int goalId = query.goal - 1;
+    auto heuristic = [this, goalId](int id) {
+        return getHeuristicCost(id, goalId);
+    };
+
+    if (aStarSearch(graph, searchContext, query.start - 1, goalId,
+                    query.weight, heuristic, result.numExpanded)) {
+        result.found = true;
+        result.totalCost = searchContext.getCost(goalId);
+
+        searchContext.extractPath(goalId, result.path);
+        for (auto& n : result.path)
+            ++n;
+    }
+
+    if (cache)
+        cache->insert(query, mapVersion, result);
+}
+
+
+template <class Queue>
+double BasicAStarAlgorithm<Queue>::getHeuristicCost(int startId,
+                                                    int endId) const {
+    double xdiff = 0;
+    double ydiff = 0;
+
+    double startX = 0;
+    double startY = 0;
+    double endX = 0;
+    double endY = 0;
+
+    std::tie(startX, startY) = graph.getPos(startId);
+    std::tie(endX, endY) = graph.getPos(endId);
+
+    xdiff = startX - endX;
+    ydiff = startY - endY;
+
+    return sqrt((xdiff*xdiff) + (ydiff*ydiff));
 }
 
 
+// open set policies provided by this library
+template class BasicAStarAlgorithm<BinaryHeap>;
+template class BasicAStarAlgorithm<QuaternaryHeap>;
+template class BasicAStarAlgorithm<PairingHeap>;
@@ -0,0 +1,73 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file CHAlgorithm.cpp
+ *  @brief Implementation of class CHAlgorithm methods
+ *
+ *  This file implements class CHAlgorithm methods.
+ *
+ *  CHAlgorithm derives from PathFindAlgorithm class, builds the same
+ *  graph as A star and contracts it into a ContractionHierarchy.
+ *  Queries search the hierarchy and unpack shortcuts back into cells.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "CHAlgorithm.hpp"
+
+
+bool CHAlgorithm::buildGraph(void) {
+    if (!PathFindingAlgorithm::buildGraph())
+        return false;
+
+    hierarchy.build(graph);
+
+    return true;
+}
+
+
+bool CHAlgorithm::computPath(double) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    double cost = 0;
+    if (!hierarchy.query(start-1, goal-1, cost, path, numExpanded))
+        return false;
+
+    totalCost = cost;
+
+    // node ids to indices
+    for (auto& n : path)
+        ++n;
+
+    return true;
+}
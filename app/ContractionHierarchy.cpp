@@ -0,0 +1,528 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file ContractionHierarchy.cpp
+ *  @brief Implementation of class ContractionHierarchy methods
+ *
+ *  This file implements methods in class ContractionHierarchy.
+ *
+ *  Nodes are contracted in order of twice the edge difference
+ *  (shortcuts added minus edges removed) plus number of contracted
+ *  neighbors and hierarchy level, with priorities updated lazily when
+ *  a node reaches the top of the queue.  Contracting node v adds shortcut u->w for every pair of
+ *  edges u->v->w unless a witness search from u finds a path to w not
+ *  through v that is no longer.  Witness searches give up after a
+ *  fixed number of settled nodes, which can only add extra shortcuts.
+ *
+ *  A query runs Dijkstra from start over edges to higher ranked nodes
+ *  and from goal over reversed edges from higher ranked nodes.  The
+ *  shortest path meets at its highest ranked node, so each direction
+ *  stops once its lowest key is no less than the best meeting cost.
+ *  Nodes reached more cheaply through a higher ranked node are
+ *  stalled, i.e. expanded without relaxing their edges.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "ContractionHierarchy.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+
+namespace {
+
+/**
+ *  @brief Edge of the graph being contracted
+*/
+struct WorkEdge {
+     int node;                              ///< other end node
+     double cost;                           ///< edge cost
+     int middle;                            ///< node skipped by shortcut,
+                                            ///< -1 for original edge
+};
+
+
+/**
+ *  @brief Shortcut found for a contracted node
+*/
+struct Shortcut {
+     int from;                              ///< start node id
+     int to;                                ///< end node id
+     double cost;                           ///< cost through contracted
+                                            ///< node
+};
+
+
+/**
+ *  @brief Class that keeps the remaining graph while nodes are
+ *         contracted
+*/
+class Contractor {
+ public:
+     /**
+      *   @brief  Constructor of Contractor class, copies passable
+      *           edges of graph
+      *
+      *   @param  reference to graph
+      *   @return none
+     */
+     explicit Contractor(const Graph &graph) :
+             numNodes(graph.getNumNodes()), out(numNodes), in(numNodes),
+             contracted(numNodes, 0), deletedNeighbors(numNodes, 0),
+             level(numNodes, 0) {
+         for (int u = 0; u < numNodes; ++u) {
+             graph.forEachNeighbor(u, [&](int v, double cost) {
+                 addEdge(u, v, cost, -1);
+             });
+         }
+     }
+
+
+     /**
+      *   @brief  Contract every node and record its rank
+      *
+      *   @param  reference to vector int of ranks
+      *   @return none
+     */
+     void contractAll(std::vector<int> &rank) {
+         typedef std::pair<int, int> Entry;
+         std::priority_queue<Entry, std::vector<Entry>,
+                             std::greater<Entry>> order;
+
+         rank.assign(numNodes, 0);
+
+         for (int v = 0; v < numNodes; ++v)
+             order.push(Entry(getPriority(v), v));
+
+         int nextRank = 0;
+         while (!order.empty()) {
+             int v = order.top().second;
+             order.pop();
+
+             // priority may have changed since v was pushed
+             int priority = getPriority(v);
+             if (!order.empty() && (priority > order.top().first)) {
+                 order.push(Entry(priority, v));
+                 continue;
+             }
+
+             findShortcuts(v, shortcuts);
+             for (auto& s : shortcuts)
+                 addEdge(s.from, s.to, s.cost, v);
+
+             contracted[v] = 1;
+             rank[v] = nextRank++;
+
+             for (auto& e : out[v])
+                 updateNeighbor(e.node, v);
+             for (auto& e : in[v])
+                 updateNeighbor(e.node, v);
+         }
+     }
+
+
+     /**
+      *   @brief  Get outgoing edges of node, including shortcuts
+      *
+      *   @param  node id in int
+      *   @return reference to vector of edges
+     */
+     const std::vector<WorkEdge>& getOutEdges(int v) const { return out[v]; }
+
+ private:
+     int numNodes;                                 ///< number of nodes
+     std::vector<std::vector<WorkEdge>> out;       ///< outgoing edges
+     std::vector<std::vector<WorkEdge>> in;        ///< incoming edges
+     std::vector<char> contracted;                 ///< node is contracted
+     std::vector<int> deletedNeighbors;            ///< contracted
+                                                   ///< neighbors
+     std::vector<int> level;                       ///< hierarchy depth
+     SearchContext<BinaryHeap> witness;            ///< witness search
+     std::vector<Shortcut> shortcuts;              ///< shortcuts of node
+
+     static const int maxSettled = 100;            ///< witness search limit
+
+
+     /**
+      *   @brief  Add edge, or lower cost of existing edge between the
+      *           same nodes
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @param  edge cost in double
+      *   @param  middle node id in int, -1 for original edge
+      *   @return none
+     */
+     void addEdge(int u, int v, double cost, int middle) {
+         for (auto& e : out[u]) {
+             if (e.node != v)
+                 continue;
+
+             if (cost < e.cost) {
+                 e.cost = cost;
+                 e.middle = middle;
+
+                 for (auto& r : in[v]) {
+                     if (r.node == u) {
+                         r.cost = cost;
+                         r.middle = middle;
+                     }
+                 }
+             }
+             return;
+         }
+
+         out[u].push_back({v, cost, middle});
+         in[v].push_back({u, cost, middle});
+     }
+
+
+     /**
+      *   @brief  Find shortcuts needed to contract a node
+      *
+      *   @param  node id in int
+      *   @param  reference to vector of shortcuts
+      *   @return none
+     */
+     void findShortcuts(int v, std::vector<Shortcut> &result) {
+         result.clear();
+
+         for (auto& i : in[v]) {
+             int u = i.node;
+             if (contracted[u])
+                 continue;
+
+             double maxCost = -1;
+             for (auto& o : out[v]) {
+                 if (!contracted[o.node] && (o.node != u))
+                     maxCost = std::max(maxCost, i.cost + o.cost);
+             }
+
+             if (maxCost < 0)
+                 continue;
+
+             searchWitness(u, v, maxCost);
+
+             for (auto& o : out[v]) {
+                 if (contracted[o.node] || (o.node == u))
+                     continue;
+
+                 if (witness.getCost(o.node) > i.cost + o.cost)
+                     result.push_back({u, o.node, i.cost + o.cost});
+             }
+         }
+     }
+
+
+     /**
+      *   @brief  Run Dijkstra from a node over remaining nodes except
+      *           the one being contracted, up to a cost bound
+      *
+      *   @param  start node id in int
+      *   @param  node id being contracted in int
+      *   @param  cost bound in double
+      *   @return none
+     */
+     void searchWitness(int source, int skip, double maxCost) {
+         witness.reset(numNodes);
+         BinaryHeap &openSet = witness.getOpenSet();
+
+         witness.visit(source, 0, 0, -1);
+         openSet.push(source, 0);
+
+         int numSettled = 0;
+         while (!openSet.empty() && (openSet.topKey() <= maxCost) &&
+                (numSettled < maxSettled)) {
+             int cur = openSet.top();
+             openSet.pop();
+             witness.close(cur);
+             ++numSettled;
+
+             double curCost = witness.getCost(cur);
+
+             for (auto& e : out[cur]) {
+                 int n = e.node;
+                 double tempCost = curCost + e.cost;
+
+                 if (contracted[n] || (n == skip) || witness.isClosed(n) ||
+                     (tempCost > maxCost)) {
+                     continue;
+                 }
+
+                 bool inOpenSet = witness.isVisited(n);
+                 if (inOpenSet && (tempCost >= witness.getCost(n)))
+                     continue;
+
+                 witness.visit(n, tempCost, tempCost, cur);
+
+                 if (inOpenSet)
+                     openSet.decreaseKey(n, tempCost);
+                 else
+                     openSet.push(n, tempCost);
+             }
+         }
+     }
+
+
+     /**
+      *   @brief  Record that a neighbor of node has been contracted
+      *
+      *   @param  node id in int
+      *   @param  contracted neighbor id in int
+      *   @return none
+     */
+     void updateNeighbor(int u, int v) {
+         ++deletedNeighbors[u];
+         level[u] = std::max(level[u], level[v] + 1);
+     }
+
+
+     /**
+      *   @brief  Get contraction priority of node, lower goes first.
+      *           Edge difference keeps the graph sparse, contracted
+      *           neighbors and level spread contraction evenly.
+      *
+      *   @param  node id in int
+      *   @return priority in int
+     */
+     int getPriority(int v) {
+         int removed = 0;
+
+         for (auto& e : in[v]) {
+             if (!contracted[e.node])
+                 ++removed;
+         }
+
+         for (auto& e : out[v]) {
+             if (!contracted[e.node])
+                 ++removed;
+         }
+
+         findShortcuts(v, shortcuts);
+
+         return 2 * (static_cast<int>(shortcuts.size()) - removed) +
+                deletedNeighbors[v] + level[v];
+     }
+};
+
+}  // namespace
+
+
+void ContractionHierarchy::build(const Graph &graph) {
+    auto begin = std::chrono::steady_clock::now();
+    int numNodes = graph.getNumNodes();
+
+    Contractor contractor(graph);
+    contractor.contractAll(rank);
+
+    // split edges by direction in rank, keeping downward edges at
+    // their end node so backward search can follow them in reverse
+    upOffsets.assign(numNodes + 1, 0);
+    downOffsets.assign(numNodes + 1, 0);
+    numShortcuts = 0;
+
+    for (int u = 0; u < numNodes; ++u) {
+        for (auto& e : contractor.getOutEdges(u)) {
+            if (rank[u] < rank[e.node])
+                ++upOffsets[u + 1];
+            else
+                ++downOffsets[e.node + 1];
+
+            if (e.middle >= 0)
+                ++numShortcuts;
+        }
+    }
+
+    for (int u = 0; u < numNodes; ++u) {
+        upOffsets[u + 1] += upOffsets[u];
+        downOffsets[u + 1] += downOffsets[u];
+    }
+
+    upEdges.resize(upOffsets[numNodes]);
+    downEdges.resize(downOffsets[numNodes]);
+
+    std::vector<int> nextUp(upOffsets.begin(), upOffsets.end() - 1);
+    std::vector<int> nextDown(downOffsets.begin(), downOffsets.end() - 1);
+
+    for (int u = 0; u < numNodes; ++u) {
+        for (auto& e : contractor.getOutEdges(u)) {
+            if (rank[u] < rank[e.node])
+                upEdges[nextUp[u]++] = {e.node, e.cost, e.middle};
+            else
+                downEdges[nextDown[e.node]++] = {u, e.cost, e.middle};
+        }
+    }
+
+    preprocessTime = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin).count();
+}
+
+
+bool ContractionHierarchy::query(int startId, int goalId, double &cost,
+                                 std::vector<int> &path, int &numExpanded) {
+    const double inf = std::numeric_limits<double>::infinity();
+    double best = inf;
+    int meetId = -1;
+
+    path.clear();
+    numExpanded = 0;
+
+    forward.reset(getNumNodes());
+    backward.reset(getNumNodes());
+
+    forward.visit(startId, 0, 0, -1);
+    forward.getOpenSet().push(startId, 0);
+    backward.visit(goalId, 0, 0, -1);
+    backward.getOpenSet().push(goalId, 0);
+
+    if (startId == goalId) {
+        best = 0;
+        meetId = startId;
+    }
+
+    while (true) {
+        BinaryHeap &forwardOpen = forward.getOpenSet();
+        BinaryHeap &backwardOpen = backward.getOpenSet();
+        double forwardTop = forwardOpen.empty() ? inf : forwardOpen.topKey();
+        double backwardTop = backwardOpen.empty() ? inf :
+                                                    backwardOpen.topKey();
+
+        // a direction whose lowest key reaches best cannot improve it
+        if (std::min(forwardTop, backwardTop) >= best)
+            break;
+
+        bool isForward = forwardTop <= backwardTop;
+        SearchContext<BinaryHeap> &context = isForward ? forward : backward;
+        SearchContext<BinaryHeap> &other = isForward ? backward : forward;
+        const std::vector<int> &offsets = isForward ? upOffsets : downOffsets;
+        const std::vector<Edge> &edges = isForward ? upEdges : downEdges;
+        BinaryHeap &openSet = context.getOpenSet();
+
+        const std::vector<int> &stallOffsets = isForward ? downOffsets :
+                                                           upOffsets;
+        const std::vector<Edge> &stallEdges = isForward ? downEdges : upEdges;
+
+        int cur = openSet.top();
+        openSet.pop();
+        context.close(cur);
+        ++numExpanded;
+
+        double curCost = context.getCost(cur);
+
+        // stall on demand: skip node if a higher ranked node already
+        // reached gives it a lower cost, as it is not on a shortest path
+        bool stalled = false;
+        for (int e = stallOffsets[cur]; e < stallOffsets[cur + 1]; ++e) {
+            int n = stallEdges[e].node;
+            if (context.isVisited(n) &&
+                (context.getCost(n) + stallEdges[e].cost < curCost)) {
+                stalled = true;
+                break;
+            }
+        }
+
+        if (stalled)
+            continue;
+
+        for (int e = offsets[cur]; e < offsets[cur + 1]; ++e) {
+            int n = edges[e].node;
+            double tempCost = curCost + edges[e].cost;
+
+            if (context.isClosed(n))
+                continue;
+
+            bool inOpenSet = context.isVisited(n);
+            if (inOpenSet && (tempCost >= context.getCost(n)))
+                continue;
+
+            context.visit(n, tempCost, tempCost, cur);
+
+            if (inOpenSet)
+                openSet.decreaseKey(n, tempCost);
+            else
+                openSet.push(n, tempCost);
+
+            double total = tempCost + other.getCost(n);
+            if (total < best) {
+                best = total;
+                meetId = n;
+            }
+        }
+    }
+
+    if (meetId < 0)
+        return false;
+
+    cost = best;
+
+    // path in hierarchy: start up to meeting node, then down to goal
+    forward.extractPath(meetId, upPath);
+    for (int n = backward.getParent(meetId); n >= 0;
+         n = backward.getParent(n)) {
+        upPath.push_back(n);
+    }
+
+    path.push_back(upPath.front());
+    for (size_t i = 1; i < upPath.size(); ++i)
+        unpack(upPath[i - 1], upPath[i], path);
+
+    return true;
+}
+
+
+int ContractionHierarchy::getMiddle(int from, int to) const {
+    if (rank[from] < rank[to]) {
+        for (int e = upOffsets[from]; e < upOffsets[from + 1]; ++e) {
+            if (upEdges[e].node == to)
+                return upEdges[e].middle;
+        }
+    } else {
+        for (int e = downOffsets[to]; e < downOffsets[to + 1]; ++e) {
+            if (downEdges[e].node == from)
+                return downEdges[e].middle;
+        }
+    }
+
+    return -1;
+}
+
+
+void ContractionHierarchy::unpack(int from, int to,
+                                  std::vector<int> &path) const {
+    int middle = getMiddle(from, to);
+
+    if (middle < 0) {
+        path.push_back(to);
+        return;
+    }
+
+    unpack(from, middle, path);
+    unpack(middle, to, path);
+}
@@ -0,0 +1,267 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file DStarLiteAlgorithm.cpp
+ *  @brief Implementation of class DStarLiteAlgorithm methods
+ *
+ *  This file implements class DStarLiteAlgorithm methods.
+ *
+ *  g is the cost to goal found so far and rhs the cost through the
+ *  best neighbor's g.  Cells with g != rhs are inconsistent and kept in
+ *  the open set, keyed by [min(g, rhs) + h(start, cell) + km,
+ *  min(g, rhs)].  When the start moves, km grows by the heuristic
+ *  between old and new start instead of every key being recomputed;
+ *  stale keys are raised when they reach the top of the open set.
+ *
+ *  A cost change of a cell changes every move into it and, for
+ *  obstacles, every move out of it, so rhs of the cell and of its
+ *  neighbors is recomputed.  The next search expands only cells whose
+ *  cost to goal actually changed and that can affect the start.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "DStarLiteAlgorithm.hpp"
+#include <stdlib.h>
+#include <algorithm>
+#include <limits>
+
+
+bool DStarLiteAlgorithm::buildGraph(void) {
+    searchGoal = -1;
+
+    // searches are 8-connected
+    if (map.getNumDir() == 4)
+        return false;
+
+    return grid.build(map);
+}
+
+
+bool DStarLiteAlgorithm::computPath(double weight) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    int startId = grid.toId(start);
+    int goalId = grid.toId(goal);
+
+    if ((goalId != searchGoal) || (weight != searchWeight)) {
+        searchStart = startId;
+        resetSearch(goalId, weight);
+    } else if (startId != searchStart) {
+        keyModifier += weight * getHeuristicCost(searchStart, startId);
+        searchStart = startId;
+    }
+
+    computeShortestPath(startId);
+
+    if (std::min(g[startId], rhs[startId]) == inf)
+        return false;
+
+    // follow cheapest neighbors to goal
+    totalCost = 0;
+    int id = startId;
+    path.push_back(start);
+
+    while (id != goalId) {
+        int next = -1;
+        double step = 0;
+        double best = inf;
+
+        for (int k = 0; k < 8 && !grid.isBlocked(id); ++k) {
+            int n = id + grid.getOffset(k);
+            if (grid.isBlocked(n))
+                continue;
+
+            double cost = grid.getCellCost(n) * grid.getMultiplier(k);
+            if (cost + g[n] < best) {
+                best = cost + g[n];
+                step = cost;
+                next = n;
+            }
+        }
+
+        if ((next < 0) ||
+            (static_cast<int>(path.size()) > grid.getNumNodes())) {
+            path.clear();
+            return false;
+        }
+
+        totalCost += step;
+        id = next;
+        path.push_back(grid.toIndex(id));
+    }
+
+    return true;
+}
+
+
+bool DStarLiteAlgorithm::updateCells(const std::vector<CellChange> &changes) {
+    int numCells = map.getRow() * map.getCol();
+
+    for (auto& c : changes) {
+        if ((c.index < 1) || (c.index > numCells))
+            return false;
+
+        int id = grid.toId(c.index);
+        if (!grid.setCellCost(id, c.cost))
+            return false;
+
+        map.setCost(c.index, c.cost);
+
+        if (searchGoal < 0)
+            continue;
+
+        updateCell(id);
+        for (int k = 0; k < 8; ++k)
+            updateCell(id + grid.getOffset(k));
+    }
+
+    return true;
+}
+
+
+void DStarLiteAlgorithm::resetSearch(int goalId, double weight) {
+    int numNodes = grid.getNumNodes();
+
+    searchGoal = goalId;
+    searchWeight = weight;
+    keyModifier = 0;
+
+    g.assign(numNodes, std::numeric_limits<double>::infinity());
+    rhs.assign(numNodes, std::numeric_limits<double>::infinity());
+    openSet.clear();
+    openSet.resize(numNodes);
+
+    rhs[goalId] = 0;
+    openSet.push(goalId, getKey(goalId));
+}
+
+
+void DStarLiteAlgorithm::computeShortestPath(int startId) {
+    while (!openSet.empty() &&
+           ((openSet.topKey() < getKey(startId)) ||
+            (rhs[startId] > g[startId]))) {
+        int u = openSet.top();
+        Key key = getKey(u);
+
+        // key is stale after start moved
+        if (openSet.topKey() < key) {
+            openSet.update(u, key);
+            continue;
+        }
+
+        openSet.pop();
+        ++numExpanded;
+
+        if (g[u] > rhs[u]) {
+            // cost to goal lowered, neighbors may move through u
+            g[u] = rhs[u];
+
+            for (int k = 0; k < 8; ++k) {
+                int s = u + grid.getOffset(k);
+                if (grid.isBlocked(s) || (s == searchGoal))
+                    continue;
+
+                double cost = grid.getCellCost(u) * grid.getMultiplier(k);
+                if (cost + g[u] < rhs[s]) {
+                    rhs[s] = cost + g[u];
+                    updateOpenSet(s);
+                }
+            }
+        } else {
+            // cost to goal raised, u and neighbors look for other ways
+            g[u] = std::numeric_limits<double>::infinity();
+
+            updateCell(u);
+            for (int k = 0; k < 8; ++k)
+                updateCell(u + grid.getOffset(k));
+        }
+    }
+}
+
+
+void DStarLiteAlgorithm::updateCell(int id) {
+    if (id != searchGoal) {
+        double best = std::numeric_limits<double>::infinity();
+
+        // padding and obstacle cells cannot move anywhere
+        for (int k = 0; k < 8 && !grid.isBlocked(id); ++k) {
+            int n = id + grid.getOffset(k);
+            if (grid.isBlocked(n))
+                continue;
+
+            best = std::min(best, grid.getCellCost(n) * grid.getMultiplier(k)
+                                  + g[n]);
+        }
+
+        rhs[id] = best;
+    }
+
+    updateOpenSet(id);
+}
+
+
+void DStarLiteAlgorithm::updateOpenSet(int id) {
+    bool inOpenSet = openSet.contains(id);
+
+    if (g[id] != rhs[id]) {
+        if (inOpenSet)
+            openSet.update(id, getKey(id));
+        else
+            openSet.push(id, getKey(id));
+    } else if (inOpenSet) {
+        openSet.remove(id);
+    }
+}
+
+
+DStarLiteAlgorithm::Key DStarLiteAlgorithm::getKey(int id) {
+    double cost = std::min(g[id], rhs[id]);
+
+    return Key(cost + searchWeight * getHeuristicCost(searchStart, id) +
+               keyModifier, cost);
+}
+
+
+double DStarLiteAlgorithm::getHeuristicCost(int startId, int endId) {
+    int stride = grid.getStride();
+    int xdiff = abs(startId / stride - endId / stride);
+    int ydiff = abs(startId % stride - endId % stride);
+    int diagonal = std::min(xdiff, ydiff);
+    int straight = std::max(xdiff, ydiff) - diagonal;
+
+    // every cell costs at least 1
+    return 1.5 * diagonal + straight;
+}
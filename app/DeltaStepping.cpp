@@ -0,0 +1,215 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file DeltaStepping.cpp
+ *  @brief Implementation of class DeltaStepping methods
+ *
+ *  This file implements methods in class DeltaStepping.
+ *
+ *  Bucket b holds nodes whose tentative cost is in
+ *  [b * delta, (b + 1) * delta).  While the lowest non-empty bucket b
+ *  has nodes, they are taken out and their light edges (cost <= delta)
+ *  are relaxed in parallel; a node improved into b is relaxed again in
+ *  the next round.  Once b stays empty every node taken out of it has
+ *  its final cost, and their heavy edges are relaxed once, which only
+ *  reaches later buckets.
+ *
+ *  Costs are lowered with a compare and swap loop, so workers never
+ *  lock.  Each worker records the nodes it improved and these are put
+ *  into buckets between rounds.  An edge reaches at most
+ *  maxEdge / delta buckets ahead, so buckets are reused cyclically and
+ *  their number does not grow with the size of the map.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "DeltaStepping.hpp"
+#include <algorithm>
+#include <limits>
+
+
+namespace {
+
+///< nodes handed to a worker at a time
+const size_t grainSize = 1024;
+
+
+/**
+ *   @brief  Lower an atomic cost
+ *
+ *   @param  reference to atomic cost
+ *   @param  new cost in double
+ *   @return true if new cost is lower than old one, false otherwise
+*/
+bool lowerCost(std::atomic<double> &cost, double value) {
+    double old = cost.load(std::memory_order_relaxed);
+
+    while (value < old) {
+        if (cost.compare_exchange_weak(old, value,
+                                       std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+}  // namespace
+
+
+template <class Function>
+void DeltaStepping::forEachRange(size_t count, Function f) {
+    size_t numRanges = (count + grainSize - 1) / grainSize;
+
+    // waking the workers costs more than a small round
+    if (numRanges <= 1) {
+        f(0, 0, count);
+        return;
+    }
+
+    pool.parallelFor(static_cast<int>(numRanges), [&](int worker, int i) {
+        size_t first = static_cast<size_t>(i) * grainSize;
+        f(worker, first, std::min(count, first + grainSize));
+    });
+}
+
+
+void DeltaStepping::relax(const Graph &graph, const std::vector<int> &nodes,
+                          bool light) {
+    double width = usedDelta;
+
+    forEachRange(nodes.size(), [&](int worker, size_t first, size_t end) {
+        std::vector<Request> &improved = requests[worker];
+
+        for (size_t i = first; i < end; ++i) {
+            int u = nodes[i];
+            double uCost = cost[u].load(std::memory_order_relaxed);
+
+            graph.forEachNeighbor(u, [&](int v, double edgeCost) {
+                if ((edgeCost <= width) != light)
+                    return;
+
+                double vCost = uCost + edgeCost;
+                if (lowerCost(cost[v], vCost))
+                    improved.push_back(Request(
+                        static_cast<size_t>(vCost / width), v));
+            });
+        }
+    });
+}
+
+
+size_t DeltaStepping::collectRequests(void) {
+    size_t added = 0;
+
+    for (auto& improved : requests) {
+        for (auto& r : improved) {
+            // skip if node was improved again into another bucket
+            double vCost = cost[r.second].load(std::memory_order_relaxed);
+            if (static_cast<size_t>(vCost / usedDelta) != r.first)
+                continue;
+
+            buckets[r.first % buckets.size()].push_back(r.second);
+            ++added;
+        }
+
+        improved.clear();
+    }
+
+    return added;
+}
+
+
+void DeltaStepping::compute(const Graph &graph, int startId,
+                            std::vector<double> &costs) {
+    const double inf = std::numeric_limits<double>::infinity();
+    size_t n = static_cast<size_t>(graph.getNumNodes());
+
+    numBuckets = 0;
+    costs.assign(n, inf);
+
+    if (n == 0)
+        return;
+
+    if (numNodes < n) {
+        cost.reset(new std::atomic<double>[n]);
+        numNodes = n;
+    }
+
+    forEachRange(n, [&](int, size_t first, size_t end) {
+        for (size_t i = first; i < end; ++i)
+            cost[i].store(inf, std::memory_order_relaxed);
+    });
+
+    // largest passable edge decides how far ahead a node can land
+    std::vector<double> workerMax(pool.getNumThreads(), 0);
+    forEachRange(n, [&](int worker, size_t first, size_t end) {
+        for (size_t u = first; u < end; ++u) {
+            graph.forEachNeighbor(static_cast<int>(u),
+                                  [&](int, double edgeCost) {
+                workerMax[worker] = std::max(workerMax[worker], edgeCost);
+            });
+        }
+    });
+    double maxEdge = *std::max_element(workerMax.begin(), workerMax.end());
+
+    usedDelta = (delta > 0) ? delta : std::max(maxEdge, 1.0);
+
+    buckets.assign(static_cast<size_t>(maxEdge / usedDelta) + 2,
+                   std::vector<int>());
+    requests.resize(pool.getNumThreads());
+
+    cost[startId].store(0, std::memory_order_relaxed);
+    buckets[0].push_back(startId);
+    size_t pending = 1;
+
+    for (size_t b = 0; pending > 0; ++b) {
+        std::vector<int> &bucket = buckets[b % buckets.size()];
+
+        if (bucket.empty())
+            continue;
+
+        ++numBuckets;
+        settled.clear();
+
+        while (!bucket.empty()) {
+            frontier.swap(bucket);
+            bucket.clear();
+            pending -= frontier.size();
+
+            relax(graph, frontier, true);
+            settled.insert(settled.end(), frontier.begin(), frontier.end());
+            pending += collectRequests();
+        }
+
+        relax(graph, settled, false);
+        pending += collectRequests();
+    }
+
+    forEachRange(n, [&](int, size_t first, size_t end) {
+        for (size_t i = first; i < end; ++i)
+            costs[i] = cost[i].load(std::memory_order_relaxed);
+    });
+}
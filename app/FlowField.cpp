@@ -0,0 +1,143 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file FlowField.cpp
+ *  @brief Implementation of class FlowField methods
+ *
+ *  This file implements methods in class FlowField.
+ *
+ *  Moving from a cell into a neighbor costs the neighbor's cost, 1.5x
+ *  for diagonal moves, as in every other search of this library.  The
+ *  Dijkstra from goal therefore charges a reversed move into cell v
+ *  from neighbor n the cost of n, and the parent of v in the search
+ *  tree is the next cell from v towards goal.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "FlowField.hpp"
+#include <limits>
+#include "GraphSearch.hpp"
+
+
+namespace {
+
+/**
+ *  @brief 8-connected grid with every move reversed
+*/
+class ReversedGrid {
+ public:
+     /**
+      *   @brief  Constructor of ReversedGrid class
+      *
+      *   @param  reference to grid
+      *   @return none
+     */
+     explicit ReversedGrid(const GridGraph<8> &g) : grid(g) {}
+
+
+     /**
+      *   @brief  Get number of node ids, including padding cells
+      *
+      *   @param  none
+      *   @return number of node ids in int
+     */
+     int getNumNodes(void) const { return grid.getNumNodes(); }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every passable
+      *           neighbor that can move into a node
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         for (int k = 0; k < 8; ++k) {
+             int n = id + grid.getOffset(k);
+
+             if (!grid.isBlocked(n))
+                 f(n, grid.getCellCost(id) * grid.getMultiplier(k));
+         }
+     }
+
+ private:
+     const GridGraph<8> &grid;              ///< padded cell array
+};
+
+}  // namespace
+
+
+const uint8_t FlowField::noDirection;
+
+
+void FlowField::build(const GridGraph<8> &grid, int goal,
+                      SearchContext<BinaryHeap> &context) {
+    int numNodes = grid.getNumNodes();
+    ReversedGrid reversed(grid);
+    auto zero = [](int) { return 0.0; };
+
+    goalId = goal;
+    for (int k = 0; k < 8; ++k)
+        offset[k] = grid.getOffset(k);
+
+    aStarSearch(reversed, context, goalId, -1, 0, zero, numExpanded);
+
+    cost.assign(numNodes, std::numeric_limits<float>::infinity());
+    direction.assign(numNodes, noDirection);
+
+    for (int id = 0; id < numNodes; ++id) {
+        if (!context.isVisited(id))
+            continue;
+
+        cost[id] = static_cast<float>(context.getCost(id));
+
+        int parent = context.getParent(id);
+        if (parent < 0)
+            continue;
+
+        for (int k = 0; k < 8; ++k) {
+            if (id + offset[k] == parent)
+                direction[id] = static_cast<uint8_t>(k);
+        }
+    }
+}
+
+
+bool FlowField::extractPath(int startId, std::vector<int> &path) const {
+    path.clear();
+
+    if ((goalId < 0) ||
+        (cost[startId] == std::numeric_limits<float>::infinity()))
+        return false;
+
+    for (int id = startId; id >= 0; id = getNextHop(id))
+        path.push_back(id);
+
+    return true;
+}
@@ -0,0 +1,124 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file FlowFieldAlgorithm.cpp
+ *  @brief Implementation of class FlowFieldAlgorithm methods
+ *
+ *  This file implements class FlowFieldAlgorithm methods.
+ *
+ *  FlowFieldAlgorithm derives from PathFindAlgorithm class and keeps
+ *  the same padded one byte per cell grid as GridAStarAlgorithm.
+ *  Cached fields are kept in a list ordered by last use; the field
+ *  dropped from the back is moved to the front and rebuilt for the new
+ *  goal, so its arrays are reused.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "FlowFieldAlgorithm.hpp"
+#include <iterator>
+
+
+bool FlowFieldAlgorithm::buildGraph(void) {
+    fields.clear();
+    cache.clear();
+
+    // fields are 8-connected
+    if (map.getNumDir() == 4)
+        return false;
+
+    return grid.build(map);
+}
+
+
+bool FlowFieldAlgorithm::computPath(double) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    bool cached = false;
+    const FlowField &field = findField(grid.toId(goal), cached);
+
+    if (!cached)
+        numExpanded = field.getNumExpanded();
+
+    int startId = grid.toId(start);
+    if (!field.extractPath(startId, path))
+        return false;
+
+    totalCost = field.getCost(startId);
+
+    for (auto& n : path)
+        n = grid.toIndex(n);
+
+    return true;
+}
+
+
+const FlowField& FlowFieldAlgorithm::getFlowField(int goalIndex) {
+    bool cached = false;
+
+    return findField(grid.toId(goalIndex), cached);
+}
+
+
+void FlowFieldAlgorithm::setCacheSize(int size) {
+    cacheSize = (size < 1) ? 1 : size;
+
+    while (static_cast<int>(fields.size()) > cacheSize) {
+        cache.erase(fields.back().getGoal());
+        fields.pop_back();
+    }
+}
+
+
+FlowField& FlowFieldAlgorithm::findField(int goalId, bool &cached) {
+    auto it = cache.find(goalId);
+    cached = (it != cache.end());
+
+    if (cached) {
+        // move to front as most recently used
+        fields.splice(fields.begin(), fields, it->second);
+        return fields.front();
+    }
+
+    if (static_cast<int>(fields.size()) < cacheSize) {
+        fields.emplace_front();
+    } else {
+        cache.erase(fields.back().getGoal());
+        fields.splice(fields.begin(), fields, std::prev(fields.end()));
+    }
+
+    fields.front().build(grid, goalId, context);
+    cache[goalId] = fields.begin();
+
+    return fields.front();
+}
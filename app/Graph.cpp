@@ -0,0 +1,165 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file Graph.cpp
+ *  @brief Implementation of class Graph methods
+ *
+ *  This file implements methods in class Graph.
+ *
+ *  Graph keeps edges of a map in compressed sparse row form so that
+ *  neighbors of a node are found in O(degree) from contiguous arrays
+ *  instead of searching every edge of the map.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "Graph.hpp"
+
+
+void Graph::reset(int row, int col) {
+    numRows = row;
+    numCols = col;
+    lastSource = 0;
+
+    offsets.assign(getNumNodes() + 1, 0);
+    targets.clear();
+    costs.clear();
+}
+
+
+void Graph::addEdge(int startId, int endId, double cost) {
+    // close offsets of nodes without edges between last start and this one
+    while (lastSource < startId) {
+        ++lastSource;
+        offsets[lastSource] = static_cast<int>(targets.size());
+    }
+
+    targets.emplace_back(endId);
+    costs.emplace_back(static_cast<float>(cost));
+    offsets[startId + 1] = static_cast<int>(targets.size());
+}
+
+
+void Graph::finalize(void) {
+    int numNodes = getNumNodes();
+
+    while (lastSource < numNodes) {
+        ++lastSource;
+        if (offsets[lastSource] < offsets[lastSource - 1])
+            offsets[lastSource] = offsets[lastSource - 1];
+    }
+
+    targets.shrink_to_fit();
+    costs.shrink_to_fit();
+}
+
+
+void Graph::buildReverse(Graph &reversed) const {
+    int numNodes = getNumNodes();
+
+    reversed.numRows = numRows;
+    reversed.numCols = numCols;
+    reversed.lastSource = numNodes;
+
+    // count incoming passable edges of each node, then turn counts
+    // into offsets
+    reversed.offsets.assign(numNodes + 1, 0);
+    for (int e = 0; e < getNumEdges(); ++e) {
+        if (costs[e] < std::numeric_limits<float>::infinity())
+            ++reversed.offsets[targets[e] + 1];
+    }
+
+    for (int n = 0; n < numNodes; ++n)
+        reversed.offsets[n + 1] += reversed.offsets[n];
+
+    reversed.targets.resize(reversed.offsets[numNodes]);
+    reversed.costs.resize(reversed.offsets[numNodes]);
+    reversed.targets.shrink_to_fit();
+    reversed.costs.shrink_to_fit();
+
+    std::vector<int> next(reversed.offsets.begin(),
+                          reversed.offsets.end() - 1);
+
+    for (int n = 0; n < numNodes; ++n) {
+        for (int e = beginEdge(n); e < endEdge(n); ++e) {
+            if (costs[e] == std::numeric_limits<float>::infinity())
+                continue;
+
+            int pos = next[targets[e]]++;
+            reversed.targets[pos] = n;
+            reversed.costs[pos] = costs[e];
+        }
+    }
+}
+
+
+double Graph::getCost(int startId, int endId) const {
+    for (int e = beginEdge(startId); e < endEdge(startId); ++e) {
+        if (targets[e] == endId)
+            return costs[e];
+    }
+
+    return infinity();
+}
+
+
+bool Graph::setCost(int startId, int endId, double cost) {
+    for (int e = beginEdge(startId); e < endEdge(startId); ++e) {
+        if (targets[e] == endId) {
+            costs[e] = static_cast<float>(cost);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+size_t Graph::getMemoryUsage(void) const {
+    return offsets.capacity() * sizeof(int) +
+           targets.capacity() * sizeof(int) +
+           costs.capacity() * sizeof(float);
+}
+
+
+uint64_t Graph::getFingerprint(void) const {
+    uint64_t hash = 14695981039346656037ULL;
+
+    auto mix = [&hash](const void *data, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char*>(data);
+
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    mix(offsets.data(), offsets.size() * sizeof(int));
+    mix(targets.data(), targets.size() * sizeof(int));
+    mix(costs.data(), costs.size() * sizeof(float));
+
+    return hash;
+}
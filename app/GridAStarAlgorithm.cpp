@@ -0,0 +1,115 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file GridAStarAlgorithm.cpp
+ *  @brief Implementation of class GridAStarAlgorithm methods
+ *
+ *  This file implements class template GridAStarAlgorithm methods.
+ *
+ *  GridAStarAlgorithm derives from PathFindAlgorithm class and
+ *  overrides buildGraph so that only a padded one byte per cell
+ *  array is built from the map.  The search generates neighbors of
+ *  each cell from fixed index offsets, so startup does not pay for
+ *  building edges and memory is about one byte per cell plus search
+ *  state.  With SparseGrid, uniform chunks of cells take 4 bytes each,
+ *  which suits maps that are mostly open space.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "GridAStarAlgorithm.hpp"
+#include "GraphSearch.hpp"
+#include <math.h>
+#include <tuple>
+
+
+template <int Connectivity, class GridType>
+bool GridAStarAlgorithm<Connectivity, GridType>::buildGraph(void) {
+    // csv maps do not store connectivity
+    if (!map.hasNumDir())
+        map.setNumDir(Connectivity);
+
+    return grid.build(map);
+}
+
+
+template <int Connectivity, class GridType>
+bool GridAStarAlgorithm<Connectivity, GridType>::computPath(double weight) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    int startId = grid.toId(start);
+    int goalId = grid.toId(goal);
+
+    auto heuristic = [this, goalId](int id) {
+        return getHeuristicCost(id, goalId);
+    };
+
+    if (!aStarSearch(grid, context, startId, goalId, weight, heuristic,
+                     numExpanded)) {
+        return false;
+    }
+
+    totalCost = context.getCost(goalId);
+
+    // reconstruct path from start to goal in node indices
+    context.extractPath(goalId, path);
+    for (auto& n : path)
+        n = grid.toIndex(n);
+
+    return true;
+}
+
+
+template <int Connectivity, class GridType>
+double GridAStarAlgorithm<Connectivity, GridType>::getHeuristicCost(
+                                                    int startId, int endId) {
+    double startX = 0;
+    double startY = 0;
+    double endX = 0;
+    double endY = 0;
+
+    std::tie(startX, startY) = grid.getPos(startId);
+    std::tie(endX, endY) = grid.getPos(endId);
+
+    double xdiff = startX - endX;
+    double ydiff = startY - endY;
+
+    return sqrt((xdiff*xdiff) + (ydiff*ydiff));
+}
+
+
+// connectivities provided by this library
+template class GridAStarAlgorithm<4>;
+template class GridAStarAlgorithm<8>;
+template class GridAStarAlgorithm<4, SparseGrid<4> >;
+template class GridAStarAlgorithm<8, SparseGrid<8> >;
@@ -0,0 +1,684 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file HPAAlgorithm.cpp
+ *  @brief Implementation of class HPAAlgorithm methods
+ *
+ *  This file implements class HPAAlgorithm methods.
+ *
+ *  Along each border between two clusters, every maximal run of rows
+ *  (or columns) where a straight step crosses the border is an
+ *  entrance.  Entrances shorter than 6 cells get one transition in the
+ *  middle, longer ones one at each end.  Cells of a run are connected
+ *  along the border, so any crossing in the run is reachable from its
+ *  transitions.  Diagonal steps that cross where neither neighboring
+ *  straight step does, including across cluster corners, get their
+ *  own transitions so that no path between clusters is lost.
+ *
+ *  Transition cells of a cluster are connected by Dijkstra inside the
+ *  cluster.  For a query, start and goal are linked to transitions of
+ *  their clusters by one search each, the abstract graph is searched
+ *  with A star, and each abstract edge inside a cluster is refined by
+ *  A star over that cluster only.  When start and goal are in the same
+ *  or neighboring clusters, A star over the rectangle of both clusters
+ *  and the clusters around it first gives a direct edge between them,
+ *  which the abstract search takes whenever no path through
+ *  transitions is cheaper.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "HPAAlgorithm.hpp"
+#include "GraphSearch.hpp"
+#include <stdlib.h>
+#include <algorithm>
+#include <limits>
+
+
+namespace {
+
+/**
+ *  @brief Rectangle of the padded grid searched with local node ids,
+ *         so search state has one entry per cell of the rectangle.
+ *         Reverse follows edges backward, i.e. moving from a cell
+ *         costs that cell's cost.
+*/
+template <bool Reverse>
+class GridWindow {
+ public:
+     /**
+      *   @brief  Constructor of GridWindow class
+      *
+      *   @param  reference to grid
+      *   @param  first padded row in int
+      *   @param  first padded column in int
+      *   @param  number of rows in int
+      *   @param  number of columns in int
+      *   @return none
+     */
+     GridWindow(const GridGraph<8> &g, int row, int col, int rows, int cols)
+             : grid(g), row0(row), col0(col), height(rows), width(cols) {}
+
+
+     /**
+      *   @brief  Get number of local node ids
+      *
+      *   @param  none
+      *   @return number of nodes in int
+     */
+     int getNumNodes(void) const { return height * width; }
+
+
+     /**
+      *   @brief  Convert cell id to local id
+      *
+      *   @param  cell id in int
+      *   @return local id in int
+     */
+     int toLocal(int id) const {
+         int stride = grid.getStride();
+         return (id / stride - row0) * width + id % stride - col0;
+     }
+
+
+     /**
+      *   @brief  Convert local id to cell id
+      *
+      *   @param  local id in int
+      *   @return cell id in int
+     */
+     int toCell(int local) const {
+         return (row0 + local / width) * grid.getStride() + col0 +
+                local % width;
+     }
+
+
+     /**
+      *   @brief  Call f(neighbor local id, edge cost) for every passable
+      *           neighbor inside the window
+      *
+      *   @param  local id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int local, Function f) const {
+         int r = local / width;
+         int c = local % width;
+         int id = toCell(local);
+
+         for (int k = 0; k < 8; ++k) {
+             int nr = r + grid.getStepY(k);
+             int nc = c + grid.getStepX(k);
+
+             if ((nr < 0) || (nr >= height) || (nc < 0) || (nc >= width))
+                 continue;
+
+             int n = id + grid.getOffset(k);
+             if (grid.isBlocked(n))
+                 continue;
+
+             int cost = Reverse ? grid.getCellCost(id) : grid.getCellCost(n);
+             f(nr * width + nc, cost * grid.getMultiplier(k));
+         }
+     }
+
+ private:
+     const GridGraph<8> &grid;              ///< padded cell array
+     int row0;                              ///< first padded row
+     int col0;                              ///< first padded column
+     int height;                            ///< number of rows
+     int width;                             ///< number of columns
+};
+
+
+/**
+ *  @brief Abstract graph with query start and goal linked in.  Node
+ *         ids past the abstract nodes are start and goal.
+*/
+template <class Edge>
+class AbstractView {
+ public:
+     /**
+      *   @brief  Constructor of AbstractView class
+      *
+      *   @param  reference to abstract edges
+      *   @param  reference to edges from start
+      *   @param  reference to costs to goal
+      *   @param  cost from start to goal searched directly
+      *   @return none
+     */
+     AbstractView(const std::vector<std::vector<Edge>> &e,
+                  const std::vector<Edge> &s, const std::vector<double> &g,
+                  double direct)
+             : edges(e), startEdges(s), toGoal(g), directCost(direct),
+               startNode(static_cast<int>(e.size())),
+               goalNode(startNode + 1) {}
+
+
+     /**
+      *   @brief  Get number of node ids, including start and goal
+      *
+      *   @param  none
+      *   @return number of nodes in int
+     */
+     int getNumNodes(void) const { return goalNode + 1; }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every neighbor
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         if (id == goalNode)
+             return;
+
+         if (id == startNode) {
+             for (auto& e : startEdges)
+                 f(e.node, e.cost);
+
+             if (directCost < std::numeric_limits<double>::infinity())
+                 f(goalNode, directCost);
+
+             return;
+         }
+
+         for (auto& e : edges[id])
+             f(e.node, e.cost);
+
+         if (toGoal[id] < std::numeric_limits<double>::infinity())
+             f(goalNode, toGoal[id]);
+     }
+
+ private:
+     const std::vector<std::vector<Edge>> &edges;  ///< abstract edges
+     const std::vector<Edge> &startEdges;          ///< edges from start
+     const std::vector<double> &toGoal;            ///< costs to goal
+     double directCost;                            ///< start to goal cost
+     int startNode;                                ///< start node id
+     int goalNode;                                 ///< goal node id
+};
+
+}  // namespace
+
+
+bool HPAAlgorithm::buildGraph(void) {
+    // searches within clusters move diagonally
+    if ((clusterSize < 1) || (map.getNumDir() == 4) || !grid.build(map))
+        return false;
+
+    numRows = map.getRow();
+    numCols = map.getCol();
+    numClusterRows = (numRows + clusterSize - 1) / clusterSize;
+    numClusterCols = (numCols + clusterSize - 1) / clusterSize;
+
+    minCost = std::numeric_limits<int>::max();
+    for (int id = 0; id < grid.getNumNodes(); ++id) {
+        if (!grid.isBlocked(id))
+            minCost = std::min(minCost, grid.getCellCost(id));
+    }
+
+    nodeCell.clear();
+    edges.clear();
+    cellNode.clear();
+    clusterNodes.assign(numClusterRows * numClusterCols, std::vector<int>());
+
+    // borders between left and right clusters, then upper and lower
+    for (int r = 0; r < numClusterRows; ++r) {
+        for (int c = 0; c + 1 < numClusterCols; ++c) {
+            addBorderTransitions(true, r * clusterSize,
+                                 std::min((r + 1) * clusterSize, numRows),
+                                 (c + 1) * clusterSize - 1);
+        }
+    }
+
+    for (int r = 0; r + 1 < numClusterRows; ++r) {
+        for (int c = 0; c < numClusterCols; ++c) {
+            addBorderTransitions(false, c * clusterSize,
+                                 std::min((c + 1) * clusterSize, numCols),
+                                 (r + 1) * clusterSize - 1);
+        }
+    }
+
+    // diagonal steps across cluster corners
+    for (int r = 0; r + 1 < numClusterRows; ++r) {
+        for (int c = 0; c + 1 < numClusterCols; ++c) {
+            int i = (r + 1) * clusterSize - 1;
+            int j = (c + 1) * clusterSize - 1;
+
+            addTransition(cellId(i, j), cellId(i + 1, j + 1));
+            addTransition(cellId(i, j + 1), cellId(i + 1, j));
+        }
+    }
+
+    // connect transitions inside each cluster
+    int numExpandedBuild = 0;
+    for (auto& nodes : clusterNodes) {
+        for (int a : nodes) {
+            searchCluster(false, nodeCell[a], -1, 0, numExpandedBuild);
+
+            for (int b : nodes) {
+                double cost = getLocalCost(nodeCell[b]);
+
+                if ((a != b) &&
+                    (cost < std::numeric_limits<double>::infinity()))
+                    edges[a].push_back({b, cost});
+            }
+        }
+    }
+
+    toGoal.assign(nodeCell.size(), std::numeric_limits<double>::infinity());
+
+    return true;
+}
+
+
+bool HPAAlgorithm::computPath(double weight) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    int startId = grid.toId(start);
+    int goalId = grid.toId(goal);
+    int startCluster = getCluster(startId);
+    int goalCluster = getCluster(goalId);
+    int expanded = 0;
+
+    startEdges.clear();
+    directCost = inf;
+    directPath.clear();
+
+    // search near goal directly, entrances of a cluster border may be
+    // far off a short path across it
+    int rowDiff = abs(startCluster / numClusterCols -
+                      goalCluster / numClusterCols);
+    int colDiff = abs(startCluster % numClusterCols -
+                      goalCluster % numClusterCols);
+
+    if ((rowDiff <= 1) && (colDiff <= 1)) {
+        if (searchDirect(startId, goalId, weight, expanded)) {
+            GridWindow<false> window(grid, windowRow, windowCol, windowRows,
+                                     windowCols);
+
+            directCost = getLocalCost(goalId);
+            localContext.extractPath(window.toLocal(goalId), localPath);
+
+            for (int local : localPath)
+                directPath.push_back(window.toCell(local));
+        }
+        numExpanded += expanded;
+    }
+
+    // link start to transitions of its cluster
+    searchCluster(false, startId, -1, 0, expanded);
+    numExpanded += expanded;
+
+    for (int n : clusterNodes[startCluster]) {
+        double cost = getLocalCost(nodeCell[n]);
+        if (cost < inf)
+            startEdges.push_back({n, cost});
+    }
+
+    // link transitions of goal cluster to goal
+    searchCluster(true, goalId, -1, 0, expanded);
+    numExpanded += expanded;
+
+    for (int n : clusterNodes[goalCluster])
+        toGoal[n] = getLocalCost(nodeCell[n]);
+
+    AbstractView<AbstractEdge> view(edges, startEdges, toGoal, directCost);
+    int startNode = view.getNumNodes() - 2;
+    int goalNode = view.getNumNodes() - 1;
+
+    auto cellOf = [&](int node) {
+        if (node == startNode)
+            return startId;
+        if (node == goalNode)
+            return goalId;
+        return nodeCell[node];
+    };
+
+    auto heuristic = [&](int node) {
+        return getHeuristicCost(cellOf(node), goalId);
+    };
+
+    bool found = aStarSearch(view, abstractContext, startNode, goalNode,
+                             weight, heuristic, expanded);
+    numExpanded += expanded;
+
+    for (int n : clusterNodes[goalCluster])
+        toGoal[n] = inf;
+
+    if (!found)
+        return false;
+
+    // refine abstract edges inside clusters into cells
+    abstractContext.extractPath(goalNode, abstractPath);
+
+    std::vector<int> cells;
+    cells.push_back(startId);
+
+    for (size_t i = 1; i < abstractPath.size(); ++i) {
+        int from = cellOf(abstractPath[i - 1]);
+        int to = cellOf(abstractPath[i]);
+
+        // direct edge was searched as a whole
+        if ((abstractPath[i - 1] == startNode) &&
+            (abstractPath[i] == goalNode)) {
+            cells = directPath;
+            continue;
+        }
+
+        if ((from == to) || (getCluster(from) != getCluster(to))) {
+            if (from != to)
+                cells.push_back(to);
+            continue;
+        }
+
+        searchCluster(false, from, to, weight, expanded);
+        numExpanded += expanded;
+
+        GridWindow<false> window(grid, windowRow, windowCol, windowRows,
+                                 windowCols);
+        localContext.extractPath(window.toLocal(to), localPath);
+
+        for (size_t j = 1; j < localPath.size(); ++j)
+            cells.push_back(window.toCell(localPath[j]));
+    }
+
+    if (smoothing)
+        smoothPath(cells);
+
+    totalCost = 0;
+    for (size_t i = 1; i < cells.size(); ++i)
+        totalCost += getMoveCost(cells[i - 1], cells[i]);
+
+    for (int c : cells)
+        path.push_back(grid.toIndex(c));
+
+    return true;
+}
+
+
+int HPAAlgorithm::getNumAbstractEdges(void) {
+    int numEdges = 0;
+
+    for (auto& e : edges)
+        numEdges += static_cast<int>(e.size());
+
+    return numEdges;
+}
+
+
+int HPAAlgorithm::cellId(int row, int col) {
+    return (row + 1) * grid.getStride() + col + 1;
+}
+
+
+int HPAAlgorithm::getCluster(int id) {
+    int row = id / grid.getStride() - 1;
+    int col = id % grid.getStride() - 1;
+
+    return (row / clusterSize) * numClusterCols + col / clusterSize;
+}
+
+
+double HPAAlgorithm::getMoveCost(int from, int to) {
+    int stride = grid.getStride();
+    bool diagonal = (from / stride != to / stride) &&
+                    (from % stride != to % stride);
+
+    // setting cost to 1.5x for diagonal movement
+    return grid.getCellCost(to) * (diagonal ? 1.5 : 1.0);
+}
+
+
+void HPAAlgorithm::addTransition(int a, int b) {
+    if (grid.isBlocked(a) || grid.isBlocked(b))
+        return;
+
+    int nodes[2] = {a, b};
+    int ids[2] = {0, 0};
+
+    for (int k = 0; k < 2; ++k) {
+        auto it = cellNode.find(nodes[k]);
+
+        if (it != cellNode.end()) {
+            ids[k] = it->second;
+            continue;
+        }
+
+        ids[k] = static_cast<int>(nodeCell.size());
+        cellNode[nodes[k]] = ids[k];
+        nodeCell.push_back(nodes[k]);
+        edges.emplace_back();
+        clusterNodes[getCluster(nodes[k])].push_back(ids[k]);
+    }
+
+    for (auto& e : edges[ids[0]]) {
+        if (e.node == ids[1])
+            return;
+    }
+
+    edges[ids[0]].push_back({ids[1], getMoveCost(a, b)});
+    edges[ids[1]].push_back({ids[0], getMoveCost(b, a)});
+}
+
+
+void HPAAlgorithm::addBorderTransitions(bool vertical, int first, int last,
+                                        int border) {
+    // cell on side 0 (before border) or side 1 of position along border
+    auto side = [&](int pos, int s) {
+        return vertical ? cellId(pos, border + s) : cellId(border + s, pos);
+    };
+
+    auto isOpen = [&](int pos) {
+        return !grid.isBlocked(side(pos, 0)) && !grid.isBlocked(side(pos, 1));
+    };
+
+    int runStart = -1;
+    for (int pos = first; pos <= last; ++pos) {
+        bool open = (pos < last) && isOpen(pos);
+
+        if (open && (runStart < 0))
+            runStart = pos;
+
+        if (!open && (runStart >= 0)) {
+            int runEnd = pos - 1;
+
+            if (runEnd - runStart + 1 < 6) {
+                int mid = (runStart + runEnd) / 2;
+                addTransition(side(mid, 0), side(mid, 1));
+            } else {
+                addTransition(side(runStart, 0), side(runStart, 1));
+                addTransition(side(runEnd, 0), side(runEnd, 1));
+            }
+
+            runStart = -1;
+        }
+    }
+
+    // diagonal steps not covered by a straight crossing next to them
+    for (int pos = first; pos + 1 < last; ++pos) {
+        if (isOpen(pos) || isOpen(pos + 1))
+            continue;
+
+        addTransition(side(pos, 0), side(pos + 1, 1));
+        addTransition(side(pos + 1, 0), side(pos, 1));
+    }
+}
+
+
+bool HPAAlgorithm::searchCluster(bool reverse, int startId, int goalId,
+                                 double weight, int &expanded) {
+    int cluster = getCluster(startId);
+
+    setWindow(cluster, cluster, 0);
+
+    if (reverse) {
+        GridWindow<true> window(grid, windowRow, windowCol, windowRows,
+                                windowCols);
+        auto heuristic = [](int) { return 0.0; };
+
+        return aStarSearch(window, localContext, window.toLocal(startId), -1,
+                           0, heuristic, expanded);
+    }
+
+    GridWindow<false> window(grid, windowRow, windowCol, windowRows,
+                             windowCols);
+    int goalLocal = (goalId < 0) ? -1 : window.toLocal(goalId);
+    auto heuristic = [&](int local) {
+        return getHeuristicCost(window.toCell(local), goalId);
+    };
+
+    return aStarSearch(window, localContext, window.toLocal(startId),
+                       goalLocal, (goalId < 0) ? 0 : weight, heuristic,
+                       expanded);
+}
+
+
+bool HPAAlgorithm::searchDirect(int startId, int goalId, double weight,
+                                int &expanded) {
+    // a short path may leave the clusters of start and goal along
+    // their border, away from its entrances
+    setWindow(getCluster(startId), getCluster(goalId), 1);
+
+    GridWindow<false> window(grid, windowRow, windowCol, windowRows,
+                             windowCols);
+    auto heuristic = [&](int local) {
+        return getHeuristicCost(window.toCell(local), goalId);
+    };
+
+    return aStarSearch(window, localContext, window.toLocal(startId),
+                       window.toLocal(goalId), weight, heuristic, expanded);
+}
+
+
+void HPAAlgorithm::setWindow(int first, int second, int margin) {
+    int firstRow = std::min(first / numClusterCols, second / numClusterCols);
+    int lastRow = std::max(first / numClusterCols, second / numClusterCols);
+    int firstCol = std::min(first % numClusterCols, second % numClusterCols);
+    int lastCol = std::max(first % numClusterCols, second % numClusterCols);
+
+    firstRow = std::max(firstRow - margin, 0);
+    lastRow = std::min(lastRow + margin, numClusterRows - 1);
+    firstCol = std::max(firstCol - margin, 0);
+    lastCol = std::min(lastCol + margin, numClusterCols - 1);
+
+    windowRow = firstRow * clusterSize + 1;
+    windowCol = firstCol * clusterSize + 1;
+    windowRows = std::min((lastRow - firstRow + 1) * clusterSize,
+                          numRows + 1 - windowRow);
+    windowCols = std::min((lastCol - firstCol + 1) * clusterSize,
+                          numCols + 1 - windowCol);
+}
+
+
+double HPAAlgorithm::getLocalCost(int id) {
+    GridWindow<false> window(grid, windowRow, windowCol, windowRows,
+                             windowCols);
+
+    return localContext.getCost(window.toLocal(id));
+}
+
+
+void HPAAlgorithm::smoothPath(std::vector<int> &cells) {
+    std::unordered_map<int, int> position;
+    std::vector<double> prefixCost;
+    std::vector<int> run;
+
+    auto index = [&]() {
+        position.clear();
+        prefixCost.assign(1, 0);
+
+        for (size_t i = 0; i < cells.size(); ++i) {
+            position[cells[i]] = static_cast<int>(i);
+            if (i > 0) {
+                prefixCost.push_back(prefixCost.back() +
+                                     getMoveCost(cells[i - 1], cells[i]));
+            }
+        }
+    };
+
+    index();
+
+    // from each cell, walk straight in every direction and cut the
+    // path where the walk meets it again at lower cost
+    for (size_t i = 0; i + 2 < cells.size(); ++i) {
+        for (int k = 0; k < 8; ++k) {
+            double cost = 0;
+            int n = cells[i];
+
+            run.clear();
+
+            for (int step = 0; step < 2 * clusterSize; ++step) {
+                int next = n + grid.getOffset(k);
+                if (grid.isBlocked(next))
+                    break;
+
+                cost += grid.getCellCost(next) * grid.getMultiplier(k);
+                n = next;
+                run.push_back(n);
+
+                auto it = position.find(n);
+                if (it == position.end())
+                    continue;
+
+                size_t j = static_cast<size_t>(it->second);
+                if ((j > i + 1) && (cost < prefixCost[j] - prefixCost[i])) {
+                    run.pop_back();
+                    cells.erase(cells.begin() + i + 1, cells.begin() + j);
+                    cells.insert(cells.begin() + i + 1, run.begin(),
+                                 run.end());
+                    index();
+                }
+                break;
+            }
+        }
+    }
+}
+
+
+double HPAAlgorithm::getHeuristicCost(int startId, int endId) {
+    int stride = grid.getStride();
+    int xdiff = abs(startId / stride - endId / stride);
+    int ydiff = abs(startId % stride - endId % stride);
+    int diagonal = std::min(xdiff, ydiff);
+    int straight = std::max(xdiff, ydiff) - diagonal;
+
+    return static_cast<double>(minCost) * (1.5 * diagonal + straight);
+}
@@ -0,0 +1,151 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file IntegerAStarAlgorithm.cpp
+ *  @brief Implementation of class IntegerAStarAlgorithm methods
+ *
+ *  This file implements class IntegerAStarAlgorithm methods.
+ *
+ *  IntegerAStarAlgorithm derives from PathFindAlgorithm class and
+ *  searches the same graph as A star through a view that scales edge
+ *  costs to integers.  Rounding a consistent heuristic down keeps it
+ *  consistent for integer edge costs, so keys never drop below the
+ *  last popped key and the radix heap open set stays valid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "IntegerAStarAlgorithm.hpp"
+#include "GraphSearch.hpp"
+#include <math.h>
+#include <tuple>
+
+
+namespace {
+
+/**
+ *  @brief Graph with every edge cost multiplied by a constant
+*/
+class ScaledGraph {
+ public:
+     /**
+      *   @brief  Constructor of ScaledGraph class
+      *
+      *   @param  reference to graph
+      *   @param  cost factor in double
+      *   @return none
+     */
+     ScaledGraph(const Graph &g, double s) : graph(g), scale(s) {}
+
+
+     /**
+      *   @brief  Get number of nodes
+      *
+      *   @param  none
+      *   @return number of nodes in int
+     */
+     int getNumNodes(void) const { return graph.getNumNodes(); }
+
+
+     /**
+      *   @brief  Call f(neighbor id, scaled edge cost) for every
+      *           passable neighbor
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         graph.forEachNeighbor(id, [&](int n, double cost) {
+             f(n, cost * scale);
+         });
+     }
+
+ private:
+     const Graph &graph;                    ///< original graph
+     double scale;                          ///< cost factor
+};
+
+}  // namespace
+
+
+const int IntegerAStarAlgorithm::costScale;
+
+
+bool IntegerAStarAlgorithm::computPath(double weight) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    // inflated heuristic is not consistent, keys could drop below
+    // the last popped key
+    if (weight > 1.0)
+        return false;
+
+    ScaledGraph scaled(graph, costScale);
+
+    // weight is applied before rounding so keys stay integers
+    auto heuristic = [this, weight](int id) {
+        return getHeuristicCost(id, goal-1, weight);
+    };
+
+    if (!aStarSearch(scaled, context, start-1, goal-1, 1.0, heuristic,
+                     numExpanded)) {
+        return false;
+    }
+
+    totalCost = context.getCost(goal-1) / costScale;
+
+    // reconstruct path from start to goal in node indices
+    context.extractPath(goal-1, path);
+    for (auto& n : path)
+        ++n;
+
+    return true;
+}
+
+
+double IntegerAStarAlgorithm::getHeuristicCost(int startId, int endId,
+                                               double weight) const {
+    double startX = 0;
+    double startY = 0;
+    double endX = 0;
+    double endY = 0;
+
+    std::tie(startX, startY) = graph.getPos(startId);
+    std::tie(endX, endY) = graph.getPos(endId);
+
+    double xdiff = startX - endX;
+    double ydiff = startY - endY;
+
+    return floor(weight * costScale * sqrt((xdiff*xdiff) + (ydiff*ydiff)));
+}
@@ -0,0 +1,318 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file JPSAlgorithm.cpp
+ *  @brief Implementation of class JPSAlgorithm methods
+ *
+ *  This file implements class JPSAlgorithm methods.
+ *
+ *  Jump Point Search expands a node only in the directions that are
+ *  not dominated by a path through its parent, and walks each of those
+ *  directions until it reaches a node with a forced neighbor, the goal,
+ *  or an obstacle.  Only the nodes where the walk stops (jump points)
+ *  enter the open set.  Consecutive jump points on the final path are
+ *  always on one straight or diagonal line, so the full cell path is
+ *  rebuilt by stepping between them.
+ *
+ *  Pruning is only valid when every cell costs the same, so maps with
+ *  varying cell costs are searched with plain A star on the same grid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "JPSAlgorithm.hpp"
+#include "GraphSearch.hpp"
+#include <stdlib.h>
+#include <algorithm>
+#include <limits>
+
+
+namespace {
+
+/**
+ *   @brief  Get sign of an integer
+ *
+ *   @param  value in int
+ *   @return -1, 0, or 1
+*/
+int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+}  // namespace
+
+
+bool JPSAlgorithm::buildGraph(void) {
+    // jumps move diagonally
+    if ((map.getNumDir() == 4) || !grid.build(map))
+        return false;
+
+    int lowest = std::numeric_limits<int>::max();
+    int highest = 0;
+
+    for (int id = 0; id < grid.getNumNodes(); ++id) {
+        int cost = grid.getCellCost(id);
+
+        if (cost == 0)
+            continue;
+
+        lowest = std::min(lowest, cost);
+        highest = std::max(highest, cost);
+    }
+
+    minCost = (highest == 0) ? 0 : lowest;
+    uniform = (lowest == highest);
+
+    return true;
+}
+
+
+bool JPSAlgorithm::computPath(double weight) {
+    // initialize
+    path.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1)) {
+        return false;
+    }
+
+    int startId = grid.toId(start);
+    int goalId = grid.toId(goal);
+
+    if (uniform) {
+        if (!jumpSearch(startId, goalId, weight))
+            return false;
+    } else {
+        auto heuristic = [this, goalId](int id) {
+            return getHeuristicCost(id, goalId);
+        };
+
+        if (!aStarSearch(grid, context, startId, goalId, weight, heuristic,
+                         numExpanded)) {
+            return false;
+        }
+    }
+
+    totalCost = context.getCost(goalId);
+
+    // reconstruct path from start to goal, filling in the cells
+    // between consecutive jump points
+    std::vector<int> jumpPoints;
+    context.extractPath(goalId, jumpPoints);
+
+    int stride = grid.getStride();
+    path.push_back(grid.toIndex(jumpPoints.front()));
+
+    for (size_t i = 1; i < jumpPoints.size(); ++i) {
+        int from = jumpPoints[i - 1];
+        int to = jumpPoints[i];
+        int step = sign(to / stride - from / stride) * stride +
+                   sign(to % stride - from % stride);
+
+        for (int n = from + step; n != to; n += step)
+            path.push_back(grid.toIndex(n));
+
+        path.push_back(grid.toIndex(to));
+    }
+
+    return true;
+}
+
+
+bool JPSAlgorithm::jumpSearch(int startId, int goalId, double weight) {
+    int stride = grid.getStride();
+
+    // discard state of previous search
+    context.reset(grid.getNumNodes());
+    BinaryHeap &openSet = context.getOpenSet();
+
+    context.visit(startId, 0, weight * getHeuristicCost(startId, goalId),
+                  -1);
+    openSet.push(startId, context.getEstimateCost(startId));
+
+    while (!openSet.empty()) {
+        int cur = openSet.top();
+
+        if (cur == goalId)
+            return true;
+
+        openSet.pop();
+        context.close(cur);
+        ++numExpanded;
+
+        double curCost = context.getCost(cur);
+
+        // directions to explore: all of them from start, otherwise
+        // the natural and forced neighbors given the travel direction
+        int dirs[8][2];
+        int numDirs = 0;
+        int parent = context.getParent(cur);
+
+        if (parent < 0) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    if ((dx != 0) || (dy != 0)) {
+                        dirs[numDirs][0] = dx;
+                        dirs[numDirs][1] = dy;
+                        ++numDirs;
+                    }
+                }
+            }
+        } else {
+            int dx = sign(cur % stride - parent % stride);
+            int dy = sign(cur / stride - parent / stride);
+
+            if ((dx != 0) && (dy != 0)) {
+                int natural[3][2] = {{dx, 0}, {0, dy}, {dx, dy}};
+                for (auto& d : natural) {
+                    dirs[numDirs][0] = d[0];
+                    dirs[numDirs][1] = d[1];
+                    ++numDirs;
+                }
+
+                if (grid.isBlocked(cur - dx)) {
+                    dirs[numDirs][0] = -dx;
+                    dirs[numDirs][1] = dy;
+                    ++numDirs;
+                }
+
+                if (grid.isBlocked(cur - dy * stride)) {
+                    dirs[numDirs][0] = dx;
+                    dirs[numDirs][1] = -dy;
+                    ++numDirs;
+                }
+            } else {
+                dirs[numDirs][0] = dx;
+                dirs[numDirs][1] = dy;
+                ++numDirs;
+
+                // sides perpendicular to travel direction
+                for (int side = -1; side <= 1; side += 2) {
+                    int sx = (dx == 0) ? side : 0;
+                    int sy = (dy == 0) ? side : 0;
+
+                    if (grid.isBlocked(cur + sy * stride + sx)) {
+                        dirs[numDirs][0] = dx + sx;
+                        dirs[numDirs][1] = dy + sy;
+                        ++numDirs;
+                    }
+                }
+            }
+        }
+
+        for (int k = 0; k < numDirs; ++k) {
+            int dx = dirs[k][0];
+            int dy = dirs[k][1];
+            int steps = 0;
+            int n = jump(cur, dx, dy, goalId, steps);
+
+            if ((n < 0) || context.isClosed(n))
+                continue;
+
+            // setting cost to 1.5x for diagonal movement
+            double tempCost = curCost + static_cast<double>(minCost) * steps *
+                              (((dx != 0) && (dy != 0)) ? 1.5 : 1.0);
+
+            bool inOpenSet = context.isVisited(n);
+            if (inOpenSet && tempCost >= context.getCost(n))
+                continue;
+
+            double estimate = tempCost + weight * getHeuristicCost(n, goalId);
+            context.visit(n, tempCost, estimate, cur);
+
+            if (inOpenSet)
+                openSet.decreaseKey(n, estimate);
+            else
+                openSet.push(n, estimate);
+        }
+    }
+
+    return false;
+}
+
+
+int JPSAlgorithm::jump(int id, int dx, int dy, int goalId, int &steps) {
+    int offset = dy * grid.getStride() + dx;
+    int n = id;
+
+    steps = 0;
+
+    while (true) {
+        n += offset;
+        ++steps;
+
+        if (grid.isBlocked(n))
+            return -1;
+
+        if ((n == goalId) || hasForcedNeighbor(n, dx, dy))
+            return n;
+
+        // a diagonal step is a jump point if a straight walk from it
+        // finds one
+        if ((dx != 0) && (dy != 0)) {
+            int straightSteps = 0;
+
+            if ((jump(n, dx, 0, goalId, straightSteps) >= 0) ||
+                (jump(n, 0, dy, goalId, straightSteps) >= 0)) {
+                return n;
+            }
+        }
+    }
+}
+
+
+bool JPSAlgorithm::hasForcedNeighbor(int id, int dx, int dy) {
+    int stride = grid.getStride();
+
+    if ((dx != 0) && (dy != 0)) {
+        return (grid.isBlocked(id - dx) &&
+                !grid.isBlocked(id - dx + dy * stride)) ||
+               (grid.isBlocked(id - dy * stride) &&
+                !grid.isBlocked(id + dx - dy * stride));
+    }
+
+    if (dx != 0) {
+        return (grid.isBlocked(id - stride) &&
+                !grid.isBlocked(id - stride + dx)) ||
+               (grid.isBlocked(id + stride) &&
+                !grid.isBlocked(id + stride + dx));
+    }
+
+    return (grid.isBlocked(id - 1) && !grid.isBlocked(id - 1 + dy * stride)) ||
+           (grid.isBlocked(id + 1) && !grid.isBlocked(id + 1 + dy * stride));
+}
+
+
+double JPSAlgorithm::getHeuristicCost(int startId, int endId) {
+    int stride = grid.getStride();
+    int xdiff = std::abs(startId / stride - endId / stride);
+    int ydiff = std::abs(startId % stride - endId % stride);
+    int diagonal = std::min(xdiff, ydiff);
+    int straight = std::max(xdiff, ydiff) - diagonal;
+
+    return static_cast<double>(minCost) * (1.5 * diagonal + straight);
+}
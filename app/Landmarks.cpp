@@ -0,0 +1,327 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file Landmarks.cpp
+ *  @brief Implementation of class Landmarks methods
+ *
+ *  This file implements methods in class Landmarks.
+ *
+ *  For landmark L and nodes v, t the triangle inequality gives
+ *  d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L), so
+ *  the largest of these over all landmarks is a consistent heuristic.
+ *  Bounds are tight when L lies behind v or beyond t, hence landmarks
+ *  are spread towards the edges of the graph.
+ *
+ *  FARTHEST picks the node whose cost from the nearest chosen landmark
+ *  is largest, starting from the node farthest from a random node.
+ *  AVOID grows the shortest path tree of a random root, weights each
+ *  node by how much the current bounds underestimate its cost from
+ *  the root, and follows the heaviest branch not yet holding a
+ *  landmark down to a leaf.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "Landmarks.hpp"
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <random>
+#include "GraphSearch.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "ThreadPool.hpp"
+
+
+namespace {
+
+///< first bytes of a landmark table file
+const char fileMagic[4] = {'A', 'L', 'T', '2'};
+
+
+/**
+ *   @brief  Run Dijkstra from a node over the whole graph
+ *
+ *   @param  reference to graph
+ *   @param  reference to search context
+ *   @param  start node id in int
+ *   @return none
+*/
+void searchAll(const Graph &graph, SearchContext<BinaryHeap> &context,
+               int startId) {
+    int numExpanded = 0;
+    auto zero = [](int) { return 0.0; };
+
+    aStarSearch(graph, context, startId, -1, 0, zero, numExpanded);
+}
+
+
+/**
+ *   @brief  Select a landmark with the avoid strategy
+ *
+ *   @param  reference to graph
+ *   @param  reference to search context
+ *   @param  root node id in int
+ *   @param  reference to cost table, costs from landmarks filled in
+ *   @param  number of landmarks of table in int
+ *   @param  reference to landmarks chosen so far
+ *   @return node id of new landmark in int
+*/
+int selectAvoid(const Graph &graph, SearchContext<BinaryHeap> &context,
+                int root, const std::vector<float> &table, int stride,
+                const std::vector<int> &landmarks) {
+    int numNodes = graph.getNumNodes();
+    int numChosen = static_cast<int>(landmarks.size());
+
+    searchAll(graph, context, root);
+
+    // children before parents, as edge costs are positive
+    std::vector<int> order;
+    for (int v = 0; v < numNodes; ++v) {
+        if (context.isVisited(v))
+            order.push_back(v);
+    }
+
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return context.getCost(a) > context.getCost(b);
+    });
+
+    std::vector<double> size(numNodes, 0);
+    std::vector<int> heaviest(numNodes, -1);
+    std::vector<uint8_t> covered(numNodes, 0);
+
+    for (int l : landmarks)
+        covered[l] = 1;
+
+    const float *r = &table[static_cast<size_t>(root) * 2 * stride];
+
+    for (int v : order) {
+        const float *s = &table[static_cast<size_t>(v) * 2 * stride];
+        double bound = 0;
+
+        for (int i = 0; i < numChosen; ++i) {
+            double a = s[2 * i] - r[2 * i];
+            if (a > bound)
+                bound = a;
+        }
+
+        size[v] += context.getCost(v) - bound;
+        if (covered[v])
+            size[v] = 0;
+
+        int p = context.getParent(v);
+        if (p < 0)
+            continue;
+
+        if (covered[v])
+            covered[p] = 1;
+
+        size[p] += size[v];
+        if ((heaviest[p] < 0) || (size[v] > size[heaviest[p]]))
+            heaviest[p] = v;
+    }
+
+    int v = root;
+    while ((heaviest[v] >= 0) && (size[heaviest[v]] > 0))
+        v = heaviest[v];
+
+    return v;
+}
+
+}  // namespace
+
+
+void Landmarks::build(const Graph &graph, int count, Strategy strategy,
+                      int numThreads) {
+    const float inf = std::numeric_limits<float>::infinity();
+    auto begin = std::chrono::steady_clock::now();
+
+    numNodes = graph.getNumNodes();
+    numEdges = graph.getNumEdges();
+    fingerprint = graph.getFingerprint();
+    landmarks.clear();
+
+    // nodes with a passable edge can be landmarks
+    std::vector<int> candidates;
+    std::vector<uint8_t> passable(numNodes, 0);
+    for (int v = 0; v < numNodes; ++v) {
+        graph.forEachNeighbor(v, [&](int n, double) {
+            passable[v] = 1;
+            passable[n] = 1;
+        });
+    }
+
+    for (int v = 0; v < numNodes; ++v) {
+        if (passable[v])
+            candidates.push_back(v);
+    }
+
+    count = std::max(0, std::min(count, static_cast<int>(candidates.size())));
+    table.assign(static_cast<size_t>(numNodes) * 2 * count, inf);
+
+    SearchContext<BinaryHeap> context;
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<size_t> pick(0, candidates.empty() ? 0 :
+                                               candidates.size() - 1);
+    std::vector<float> nearest(numNodes, inf);
+
+    // each landmark depends on costs from the previous ones
+    for (int i = 0; i < count; ++i) {
+        int landmark = candidates[pick(rng)];
+
+        if (strategy == AVOID) {
+            landmark = selectAvoid(graph, context, landmark, table, count,
+                                   landmarks);
+        } else {
+            if (i == 0) {
+                searchAll(graph, context, landmark);
+                std::fill(nearest.begin(), nearest.end(), 0);
+
+                for (int v : candidates) {
+                    if (context.isVisited(v))
+                        nearest[v] = static_cast<float>(context.getCost(v));
+                }
+            }
+
+            // unreached parts of graph have infinite cost and come first
+            for (int v : candidates) {
+                if (nearest[v] > nearest[landmark])
+                    landmark = v;
+            }
+        }
+
+        landmarks.push_back(landmark);
+        searchAll(graph, context, landmark);
+
+        if (i == 0)
+            std::fill(nearest.begin(), nearest.end(), inf);
+
+        for (int v = 0; v < numNodes; ++v) {
+            float cost = static_cast<float>(context.getCost(v));
+
+            table[(static_cast<size_t>(v) * count + i) * 2] = cost;
+            nearest[v] = std::min(nearest[v], cost);
+        }
+    }
+
+    // costs to landmarks are independent of each other
+    Graph reversed;
+    graph.buildReverse(reversed);
+
+    ThreadPool pool(numThreads);
+    std::vector<SearchContext<BinaryHeap>> contexts(pool.getNumThreads());
+
+    pool.parallelFor(count, [&](int worker, int i) {
+        SearchContext<BinaryHeap> &workerContext = contexts[worker];
+
+        searchAll(reversed, workerContext, landmarks[i]);
+
+        for (int v = 0; v < numNodes; ++v) {
+            table[(static_cast<size_t>(v) * count + i) * 2 + 1] =
+                static_cast<float>(workerContext.getCost(v));
+        }
+    });
+
+    preprocessTime = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin).count();
+}
+
+
+bool Landmarks::save(const std::string &file) const {
+    std::ofstream out(file, std::ios::binary);
+
+    if (!out.is_open())
+        return false;
+
+    int32_t header[3] = {numNodes, numEdges, getNumLandmarks()};
+
+    out.write(fileMagic, sizeof(fileMagic));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(&fingerprint),
+              sizeof(fingerprint));
+    out.write(reinterpret_cast<const char*>(landmarks.data()),
+              landmarks.size() * sizeof(int));
+    out.write(reinterpret_cast<const char*>(table.data()),
+              table.size() * sizeof(float));
+
+    return out.good();
+}
+
+
+bool Landmarks::load(const std::string &file, const Graph &graph) {
+    std::ifstream in(file, std::ios::binary);
+    char magic[4];
+    int32_t header[3];
+    uint64_t fileFingerprint = 0;
+
+    if (!in.read(magic, sizeof(magic)) ||
+        !std::equal(magic, magic + 4, fileMagic) ||
+        !in.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        !in.read(reinterpret_cast<char*>(&fileFingerprint),
+                 sizeof(fileFingerprint)))
+        return false;
+
+    // tables of another graph would give wrong bounds, and edges into
+    // obstacles are counted, so size alone does not tell maps apart
+    if ((header[0] != graph.getNumNodes()) ||
+        (header[1] != graph.getNumEdges()) || (header[2] < 0) ||
+        (fileFingerprint != graph.getFingerprint()))
+        return false;
+
+    // a corrupt count must not allocate more than the file can hold
+    std::streamoff begin = in.tellg();
+    in.seekg(0, std::ios::end);
+    uint64_t remaining = static_cast<uint64_t>(in.tellg() - begin);
+    uint64_t needed = static_cast<uint64_t>(header[2]) *
+                      (sizeof(int) + static_cast<uint64_t>(header[0]) * 2 *
+                                     sizeof(float));
+
+    if ((header[2] > header[0]) || (needed > remaining))
+        return false;
+
+    in.seekg(begin);
+
+    std::vector<int> fileLandmarks(header[2]);
+    std::vector<float> fileTable(static_cast<size_t>(header[0]) * 2 *
+                                 header[2]);
+
+    if (!in.read(reinterpret_cast<char*>(fileLandmarks.data()),
+                 fileLandmarks.size() * sizeof(int)) ||
+        !in.read(reinterpret_cast<char*>(fileTable.data()),
+                 fileTable.size() * sizeof(float)))
+        return false;
+
+    numNodes = header[0];
+    numEdges = header[1];
+    fingerprint = fileFingerprint;
+    preprocessTime = 0;
+    landmarks.swap(fileLandmarks);
+    table.swap(fileTable);
+
+    return true;
+}
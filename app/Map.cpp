@@ -31,7 +31,16 @@
  *
  *  Map class supports creating map from csv file, saving map with
  *  path from start to goal into csv file, and displaying map on
- *  the screen.
+ *  the screen.  Obstacles are kept as one bit per cell and costs in
+ *  a one byte per cell layer that is allocated on first use, so a map
+ *  of cost 1 cells takes 1/8 byte per cell.
+ *
+ *  The binary map format is a 64 byte header (magic "PMAP", version,
+ *  rows, cols, connectivity, flags, offsets of cell data) followed by
+ *  the obstacle words and, if flagged, the cost bytes, each starting
+ *  on a 64 byte boundary.  Fields are in native byte order.  The file
+ *  is mapped privately, so cells are used in place, pages are shared
+ *  between processes, and cell changes are copied on write.
  *
  *  @author Huei Tzu Tsai
  *  @date   03/07/2017
@@ -39,14 +48,24 @@
 
 
 #include <string.h>
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <iomanip>
 #include <memory>
 #include <limits>
 
 #include "Map.hpp"
+#include "ThreadPool.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAP_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using std::cout;
 using std::endl;
@@ -54,51 +73,441 @@ using std::string;
 using std::vector;
 using std::ifstream;
 using std::ofstream;
-using std::getline;
 using std::numeric_limits;
 
+
+namespace {
+
+///< first bytes of a binary map file
+const char mapFileMagic[4] = {'P', 'M', 'A', 'P'};
+
+///< version of binary map format written
+const uint32_t mapFileVersion = 1;
+
+///< flag set when cost bytes follow obstacle words
+const uint32_t mapFileHasCosts = 1;
+
+///< alignment of cell data in file
+const uint64_t mapFileAlign = 64;
+
+
+/**
+ *  @brief Header at the start of a binary map file
+*/
+struct MapFileHeader {
+    char magic[4];                                ///< "PMAP"
+    uint32_t version;                             ///< format version
+    uint32_t rows;                                ///< number of rows
+    uint32_t cols;                                ///< number of cols
+    uint32_t connectivity;                        ///< 4 or 8
+    uint32_t flags;                               ///< mapFileHasCosts
+    uint64_t obstacleOffset;                      ///< offset of obstacle
+                                                  ///< words
+    uint64_t costOffset;                          ///< offset of cost bytes,
+                                                  ///< 0 if none
+    uint8_t reserved[24];                         ///< zero
+};
+
+static_assert(sizeof(MapFileHeader) == 64, "map file header is 64 bytes");
+
+
+/**
+ *   @brief  Round offset up to alignment of cell data
+ *
+ *   @param  offset in bytes
+ *   @return aligned offset in bytes
+*/
+uint64_t alignOffset(uint64_t offset) {
+    return (offset + mapFileAlign - 1) / mapFileAlign * mapFileAlign;
+}
+
+
+
+///< smallest csv chunk parsed by one worker, in bytes
+const size_t csvChunkSize = 1 << 20;
+
+///< largest number of csv chunks of a file
+const size_t csvMaxChunks = 256;
+
+
+/**
+ *  @brief Part of a csv map file parsed by one worker
+*/
+struct CsvChunk {
+    const char *begin;                            ///< first byte
+    const char *end;                              ///< one past last byte
+    bool valid;                                   ///< every row has
+                                                  ///< valid cells
+    bool hasCosts;                                ///< a cell may cost
+                                                  ///< more than 1
+    int numRows;                                  ///< non-blank rows
+    uint64_t firstCell;                           ///< cell of first row
+    int numPartial;                               ///< words also touched
+                                                  ///< by another chunk
+    uint64_t partialWord[2];                      ///< index of such words
+    uint64_t partialBits[2];                      ///< obstacle bits of
+                                                  ///< such words
+};
+
+
+/**
+ *   @brief  Skip spaces, tabs, and carriage returns
+ *
+ *   @param  pointer to text
+ *   @param  pointer to end of text
+ *   @return pointer to first other character
+*/
+inline const char* skipBlanks(const char *p, const char *end) {
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+        ++p;
+    return p;
+}
+
+
+/**
+ *   @brief  Get end of line
+ *
+ *   @param  pointer to start of line
+ *   @param  pointer to end of text
+ *   @return pointer to line break, or end of text
+*/
+inline const char* findLineEnd(const char *p, const char *end) {
+    const void *q = memchr(p, '\n', end - p);
+    return q ? static_cast<const char*>(q) : end;
+}
+
+
+/**
+ *   @brief  Parse one cell, 'o' or 'O' for obstacle or a cost in
+ *           [1, 255]
+ *
+ *   @param  reference to pointer to text, moved past cell
+ *   @param  pointer to end of text
+ *   @param  reference to cell cost, max int for obstacle
+ *   @return true if cell is valid and followed by ',', line break, or
+ *           end of text, false otherwise
+*/
+inline bool parseCell(const char *&p, const char *end, int &cost) {
+    p = skipBlanks(p, end);
+
+    if ((p < end) && ((*p == 'o') || (*p == 'O'))) {
+        cost = numeric_limits<int>::max();
+        ++p;
+    } else {
+        const char *digits = p;
+        cost = 0;
+
+        while ((p < end) && (*p >= '0') && (*p <= '9')) {
+            if (cost <= 255)
+                cost = cost * 10 + (*p - '0');
+            ++p;
+        }
+
+        if ((p == digits) || (cost < 1) || (cost > 255))
+            return false;
+    }
+
+    p = skipBlanks(p, end);
+
+    return (p == end) || (*p == ',') || (*p == '\n');
+}
+
+
+/**
+ *   @brief  Count cells of first non-blank row
+ *
+ *   @param  pointer to text
+ *   @param  pointer to end of text
+ *   @return number of cells in int, 0 if there is no row
+*/
+int countRowCells(const char *p, const char *end) {
+    while (p < end) {
+        const char *lineEnd = findLineEnd(p, end);
+
+        if (skipBlanks(p, lineEnd) < lineEnd)
+            return static_cast<int>(std::count(p, lineEnd, ',')) + 1;
+
+        p = (lineEnd < end) ? lineEnd + 1 : end;
+    }
+
+    return 0;
+}
+
+
+/**
+ *   @brief  Count non-blank rows of a chunk and check if any cell may
+ *           cost more than 1, i.e. has a digit other than a single 1
+ *
+ *   @param  reference to chunk
+ *   @return none
+*/
+void countCsvChunk(CsvChunk &chunk) {
+    const char *end = chunk.end;
+
+    for (const char *p = chunk.begin; p < end; ) {
+        const char *lineEnd = findLineEnd(p, end);
+
+        if (skipBlanks(p, lineEnd) < lineEnd)
+            ++chunk.numRows;
+
+        p = (lineEnd < end) ? lineEnd + 1 : end;
+    }
+
+    // digits other than 1, or a 1 followed by a digit (10 to 199);
+    // written without branches on bytes so the loop vectorizes
+    const unsigned char *text =
+        reinterpret_cast<const unsigned char*>(chunk.begin);
+    size_t size = static_cast<size_t>(end - chunk.begin);
+    unsigned char hasCosts = 0;
+
+    for (size_t i = 0; i + 1 < size; ++i) {
+        unsigned char c = text[i] - '0';
+        unsigned char d = text[i + 1] - '0';
+        hasCosts |= (c <= 9) & ((c != 1) | (d <= 9));
+    }
+
+    unsigned char last = text[size - 1] - '0';
+    chunk.hasCosts = (hasCosts != 0) || ((last <= 9) && (last != 1));
+}
+
+
+/**
+ *   @brief  Parse a counted chunk and store obstacle bits and costs.
+ *           Chunk is marked not valid if a cell is not valid or a row
+ *           does not have width cells.
+ *
+ *   @param  reference to chunk
+ *   @param  number of cells per row in int
+ *   @param  pointer to obstacle words of map
+ *   @param  pointer to cost layer of map, nullptr if all cells cost 1
+ *   @return none
+*/
+void fillCsvChunk(CsvChunk &chunk, int width, uint64_t *obstacles,
+                  uint8_t *costs) {
+    const int blocked = numeric_limits<int>::max();
+    uint64_t firstCell = chunk.firstCell;
+    uint64_t endCell = firstCell +
+                       static_cast<uint64_t>(chunk.numRows) * width;
+    uint64_t cell = firstCell;
+    uint64_t word = firstCell / 64;
+    uint64_t bits = 0;
+
+    // words holding cells of another chunk are merged by the caller
+    auto flush = [&]() {
+        if ((word * 64 >= firstCell) && ((word + 1) * 64 <= endCell)) {
+            obstacles[word] = bits;
+        } else {
+            chunk.partialWord[chunk.numPartial] = word;
+            chunk.partialBits[chunk.numPartial] = bits;
+            ++chunk.numPartial;
+        }
+    };
+
+    const char *p = chunk.begin;
+    const char *end = chunk.end;
+
+    chunk.valid = true;
+
+    while (p < end) {
+        const char *q = skipBlanks(p, end);
+
+        if ((q == end) || (*q == '\n')) {
+            p = (q < end) ? q + 1 : end;
+            continue;
+        }
+
+        int j = 0;
+
+        while (true) {
+            int cost = 0;
+            bool obstacle = false;
+
+            if ((p + 1 < end) && ((p[1] == ',') || (p[1] == '\n'))) {
+                // one character cell, without branching on its value
+                unsigned digit = static_cast<unsigned char>(p[0]) - '0';
+                obstacle = (p[0] | 0x20) == 'o';
+
+                if (!(obstacle | (digit - 1 < 9))) {
+                    chunk.valid = false;
+                    return;
+                }
+
+                cost = obstacle ? 1 : static_cast<int>(digit);
+                ++p;
+            } else if (parseCell(p, end, cost)) {
+                obstacle = (cost == blocked);
+                cost = obstacle ? 1 : cost;
+            } else {
+                chunk.valid = false;
+                return;
+            }
+
+            if (j == width) {
+                chunk.valid = false;
+                return;
+            }
+
+            if (cell / 64 != word) {
+                flush();
+                word = cell / 64;
+                bits = 0;
+            }
+
+            bits |= static_cast<uint64_t>(obstacle) << (cell % 64);
+
+            if (costs)
+                costs[cell] = static_cast<uint8_t>(cost);
+
+            ++cell;
+            ++j;
+
+            if ((p < end) && (*p == ','))
+                ++p;
+            else
+                break;
+        }
+
+        if (j != width) {
+            chunk.valid = false;
+            return;
+        }
+
+        if (p < end)
+            ++p;
+    }
+
+    if (cell > firstCell)
+        flush();
+}
+
+}  // namespace
+
+
 bool Map::createMap(string inputFile) {
     ifstream inputFs;
-    string line;
-    string temp;
+
+    // binary maps are mapped, not parsed
+    char magic[4] = {0};
+    inputFs.open(inputFile, std::ios::binary);
+    inputFs.read(magic, sizeof(magic));
+    inputFs.close();
+
+    if (memcmp(magic, mapFileMagic, sizeof(magic)) == 0)
+        return openMap(inputFile);
 
     // initialize param
-    mapArray.clear();
+    unmap();
     row = 0;
     col = 0;
+    numDir = 8;
+    numDirSet = false;
 
-    // open graph file
-    inputFs.open(inputFile);
+    // open graph file and read it whole
+    inputFs.open(inputFile, std::ios::binary | std::ios::ate);
 
-    if (inputFs.is_open()) {
-        while (getline(inputFs, line)) {
-            int cnt = 0;
-            std::istringstream linestream(line);
+    if (!inputFs.is_open())
+        return false;
 
-            while (getline(linestream, temp, ',')) {
-                ++cnt;
-                if ((temp == "o") || (temp == "O")) {
-                    mapArray.emplace_back(numeric_limits<int>::max());
-                } else {
-                    mapArray.emplace_back(1);
-                }
-            }
+    size_t size = static_cast<size_t>(inputFs.tellg());
+    vector<char> text(size);
+
+    inputFs.seekg(0);
+    inputFs.read(text.data(), size);
+    if (!inputFs)
+        return false;
 
-            col = cnt;
-            cnt = 0;
+    inputFs.close();
 
-            ++row;
+    // split into chunks that end at a line break
+    size_t chunkSize = std::max(csvChunkSize, size / csvMaxChunks + 1);
+    vector<CsvChunk> chunks;
+    const char *begin = text.data();
+    const char *end = begin + size;
+
+    for (const char *p = begin; p < end; ) {
+        const char *q = (static_cast<size_t>(end - p) > chunkSize) ?
+                        p + chunkSize : end;
+
+        q = static_cast<const char*>(memchr(q - 1, '\n', end - (q - 1)));
+        q = q ? q + 1 : end;
+
+        CsvChunk chunk;
+        memset(&chunk, 0, sizeof(chunk));
+        chunk.begin = p;
+        chunk.end = q;
+        chunks.push_back(chunk);
+
+        p = q;
+    }
+
+    // parse chunks on workers, or on this thread if there is only one
+    std::unique_ptr<ThreadPool> pool;
+    if (chunks.size() > 1)
+        pool.reset(new ThreadPool(numThreads));
+
+    auto forEachChunk = [&](const std::function<void(CsvChunk&)> &f) {
+        if (!pool) {
+            for (auto& c : chunks)
+                f(c);
+            return;
         }
 
-        // cout << "number of cols: " << col << endl;
-        // cout << "number of rows: " << row << endl;
-        // cout << "size of vector array: " << mapArray.size() << endl;
-        inputFs.close();
+        pool->parallelFor(static_cast<int>(chunks.size()),
+                          [&](int, int i) { f(chunks[i]); });
+    };
 
-        return true;
+    // first pass counts rows, so each chunk knows its first cell
+    forEachChunk(countCsvChunk);
+
+    // every row must have as many cells as the first one
+    int width = countRowCells(begin, end);
+    uint64_t numRows = 0;
+    bool hasCosts = false;
+
+    for (auto& c : chunks) {
+        c.firstCell = numRows * width;
+        numRows += c.numRows;
+        hasCosts = hasCosts || c.hasCosts;
     }
 
-    return false;
+    uint64_t numCells = numRows * width;
+    if ((numCells == 0) ||
+        (numCells > static_cast<uint64_t>(numeric_limits<int>::max())))
+        return false;
+
+    row = static_cast<int>(numRows);
+    col = width;
+
+    obstacles.assign((numCells + 63) / 64, 0);
+    obstacleData = obstacles.data();
+
+    if (hasCosts) {
+        costs.resize(numCells);
+        costData = costs.data();
+    }
+
+    // second pass checks and stores cells, words shared by two chunks
+    // are merged afterwards
+    forEachChunk([&](CsvChunk &c) {
+        fillCsvChunk(c, width, obstacleData, costData);
+    });
+
+    for (auto& c : chunks) {
+        if (!c.valid) {
+            unmap();
+            row = 0;
+            col = 0;
+            return false;
+        }
+
+        for (int k = 0; k < c.numPartial; ++k)
+            obstacleData[c.partialWord[k]] |= c.partialBits[k];
+    }
+
+    // cout << "number of cols: " << col << endl;
+    // cout << "number of rows: " << row << endl;
+
+    return true;
 }
 
 
@@ -120,7 +529,7 @@ bool Map::saveMap(string outputFile, vector<int> &path) {
                     outputFs << "G";
                 else if (isInPath(index, path))
                     outputFs << "*";
-                else if (mapArray[index-1] == numeric_limits<int>::max())
+                else if (isBlocked(index))
                     outputFs << "O";
                 else
                     outputFs << " ";
@@ -143,7 +552,6 @@ bool Map::saveMap(string outputFile, vector<int> &path) {
 bool Map::setStartGoal(int s, int g) {
     int minIndex = 1;
     int maxIndex = row * col;
-    int index = 0;
 
 
     if ((s < minIndex) || (s > maxIndex))
@@ -153,15 +561,8 @@ bool Map::setStartGoal(int s, int g) {
     if (g < minIndex || g > maxIndex)
         return false;
 
-    for (auto& i : mapArray) {
-        if (i == numeric_limits<int>::max()) {
-            index = &i - &mapArray[0];
-
-            if ((s == (index + 1)) || (g == (index + 1))) {
-                return false;
-            }
-        }
-    }
+    if (isBlocked(s) || isBlocked(g))
+        return false;
 
     startIdx = s;
     goalIdx = g;
@@ -202,7 +603,7 @@ void Map::displayPath(vector<int> &path) {
                         cout << " G ";
                     else if (isInPath(index, path))
                         cout << " * ";
-                    else if (mapArray[index-1] == numeric_limits<int>::max())
+                    else if (isBlocked(index))
                         cout << " O ";
                     else
                         cout << "   ";
@@ -241,7 +642,7 @@ void Map::displayMap(void) {
 
                     index = (x * col + y + 1);
 
-                    if (mapArray[index-1] == numeric_limits<int>::max())
+                    if (isBlocked(index))
                         cout << "   ";
                     else
                         cout << std::setw(3) << index;
@@ -255,6 +656,206 @@ void Map::displayMap(void) {
 }
 
 
+bool Map::openMap(string inputFile) {
+    unmap();
+    row = 0;
+    col = 0;
+
+    uint8_t *base = nullptr;
+    size_t size = 0;
+
+#ifdef MAP_HAS_MMAP
+    int fd = open(inputFile.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        return false;
+    }
+
+    size = static_cast<size_t>(status.st_size);
+    if (size < sizeof(MapFileHeader)) {
+        close(fd);
+        return false;
+    }
+
+    // private mapping: writes are copied on write, never reach the file
+    void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (p == MAP_FAILED)
+        return false;
+
+    mapping = p;
+    mappingSize = size;
+    base = static_cast<uint8_t*>(p);
+#else
+    // read whole file into words, which keeps cell data aligned
+    ifstream inputFs(inputFile, std::ios::binary | std::ios::ate);
+    if (!inputFs.is_open())
+        return false;
+
+    size = static_cast<size_t>(inputFs.tellg());
+    if (size < sizeof(MapFileHeader))
+        return false;
+
+    obstacles.resize((size + 7) / 8);
+    inputFs.seekg(0);
+    inputFs.read(reinterpret_cast<char*>(obstacles.data()), size);
+    if (!inputFs) {
+        unmap();
+        return false;
+    }
+
+    base = reinterpret_cast<uint8_t*>(obstacles.data());
+#endif
+
+    const MapFileHeader *header = reinterpret_cast<MapFileHeader*>(base);
+    uint64_t numCells = static_cast<uint64_t>(header->rows) * header->cols;
+    uint64_t numWords = (numCells + 63) / 64;
+    uint64_t maxCells = static_cast<uint64_t>(numeric_limits<int>::max());
+    uint64_t obstacleEnd = header->obstacleOffset + numWords * 8;
+    bool hasCosts = (header->flags & mapFileHasCosts) != 0;
+
+    // offsets are compared against what is left of the file, so huge
+    // values cannot wrap around
+    bool valid = (memcmp(header->magic, mapFileMagic, 4) == 0) &&
+                 (header->version == mapFileVersion) &&
+                 (numCells > 0) &&
+                 (numCells <= maxCells) &&
+                 ((header->connectivity == 4) || (header->connectivity == 8)) &&
+                 (header->obstacleOffset % mapFileAlign == 0) &&
+                 (header->obstacleOffset >= sizeof(MapFileHeader)) &&
+                 (header->obstacleOffset <= size) &&
+                 (numWords * 8 <= size - header->obstacleOffset);
+
+    // cost section follows obstacle words, and every cell costs at
+    // least 1 as in maps read from csv files
+    if (valid && hasCosts) {
+        valid = (header->costOffset % mapFileAlign == 0) &&
+                (header->costOffset >= obstacleEnd) &&
+                (header->costOffset <= size) &&
+                (numCells <= size - header->costOffset) &&
+                (memchr(base + header->costOffset, 0, numCells) == nullptr);
+    }
+
+    if (!valid) {
+        unmap();
+        return false;
+    }
+
+    row = static_cast<int>(header->rows);
+    col = static_cast<int>(header->cols);
+    numDir = static_cast<int>(header->connectivity);
+    numDirSet = true;
+    obstacleData = reinterpret_cast<uint64_t*>(base + header->obstacleOffset);
+    costData = hasCosts ? base + header->costOffset : nullptr;
+
+    return true;
+}
+
+
+bool Map::saveBinaryMap(string outputFile) const {
+    uint64_t numCells = static_cast<uint64_t>(row) * col;
+    uint64_t numWords = (numCells + 63) / 64;
+
+    if (numCells == 0)
+        return false;
+
+    MapFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, mapFileMagic, sizeof(header.magic));
+    header.version = mapFileVersion;
+    header.rows = static_cast<uint32_t>(row);
+    header.cols = static_cast<uint32_t>(col);
+    header.connectivity = static_cast<uint32_t>(numDir);
+    header.flags = costData ? mapFileHasCosts : 0;
+    header.obstacleOffset = alignOffset(sizeof(header));
+    header.costOffset = costData ?
+        alignOffset(header.obstacleOffset + numWords * 8) : 0;
+
+    ofstream outputFs(outputFile, std::ios::binary);
+    if (!outputFs.is_open())
+        return false;
+
+    const char zeros[mapFileAlign] = {0};
+
+    outputFs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outputFs.write(zeros, header.obstacleOffset - sizeof(header));
+    outputFs.write(reinterpret_cast<const char*>(obstacleData), numWords * 8);
+
+    if (costData) {
+        outputFs.write(zeros, header.costOffset - header.obstacleOffset -
+                              numWords * 8);
+        outputFs.write(reinterpret_cast<const char*>(costData), numCells);
+    }
+
+    return static_cast<bool>(outputFs);
+}
+
+
+bool Map::setNumDir(int n) {
+    if ((n != 4) && (n != 8))
+        return false;
+
+    numDir = n;
+    numDirSet = true;
+    return true;
+}
+
+
+void Map::unmap(void) {
+#ifdef MAP_HAS_MMAP
+    if (mapping)
+        munmap(mapping, mappingSize);
+#endif
+
+    mapping = nullptr;
+    mappingSize = 0;
+    obstacleData = nullptr;
+    costData = nullptr;
+    std::vector<uint64_t>().swap(obstacles);
+    std::vector<uint8_t>().swap(costs);
+}
+
+
+bool Map::setCost(int index, int cost) {
+    uint64_t bit = uint64_t(1) << ((index - 1) % 64);
+    uint64_t &word = obstacleData[(index - 1) / 64];
+
+    if (cost == numeric_limits<int>::max()) {
+        word |= bit;
+        return true;
+    }
+
+    if ((cost < 1) || (cost > 255))
+        return false;
+
+    word &= ~bit;
+
+    // cost layer is only needed once a cell costs more than 1
+    if (!costData && (cost == 1))
+        return true;
+
+    if (!costData) {
+        costs.assign(static_cast<size_t>(row) * col, 1);
+        costData = costs.data();
+    }
+
+    costData[index - 1] = static_cast<uint8_t>(cost);
+
+    return true;
+}
+
+
+size_t Map::getMemoryUsage(void) const {
+    return obstacles.capacity() * sizeof(uint64_t) + costs.capacity() +
+           mappingSize;
+}
+
+
 bool Map::isInPath(int index, vector<int> &path) {
     for (auto& n : path) {
         if (n == index)
@@ -0,0 +1,93 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/**
+ *  @file MapConvert.cpp
+ *  @brief Converter from csv map to binary map format
+ *
+ *  This program reads a csv map (e.g. data/default.csv) and writes it
+ *  in the binary map format, which Map opens with mmap instead of
+ *  parsing text.  Given a tile size, it writes the tiled map format
+ *  read by TiledMap instead.
+ *
+ *  Usage: map-convert <input.csv> <output.map> [connectivity] [tileSize]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include "Map.hpp"
+#include "TiledMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  converter program entrypoint
+ *  
+ *   @param  number of arguments
+ *   @param  arguments: input csv, output file, connectivity (4 or 8),
+ *           tile size (power of 2 in [8, 4096]) for tiled output
+ *   @return integer 0 upon exit success \n
+             integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        cout << "Usage: map-convert <input.csv> <output.map> "
+             << "[connectivity] [tileSize]" << endl;
+        return -1;
+    }
+
+    int connectivity = (argc > 3) ? atoi(argv[3]) : 8;
+    int tileSize = (argc > 4) ? atoi(argv[4]) : 0;
+    Map map;
+
+    if (!map.createMap(argv[1]) || (map.getRow() * map.getCol() == 0)) {
+        cout << "Fail to read " << argv[1] << endl;
+        return -1;
+    }
+
+    if (!map.setNumDir(connectivity)) {
+        cout << "Connectivity must be 4 or 8" << endl;
+        return -1;
+    }
+
+    bool saved = (tileSize > 0) ?
+                 TiledMap::create(map, argv[2], tileSize) :
+                 map.saveBinaryMap(argv[2]);
+
+    if (!saved) {
+        cout << "Fail to write " << argv[2] << endl;
+        return -1;
+    }
+
+    cout << argv[2] << ": " << map.getRow() << "x" << map.getCol()
+         << ", " << connectivity << "-connected" << endl;
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file MultiAgentPlanner.cpp
+ *  @brief Implementation of class MultiAgentPlanner methods
+ *
+ *  This file implements class MultiAgentPlanner methods.
+ *
+ *  Every step takes one timestep, so the cost of a space-time state
+ *  (cell, t) is t no matter how it was reached.  Duplicates are
+ *  therefore dropped when generated, and the closed set is a hashed
+ *  set of (cell, t) keys rather than an array over the unbounded
+ *  space-time graph.  The heuristic is the exact number of steps to
+ *  goal ignoring agents, from one breadth first search per agent, and
+ *  is raised to the first timestep after which nobody crosses the
+ *  goal, since the agent stays there.
+ *
+ *  After the last reserved timestep only parked agents remain, and
+ *  they never move again.  A state reached at that time is finished
+ *  with a second breadth first search that treats parked cells as
+ *  obstacles, so search never runs past the makespan of agents
+ *  planned so far, and an agent walled in by parked agents fails
+ *  without exploring the whole horizon.
+ *
+ *  Reservations are keyed by cell and time for vertices and by cell,
+ *  direction and time for moves.  A move from a to b at time t
+ *  conflicts with a reserved move from b to a at time t.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "MultiAgentPlanner.hpp"
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+
+namespace {
+
+/**
+ *  @brief Entry of open set, ordered so the top has the lowest
+ *         estimate and, among those, the latest timestep
+*/
+struct OpenEntry {
+     int estimate;                                 ///< time + heuristic
+     int time;                                     ///< timestep
+     int state;                                    ///< state number
+
+     bool operator<(const OpenEntry& other) const {
+         if (estimate != other.estimate)
+             return estimate > other.estimate;
+         return time < other.time;
+     }
+};
+
+}  // namespace
+
+
+bool MultiAgentPlanner::buildGraph(void) {
+    // csv maps do not store connectivity
+    if (!map.hasNumDir())
+        map.setNumDir(4);
+
+    return grid.build(map);
+}
+
+
+int MultiAgentPlanner::planAgents(const std::vector<AgentTask>& tasks,
+                                  std::vector<std::vector<int>>& paths) {
+    int n = grid.getNumNodes();
+    int numPlanned = 0;
+    std::vector<int> ids;
+
+    paths.assign(tasks.size(), std::vector<int>());
+    totalCost = 0;
+    numExpanded = 0;
+
+    // graph is not built
+    if (n == 0)
+        return 0;
+
+    vertexTable.clear();
+    edgeTable.clear();
+    parkedFrom.assign(n, std::numeric_limits<int>::max());
+    lastReserved.assign(n, -1);
+    lastTime = -1;
+
+    int limit = horizon;
+    if (limit <= 0) {
+        limit = 2 * (map.getRow() + map.getCol()) +
+                static_cast<int>(tasks.size());
+    }
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (!isPassable(tasks[i].start) || !isPassable(tasks[i].goal))
+            continue;
+
+        if (!planAgent(grid.toId(tasks[i].start), grid.toId(tasks[i].goal),
+                       limit, ids))
+            continue;
+
+        reservePath(ids);
+        totalCost += static_cast<double>(ids.size() - 1);
+
+        paths[i].reserve(ids.size());
+        for (int id : ids)
+            paths[i].push_back(grid.toIndex(id));
+
+        ++numPlanned;
+    }
+
+    return numPlanned;
+}
+
+
+bool MultiAgentPlanner::planAgent(int startId, int goalId, int limit,
+                                  std::vector<int>& ids) {
+    std::priority_queue<OpenEntry> openSet;
+
+    ids.clear();
+
+    // goal is held by a parked agent, or start is taken at time 0
+    if ((parkedFrom[goalId] != std::numeric_limits<int>::max()) ||
+        !isFree(startId, 0))
+        return false;
+
+    computeDistance(goalId, false, distance);
+    computeDistance(goalId, true, parkedDistance);
+
+    if ((distance[startId] < 0) || (distance[startId] > limit))
+        return false;
+
+    // agent may stop at goal only after every reservation of it
+    int earliest = lastReserved[goalId] + 1;
+
+    states.clear();
+    closedSet.clear();
+
+    auto push = [&](int id, int time, int parent) {
+        int estimate = std::max(time + distance[id], earliest);
+
+        // after the last reservation only parked agents are in the way
+        if (time >= lastTime) {
+            if ((parkedDistance[id] < 0) ||
+                (time + parkedDistance[id] > limit))
+                return;
+            estimate = time + parkedDistance[id];
+        }
+
+        states.push_back({id, time, parent});
+        openSet.push({estimate, time, static_cast<int>(states.size()) - 1});
+    };
+
+    closedSet.insert(getKey(startId, 0));
+    push(startId, 0, -1);
+
+    while (!openSet.empty()) {
+        OpenEntry top = openSet.top();
+        State current = states[top.state];
+
+        openSet.pop();
+        ++numExpanded;
+
+        if (((current.id == goalId) && (current.time >= earliest)) ||
+            (current.time >= lastTime)) {
+            for (int s = top.state; s >= 0; s = states[s].parent)
+                ids.push_back(states[s].id);
+
+            std::reverse(ids.begin(), ids.end());
+
+            // walk down the distance avoiding parked agents
+            for (int id = current.id; id != goalId; ) {
+                for (int k = 0; k < 4; ++k) {
+                    int next = id + grid.getOffset(k);
+
+                    if (parkedDistance[next] == parkedDistance[id] - 1) {
+                        id = next;
+                        break;
+                    }
+                }
+
+                ids.push_back(id);
+            }
+
+            return true;
+        }
+
+        int time = current.time + 1;
+
+        // wait in place, then move in each direction
+        for (int k = -1; k < 4; ++k) {
+            int next = (k < 0) ? current.id : current.id + grid.getOffset(k);
+
+            if (grid.isBlocked(next) || (distance[next] < 0) ||
+                (time + distance[next] > limit) || !isFree(next, time))
+                continue;
+
+            // swapping cells with an agent moving the opposite way
+            if ((k >= 0) &&
+                edgeTable.contains(getKey(next, current.time) * 4 + 3 - k))
+                continue;
+
+            if (closedSet.insert(getKey(next, time)))
+                push(next, time, top.state);
+        }
+    }
+
+    return false;
+}
+
+
+void MultiAgentPlanner::reservePath(const std::vector<int>& ids) {
+    int last = static_cast<int>(ids.size()) - 1;
+
+    for (int t = 0; t <= last; ++t) {
+        vertexTable.insert(getKey(ids[t], t));
+        lastReserved[ids[t]] = std::max(lastReserved[ids[t]], t);
+
+        if ((t == last) || (ids[t + 1] == ids[t]))
+            continue;
+
+        for (int k = 0; k < 4; ++k) {
+            if (ids[t] + grid.getOffset(k) == ids[t + 1]) {
+                edgeTable.insert(getKey(ids[t], t) * 4 + k);
+                break;
+            }
+        }
+    }
+
+    parkedFrom[ids[last]] = last;
+    lastTime = std::max(lastTime, last);
+}
+
+
+void MultiAgentPlanner::computeDistance(int goalId, bool avoidParked,
+                                        std::vector<int>& steps) {
+    const int free = std::numeric_limits<int>::max();
+
+    steps.assign(grid.getNumNodes(), -1);
+    steps[goalId] = 0;
+    queue.clear();
+    queue.push_back(goalId);
+
+    // moves are symmetric on the 4-connected grid
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int id = queue[head];
+
+        for (int k = 0; k < 4; ++k) {
+            int next = id + grid.getOffset(k);
+
+            if (grid.isBlocked(next) || (steps[next] >= 0) ||
+                (avoidParked && (parkedFrom[next] != free)))
+                continue;
+
+            steps[next] = steps[id] + 1;
+            queue.push_back(next);
+        }
+    }
+}
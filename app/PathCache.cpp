@@ -0,0 +1,272 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file PathCache.cpp
+ *  @brief Implementation of class PathCache methods
+ *
+ *  This file implements methods in class PathCache.
+ *
+ *  Results are kept in a list in order of use and found through a
+ *  hash table of list positions, so lookup, insert and eviction are
+ *  O(1) plus copying the path.  Each entry also keeps the lowest and
+ *  highest index of its path, so invalidation scans only paths whose
+ *  index range holds a changed cell.
+ *
+ *  Memory counted for an entry is its path plus a fixed estimate of
+ *  list and hash table nodes.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <string.h>
+#include <algorithm>
+#include <functional>
+
+#include "PathCache.hpp"
+
+using std::vector;
+
+
+namespace {
+
+///< memory of list node, hash node and bucket of an entry, besides
+///< the entry itself
+const size_t entryOverhead = 6 * sizeof(void*);
+
+}  // namespace
+
+
+size_t PathCache::KeyHash::operator()(const Key &key) const {
+    uint64_t weightBits = 0;
+    memcpy(&weightBits, &key.weight, sizeof(weightBits));
+
+    uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(key.start))
+                  << 32) | static_cast<uint32_t>(key.goal);
+    h ^= weightBits + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+
+    return std::hash<uint64_t>()(h);
+}
+
+
+PathCache::PathCache(size_t bytes) : maxBytes(bytes), usedBytes(0),
+                                     version(0), numHits(0), numMisses(0),
+                                     numEvictions(0), numInvalidated(0) {}
+
+
+bool PathCache::find(const PathQuery &query, uint64_t mapVersion,
+                     PathResult &result) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = lookup.find(Key {query.start, query.goal, query.weight});
+    if ((mapVersion != version) || (it == lookup.end())) {
+        ++numMisses;
+        return false;
+    }
+
+    ++numHits;
+
+    // move to most recently used end
+    entries.splice(entries.begin(), entries, it->second);
+
+    const PathResult &cached = it->second->result;
+    result.found = cached.found;
+    result.totalCost = cached.totalCost;
+    result.numExpanded = cached.numExpanded;
+    result.path.assign(cached.path.begin(), cached.path.end());
+
+    return true;
+}
+
+
+void PathCache::insert(const PathQuery &query, uint64_t mapVersion,
+                       const PathResult &result) {
+    size_t bytes = sizeof(Entry) + entryOverhead +
+                   result.path.size() * sizeof(int);
+    Key key {query.start, query.goal, query.weight};
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if ((mapVersion != version) || (bytes > maxBytes))
+        return;
+
+    // another thread may have added the same query meanwhile
+    auto it = lookup.find(key);
+    if (it != lookup.end())
+        erase(it->second);
+
+    while (usedBytes + bytes > maxBytes) {
+        erase(std::prev(entries.end()));
+        ++numEvictions;
+    }
+
+    entries.push_front(Entry {key, result, 0, 0, bytes});
+
+    Entry &entry = entries.front();
+    if (!result.path.empty()) {
+        auto range = std::minmax_element(result.path.begin(),
+                                         result.path.end());
+        entry.minIndex = *range.first;
+        entry.maxIndex = *range.second;
+    }
+
+    lookup[key] = entries.begin();
+    usedBytes += bytes;
+}
+
+
+void PathCache::follow(uint64_t mapVersion) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (mapVersion == version)
+        return;
+
+    version = mapVersion;
+    numInvalidated += entries.size();
+    entries.clear();
+    lookup.clear();
+    usedBytes = 0;
+}
+
+
+void PathCache::invalidate(const vector<int> &indices, bool costLowered,
+                           uint64_t oldVersion, uint64_t newVersion) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // change already reported by another search sharing the cache
+    if (newVersion == version)
+        return;
+
+    // results may come from another map, or miss an earlier change
+    if (oldVersion != version)
+        costLowered = true;
+
+    version = newVersion;
+
+    if (costLowered) {
+        numInvalidated += entries.size();
+        entries.clear();
+        lookup.clear();
+        usedBytes = 0;
+        return;
+    }
+
+    vector<int> changed(indices);
+    std::sort(changed.begin(), changed.end());
+
+    for (auto it = entries.begin(); it != entries.end(); ) {
+        const Entry &entry = *it;
+
+        // changed cells within index range of path
+        auto first = std::lower_bound(changed.begin(), changed.end(),
+                                      entry.minIndex);
+        bool crosses = false;
+
+        if ((first != changed.end()) && (*first <= entry.maxIndex)) {
+            for (int n : entry.result.path) {
+                if (std::binary_search(first, changed.end(), n)) {
+                    crosses = true;
+                    break;
+                }
+            }
+        }
+
+        if (crosses) {
+            it = erase(it);
+            ++numInvalidated;
+        } else {
+            ++it;
+        }
+    }
+}
+
+
+void PathCache::clear(void) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    entries.clear();
+    lookup.clear();
+    usedBytes = 0;
+}
+
+
+uint64_t PathCache::getVersion(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return version;
+}
+
+
+size_t PathCache::getNumEntries(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+
+uint64_t PathCache::getNumHits(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numHits;
+}
+
+
+uint64_t PathCache::getNumMisses(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numMisses;
+}
+
+
+double PathCache::getHitRate(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    uint64_t numLookups = numHits + numMisses;
+    if (numLookups == 0)
+        return 0;
+
+    return static_cast<double>(numHits) / numLookups;
+}
+
+
+uint64_t PathCache::getNumEvictions(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numEvictions;
+}
+
+
+uint64_t PathCache::getNumInvalidated(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numInvalidated;
+}
+
+
+size_t PathCache::getMemoryUsage(void) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedBytes;
+}
+
+
+PathCache::EntryList::iterator PathCache::erase(EntryList::iterator it) {
+    usedBytes -= it->bytes;
+    lookup.erase(it->key);
+    return entries.erase(it);
+}
@@ -29,9 +29,9 @@
  *  This file implements methods in base class of PathFindAlgorithm.
  *
  *  PathFindAlgorithm is the base class for path finding algorithm.
- *  It supports building map/graph into nodes, edges for computing
- *  shortest path, reconstructing path from goal to start, and
- *  displaying map with or without shortest path on screen.
+ *  It supports building map into a compressed sparse row graph for
+ *  computing shortest path, and displaying map with or without
+ *  shortest path on screen.
  *
  *  @author Huei Tzu Tsai
  *  @date   03/07/2017
@@ -39,9 +39,7 @@
 
 #include <iostream>
 #include <fstream>
-#include <list>
 #include <limits>
-#include <memory>
 #include "PathFindAlgorithm.hpp"
 #include "Map.hpp"
 
@@ -49,51 +47,35 @@
 using std::cout;
 using std::endl;
 using std::string;
-using std::list;
 using std::vector;
 using std::ofstream;
 
-using std::shared_ptr;
-using std::make_shared;
 
 
 bool PathFindingAlgorithm::init(string input) {
     if (map.createMap(input)) {
-        nodes.clear();
-        edges.clear();
         path.clear();
 
         totalCost = 0;
 
-        buildGraph();
-        return true;
+        return buildGraph();
     }
 
     return false;
 }
 
 
-void PathFindingAlgorithm::buildGraph(void) {
-    vector<int>* mapArray = nullptr;
-
+bool PathFindingAlgorithm::buildGraph(void) {
     int* dir = nullptr;
     int i = 0;
     int j = 0;
     int k = 0;
-    int index = 1;
 
     // cout << endl << "PathFindingAlgorithm::BuildGraph" << endl;
 
-    mapArray = map.getMap();
-    if (mapArray == nullptr)
-        return;
-
     dir = map.getMoveDir();
     if (dir == nullptr)
-        return;
-
-    // cout << "Generating nodes" << endl;
-
+        return false;
 
     int n = map.getRow();
     int m = map.getCol();
@@ -102,17 +84,8 @@ void PathFindingAlgorithm::buildGraph(void) {
     // cout << "map row " << n << endl;
     // cout << "map column " << m << endl;
 
-    // generate nodes
-    for (i = 0, index = 1; i < n; ++i) {  // row, y
-        for (j = 0; j < m; ++j) {  // column, x
-            // create a node and add to node vector
-
-            // cout << index << " (" << i << ", " << j << ")" << endl;
-
-            nodes.emplace_back(make_shared<Node>(index, i, j));
-            ++index;
-        }
-    }
+    // nodes are implied by map size, node id = index - 1
+    graph.reset(n, m);
 
     // cout << endl << "Generating edges" << endl;
 
@@ -125,7 +98,13 @@ void PathFindingAlgorithm::buildGraph(void) {
             double cost = 0;
             double diagCost = 0;
 
-            for (k = 0; k < numDir; ++k) {
+            for (k = 0; k < 8; ++k) {
+                bool diagonal = (k == 0) || (k == 2) || (k == 5) || (k == 7);
+
+                // 4-connected maps only move straight
+                if (diagonal && (numDir == 4))
+                    continue;
+
                 int neighborX = j + *(dir+k*2);
                 int neighborY = i + *(dir+k*2+1);
 
@@ -139,63 +118,31 @@ void PathFindingAlgorithm::buildGraph(void) {
                     endIdx = neighborY * m + neighborX + 1;
 
                     // set cost for moving between nodes
-                    cost = (*mapArray)[endIdx-1];
+                    cost = map.getCost(endIdx);
 
                     // setting cost to 1.5x for diagonal movement
-                    if ((k == 0) || (k == 2) || (k == 5) || (k == 7))
+                    if (diagonal)
                        diagCost = 1.5;
                     else
                        diagCost = 1.0;
 
                     if (cost < std::numeric_limits<int>::max())
                         cost = cost * diagCost;
+                    else
+                        cost = Graph::infinity();
 
                     // cout << k << " (" << startIdx << "," << endIdx << ") "
                     //      << cost << endl;
 
-                    edges.emplace_back(make_shared<Edge>(startIdx,
-                                                         endIdx, cost));
+                    graph.addEdge(startIdx-1, endIdx-1, cost);
                 }
             }
         }
     }
 
-    return;
-}
-
-
-void PathFindingAlgorithm::reconstructPath(shared_ptr<Node> &node) {
-    list<shared_ptr<Node>> tempPath;
-    shared_ptr<Node> temp = node;
-
-    if (temp == nullptr)
-        return;
-
-    // reconstruct path using node's parent pointer
-    while (temp != nullptr) {
-        // add the start node and break
-        if (temp->getParentIndex() == 0) {
-            tempPath.emplace_front(temp);
-            break;
-        }
-
-        tempPath.emplace_front(temp);
-        temp = nodes[temp->getParentIndex()-1];
-    }
-
-
-    // cout << "Shortest Path: ";
-
-    // save into vector from start to goal
-    for (auto& n : tempPath) {
-        // cout << n->getIndex() << " ";
-        path.emplace_back(n->getIndex());
-    }
-
-    // cout << endl;
-
+    graph.finalize();
 
-    return;
+    return true;
 }
 
 
@@ -211,6 +158,14 @@ bool PathFindingAlgorithm::setParam(int s, int g) {
 }
 
 
+bool PathFindingAlgorithm::isPassable(int index) {
+    if ((index < 1) || (index > map.getRow() * map.getCol()))
+        return false;
+
+    return !map.isBlocked(index);
+}
+
+
 void PathFindingAlgorithm::outputPath(int option) {
     ofstream outputFs;
 
@@ -0,0 +1,266 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file SIPPAlgorithm.cpp
+ *  @brief Implementation of class SIPPAlgorithm methods
+ *
+ *  This file implements class SIPPAlgorithm methods.
+ *
+ *  Safe intervals of all nodes are kept in one array, node by node in
+ *  time order, so a (node, interval) state is a dense id and search
+ *  reuses SearchContext and an indexed heap.  Cost of a state is the
+ *  earliest time agent can be in the node within the interval.
+ *
+ *  From a state reached at time g, a move into interval [b, e) of a
+ *  neighbor with edge cost d leaves at t = max(g, b) and arrives at
+ *  t + d.  It needs t before the end of the current interval, since
+ *  agent waits there until t, and t + d before e, since agent holds
+ *  the target cell from t on.  Later intervals of the neighbor only
+ *  give later departures, so they are scanned until t reaches the end
+ *  of the current interval.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "SIPPAlgorithm.hpp"
+#include <math.h>
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+
+bool SIPPAlgorithm::buildGraph(void) {
+    if (!PathFindingAlgorithm::buildGraph())
+        return false;
+
+    unsafe.assign(graph.getNumNodes(), std::vector<TimeInterval>());
+    intervalsBuilt = false;
+
+    return true;
+}
+
+
+bool SIPPAlgorithm::setUnsafeIntervals(
+        int index, const std::vector<TimeInterval>& intervals) {
+    if ((index < 1) || (index > static_cast<int>(unsafe.size())))
+        return false;
+
+    // also rejects NaN
+    for (auto& interval : intervals) {
+        if (!(interval.begin < interval.end))
+            return false;
+    }
+
+    std::vector<TimeInterval>& merged = unsafe[index - 1];
+    std::vector<TimeInterval> sorted(intervals);
+
+    std::sort(sorted.begin(), sorted.end(),
+              [](const TimeInterval& a, const TimeInterval& b) {
+                  return a.begin < b.begin;
+              });
+
+    // join overlapping and touching intervals
+    merged.clear();
+    for (auto& interval : sorted) {
+        if (!merged.empty() && (interval.begin <= merged.back().end))
+            merged.back().end = std::max(merged.back().end, interval.end);
+        else
+            merged.push_back(interval);
+    }
+
+    intervalsBuilt = false;
+    return true;
+}
+
+
+void SIPPAlgorithm::clearUnsafeIntervals(void) {
+    for (auto& intervals : unsafe)
+        intervals.clear();
+
+    intervalsBuilt = false;
+}
+
+
+int SIPPAlgorithm::getNumStates(void) {
+    if (!intervalsBuilt)
+        buildIntervals();
+
+    return static_cast<int>(safe.size());
+}
+
+
+bool SIPPAlgorithm::computPath(double weight) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // initialize
+    path.clear();
+    timedPath.clear();
+    numExpanded = 0;
+
+    // start and goal cannot be less than index lower bound
+    if ((start < 1) || (goal < 1))
+        return false;
+
+    if (!intervalsBuilt)
+        buildIntervals();
+
+    int startId = start - 1;
+    int goalId = goal - 1;
+
+    // agent is at start at time 0
+    int startState = firstState[startId];
+    if (safe[startState].begin > 0)
+        return false;
+
+    context.reset(static_cast<int>(safe.size()));
+    BinaryHeap &openSet = context.getOpenSet();
+
+    context.visit(startState, 0, weight * getHeuristicCost(startId, goalId),
+                  -1);
+    openSet.push(startState, context.getEstimateCost(startState));
+
+    int goalState = -1;
+
+    while (!openSet.empty()) {
+        int cur = openSet.top();
+        int node = stateNode[cur];
+
+        // agent can stay at goal only in its last interval
+        if ((node == goalId) && (safe[cur].end == inf)) {
+            goalState = cur;
+            break;
+        }
+
+        openSet.pop();
+        context.close(cur);
+        ++numExpanded;
+
+        double arrival = context.getCost(cur);
+        double leaveBy = safe[cur].end;
+
+        graph.forEachNeighbor(node, [&](int n, double edgeCost) {
+            for (int s = firstState[n]; s < firstState[n + 1]; ++s) {
+                double depart = std::max(arrival, safe[s].begin);
+
+                if (depart >= leaveBy)
+                    break;
+
+                double tempCost = depart + edgeCost;
+
+                if ((tempCost >= safe[s].end) || context.isClosed(s))
+                    continue;
+
+                bool inOpenSet = context.isVisited(s);
+                if (inOpenSet && tempCost >= context.getCost(s))
+                    continue;
+
+                double estimate = tempCost +
+                                  weight * getHeuristicCost(n, goalId);
+                context.visit(s, tempCost, estimate, cur);
+
+                if (inOpenSet)
+                    openSet.decreaseKey(s, estimate);
+                else
+                    openSet.push(s, estimate);
+            }
+        });
+    }
+
+    if (goalState < 0)
+        return false;
+
+    totalCost = context.getCost(goalState);
+
+    // rebuild departure times to add waits before moves
+    std::vector<int> states;
+    context.extractPath(goalState, states);
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        int index = stateNode[states[i]] + 1;
+        double arrival = context.getCost(states[i]);
+
+        if (i > 0) {
+            double depart = std::max(context.getCost(states[i - 1]),
+                                     safe[states[i]].begin);
+
+            if (depart > context.getCost(states[i - 1]))
+                timedPath.push_back({path.back(), depart});
+        }
+
+        path.push_back(index);
+        timedPath.push_back({index, arrival});
+    }
+
+    return true;
+}
+
+
+void SIPPAlgorithm::buildIntervals(void) {
+    const double inf = std::numeric_limits<double>::infinity();
+    int n = graph.getNumNodes();
+
+    safe.clear();
+    stateNode.clear();
+    firstState.resize(n + 1);
+
+    for (int id = 0; id < n; ++id) {
+        double begin = 0;
+
+        firstState[id] = static_cast<int>(safe.size());
+
+        for (auto& interval : unsafe[id]) {
+            if (interval.begin > begin) {
+                safe.push_back({begin, interval.begin});
+                stateNode.push_back(id);
+            }
+
+            begin = std::max(begin, interval.end);
+        }
+
+        // last interval may be empty if cell is unsafe forever
+        safe.push_back({begin, inf});
+        stateNode.push_back(id);
+    }
+
+    firstState[n] = static_cast<int>(safe.size());
+    intervalsBuilt = true;
+}
+
+
+double SIPPAlgorithm::getHeuristicCost(int startId, int endId) const {
+    double startX = 0;
+    double startY = 0;
+    double endX = 0;
+    double endY = 0;
+
+    std::tie(startX, startY) = graph.getPos(startId);
+    std::tie(endX, endY) = graph.getPos(endId);
+
+    double xdiff = startX - endX;
+    double ydiff = startY - endY;
+
+    return sqrt((xdiff*xdiff) + (ydiff*ydiff));
+}
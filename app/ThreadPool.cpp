@@ -0,0 +1,107 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file ThreadPool.cpp
+ *  @brief Implementation of class ThreadPool methods
+ *
+ *  This file implements methods in class ThreadPool.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "ThreadPool.hpp"
+
+
+ThreadPool::ThreadPool(int numThreads) : task(nullptr), count(0), next(0),
+                                         numBusy(0), loopId(0),
+                                         stopping(false) {
+    if (numThreads <= 0)
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+
+    if (numThreads <= 0)
+        numThreads = 1;
+
+    for (int i = 0; i < numThreads; ++i)
+        threads.emplace_back(&ThreadPool::work, this, i);
+}
+
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    startLoop.notify_all();
+
+    for (auto& t : threads)
+        t.join();
+}
+
+
+void ThreadPool::parallelFor(int n, const std::function<void(int, int)> &f) {
+    if (n <= 0)
+        return;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    task = &f;
+    count = n;
+    next = 0;
+    numBusy = getNumThreads();
+    ++loopId;
+
+    startLoop.notify_all();
+    loopDone.wait(lock, [this] { return numBusy == 0; });
+
+    task = nullptr;
+}
+
+
+void ThreadPool::work(int worker) {
+    uint64_t lastLoop = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            startLoop.wait(lock, [this, lastLoop] {
+                return stopping || (loopId != lastLoop);
+            });
+
+            if (stopping)
+                return;
+
+            lastLoop = loopId;
+        }
+
+        for (int i = next++; i < count; i = next++)
+            (*task)(worker, i);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--numBusy == 0)
+            loopDone.notify_one();
+    }
+}
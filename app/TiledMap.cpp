@@ -0,0 +1,312 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file TiledMap.cpp
+ *  @brief Implementation of class TiledMap methods
+ *
+ *  This file implements methods in class TiledMap.
+ *
+ *  The tiled map format is a 64 byte header (magic "PTIL", version,
+ *  rows, cols, connectivity, tile size, offset of tile data) followed
+ *  by the tiles in row major order, each tile being tileSize x tileSize
+ *  cost bytes in row major order.  Cells of tiles past the map edge
+ *  are 0.  Fields are in native byte order.
+ *
+ *  Only a fixed number of tiles, given by the memory budget, is kept
+ *  in memory.  Cached tiles form a doubly linked list in order of use
+ *  and a miss reads the tile into the slot at the least recently used
+ *  end.  Consecutive reads of the same tile skip the list update, so a
+ *  search expanding neighbors inside one tile pays for a compare only.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include "TiledMap.hpp"
+
+using std::string;
+using std::vector;
+using std::ifstream;
+using std::ofstream;
+using std::numeric_limits;
+
+
+namespace {
+
+///< first bytes of a tiled map file
+const char tiledFileMagic[4] = {'P', 'T', 'I', 'L'};
+
+///< version of tiled map format written
+const uint32_t tiledFileVersion = 1;
+
+///< smallest and largest number of cells on tile side
+const int minTileSize = 8;
+const int maxTileSize = 4096;
+
+
+/**
+ *  @brief Header at the start of a tiled map file
+*/
+struct TiledFileHeader {
+    char magic[4];                                ///< "PTIL"
+    uint32_t version;                             ///< format version
+    uint32_t rows;                                ///< number of rows
+    uint32_t cols;                                ///< number of cols
+    uint32_t connectivity;                        ///< 4 or 8
+    uint32_t tileSize;                            ///< cells on tile side
+    uint64_t dataOffset;                          ///< offset of first tile
+    uint8_t reserved[32];                         ///< zero
+};
+
+static_assert(sizeof(TiledFileHeader) == 64, "tiled file header is 64 bytes");
+
+
+/**
+ *   @brief  Get log2 of tile size
+ *
+ *   @param  number of cells on tile side in int
+ *   @return log2 of tile size, -1 if it is not a power of 2 within
+ *           [minTileSize, maxTileSize]
+*/
+int tileSizeShift(int tileSize) {
+    if ((tileSize < minTileSize) || (tileSize > maxTileSize) ||
+        ((tileSize & (tileSize - 1)) != 0))
+        return -1;
+
+    int shift = 0;
+    while ((1 << shift) < tileSize)
+        ++shift;
+
+    return shift;
+}
+
+}  // namespace
+
+
+bool TiledMap::create(Map &map, string outputFile, int tileSize) {
+    int rows = map.getRow();
+    int cols = map.getCol();
+    int shift = tileSizeShift(tileSize);
+
+    if ((rows * cols == 0) || (shift < 0))
+        return false;
+
+    int mask = tileSize - 1;
+    int numTileRows = (rows + mask) / tileSize;
+    int numTileCols = (cols + mask) / tileSize;
+    size_t bytes = static_cast<size_t>(tileSize) * tileSize;
+
+    TiledFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, tiledFileMagic, sizeof(header.magic));
+    header.version = tiledFileVersion;
+    header.rows = static_cast<uint32_t>(rows);
+    header.cols = static_cast<uint32_t>(cols);
+    header.connectivity = static_cast<uint32_t>(map.getNumDir());
+    header.tileSize = static_cast<uint32_t>(tileSize);
+    header.dataOffset = sizeof(header);
+
+    ofstream outputFs(outputFile, std::ios::binary);
+    if (!outputFs.is_open())
+        return false;
+
+    outputFs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // one row of tiles at a time, so the map is never copied whole
+    vector<uint8_t> tileRow(numTileCols * bytes);
+
+    for (int tr = 0; tr < numTileRows; ++tr) {
+        std::fill(tileRow.begin(), tileRow.end(), 0);
+
+        int lastRow = std::min(rows, (tr + 1) * tileSize);
+        for (int r = tr * tileSize; r < lastRow; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                int cost = map.getCost(r * cols + c + 1);
+                if (cost == numeric_limits<int>::max())
+                    continue;
+
+                tileRow[(c >> shift) * bytes + ((r & mask) << shift) +
+                        (c & mask)] = static_cast<uint8_t>(cost);
+            }
+        }
+
+        outputFs.write(reinterpret_cast<const char*>(tileRow.data()),
+                       tileRow.size());
+    }
+
+    return static_cast<bool>(outputFs);
+}
+
+
+bool TiledMap::open(string inputFile, size_t memoryBudget) {
+    row = 0;
+    col = 0;
+    numSlots = 0;
+    head = -1;
+    tail = -1;
+    lastTile = -1;
+    lastData = nullptr;
+    numHits = 0;
+    numMisses = 0;
+    vector<uint8_t>().swap(slots);
+
+    file.close();
+    file.clear();
+    file.open(inputFile, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+
+    uint64_t size = static_cast<uint64_t>(file.tellg());
+
+    TiledFileHeader header;
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || (size < sizeof(header))) {
+        file.close();
+        return false;
+    }
+
+    uint64_t numCells = static_cast<uint64_t>(header.rows) * header.cols;
+    uint64_t maxCells = static_cast<uint64_t>(numeric_limits<int>::max());
+    int shift = tileSizeShift(static_cast<int>(
+                    std::min<uint32_t>(header.tileSize, maxTileSize + 1)));
+
+    bool valid = (memcmp(header.magic, tiledFileMagic, 4) == 0) &&
+                 (header.version == tiledFileVersion) &&
+                 (numCells > 0) &&
+                 (numCells <= maxCells) &&
+                 ((header.connectivity == 4) || (header.connectivity == 8)) &&
+                 (shift >= 0) &&
+                 (header.dataOffset >= sizeof(header));
+
+    uint64_t numTiles = 0;
+    uint64_t bytes = 0;
+    if (valid) {
+        uint64_t numTileRows = (header.rows + header.tileSize - 1) >> shift;
+        uint64_t numTileCols = (header.cols + header.tileSize - 1) >> shift;
+
+        numTiles = numTileRows * numTileCols;
+        bytes = static_cast<uint64_t>(header.tileSize) * header.tileSize;
+        // compared against what is left of the file, so a huge
+        // offset cannot wrap around
+        valid = (numTiles <= maxCells) &&
+                (header.dataOffset <= size) &&
+                (numTiles * bytes <= size - header.dataOffset);
+    }
+
+    if (!valid) {
+        file.close();
+        return false;
+    }
+
+    row = static_cast<int>(header.rows);
+    col = static_cast<int>(header.cols);
+    numDir = static_cast<int>(header.connectivity);
+    tileSize = static_cast<int>(header.tileSize);
+    tileShift = shift;
+    tilesPerRow = (col + tileSize - 1) / tileSize;
+    tileBytes = static_cast<size_t>(bytes);
+    dataOffset = header.dataOffset;
+
+    // at least one tile is cached, and never more than the map has
+    uint64_t fit = std::max<uint64_t>(1, memoryBudget / tileBytes);
+    numSlots = static_cast<int>(std::min(fit, numTiles));
+
+    vector<uint8_t>(static_cast<size_t>(numSlots) * tileBytes).swap(slots);
+    slotTile.assign(numSlots, -1);
+    tileSlot.assign(static_cast<size_t>(numTiles), -1);
+
+    // empty slots are used from the tail first
+    prev.resize(numSlots);
+    next.resize(numSlots);
+    for (int i = 0; i < numSlots; ++i) {
+        prev[i] = i - 1;
+        next[i] = (i + 1 < numSlots) ? i + 1 : -1;
+    }
+    head = 0;
+    tail = numSlots - 1;
+
+    return true;
+}
+
+
+const uint8_t* TiledMap::fetchTile(int tile) const {
+    int slot = tileSlot[tile];
+
+    if (slot >= 0) {
+        ++numHits;
+        touch(slot);
+        return &slots[slot * tileBytes];
+    }
+
+    ++numMisses;
+
+    // evict least recently used tile
+    slot = tail;
+    if (slotTile[slot] >= 0)
+        tileSlot[slotTile[slot]] = -1;
+
+    uint8_t *data = &slots[slot * tileBytes];
+
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(dataOffset +
+                                           static_cast<uint64_t>(tile) *
+                                           tileBytes));
+    file.read(reinterpret_cast<char*>(data), tileBytes);
+
+    // file was checked to hold every tile; a failed read blocks the tile
+    if (!file)
+        memset(data, 0, tileBytes);
+
+    slotTile[slot] = tile;
+    tileSlot[tile] = slot;
+    touch(slot);
+
+    return data;
+}
+
+
+void TiledMap::touch(int slot) const {
+    if (slot == head)
+        return;
+
+    // unlink slot
+    next[prev[slot]] = next[slot];
+    if (next[slot] >= 0)
+        prev[next[slot]] = prev[slot];
+    else
+        tail = prev[slot];
+
+    // link slot at head
+    prev[slot] = -1;
+    next[slot] = head;
+    prev[head] = slot;
+    head = slot;
+}
@@ -0,0 +1,406 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+
+/** @file Wavefront.cpp
+ *  @brief Implementation of class Wavefront methods
+ *
+ *  This file implements methods in class Wavefront.
+ *
+ *  Bit j of word w in a row is column 64 * w + j.  One hop moves the
+ *  frontier F to
+ *
+ *      4-connected: F(up) | F(down) | F | F << 1 | F >> 1
+ *      8-connected: V | V << 1 | V >> 1, V = F(up) | F | F(down)
+ *
+ *  masked by passable and not yet visited cells.  Bits shifted across
+ *  a word boundary come from the top or bottom bit of the neighboring
+ *  word, so rows are padded with a zero word on both sides and loads
+ *  at w - 1 and w + 1 need no bounds checks.  The AVX2 kernel does the
+ *  same on four words at a time with unaligned loads.
+ *
+ *  Only rows next to the last frontier are visited each hop, so a
+ *  flood costs about (rows touched) * (words per row) per hop.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include "Wavefront.hpp"
+#include <algorithm>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define WAVEFRONT_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+
+namespace {
+
+/**
+ *  @brief Bit rows passed to a kernel, each pointing at word 0 of row 0
+*/
+struct Planes {
+    const uint64_t *front;                        ///< last frontier
+    const uint64_t *passable;                     ///< passable cells
+    uint64_t *visited;                            ///< reached cells
+    uint64_t *next;                               ///< new frontier
+    int stride;                                   ///< words between rows
+    int numWords;                                 ///< words per row
+};
+
+
+/**
+ *   @brief  Advance frontier by one hop on rows [firstRow, lastRow]
+ *           one word at a time
+ *
+ *   @param  reference to bit rows
+ *   @param  first row in int
+ *   @param  last row in int
+ *   @param  true for 8 connectivity, false for 4
+ *   @param  reference to first row of new frontier, -1 if empty
+ *   @param  reference to last row of new frontier, -1 if empty
+ *   @return none
+*/
+void stepScalar(const Planes &p, int firstRow, int lastRow, bool diagonal,
+                int &newFirst, int &newLast) {
+    for (int r = firstRow; r <= lastRow; ++r) {
+        const uint64_t *mid = p.front + static_cast<ptrdiff_t>(r) * p.stride;
+        const uint64_t *up = mid - p.stride;
+        const uint64_t *down = mid + p.stride;
+        const uint64_t *pass = p.passable + (mid - p.front);
+        uint64_t *vis = p.visited + (mid - p.front);
+        uint64_t *out = p.next + (mid - p.front);
+        uint64_t any = 0;
+
+        for (int w = 0; w < p.numWords; ++w) {
+            uint64_t n;
+
+            if (diagonal) {
+                uint64_t v = up[w] | mid[w] | down[w];
+                uint64_t left = up[w - 1] | mid[w - 1] | down[w - 1];
+                uint64_t right = up[w + 1] | mid[w + 1] | down[w + 1];
+                n = v | (v << 1) | (left >> 63) | (v >> 1) | (right << 63);
+            } else {
+                uint64_t m = mid[w];
+                n = up[w] | down[w] | m | (m << 1) | (mid[w - 1] >> 63) |
+                    (m >> 1) | (mid[w + 1] << 63);
+            }
+
+            n &= pass[w] & ~vis[w];
+            out[w] = n;
+            vis[w] |= n;
+            any |= n;
+        }
+
+        if (any != 0) {
+            if (newFirst < 0)
+                newFirst = r;
+            newLast = r;
+        }
+    }
+}
+
+
+#ifdef WAVEFRONT_HAS_AVX2
+
+/**
+ *   @brief  Shift each 64 bit lane and carry bits in from neighboring
+ *           words, i.e. x << 1 | lower >> 63 | x >> 1 | upper << 63
+ *
+ *   @param  words
+ *   @param  words loaded one word lower
+ *   @param  words loaded one word higher
+ *   @return shifted words
+*/
+__attribute__((target("avx2")))
+inline __m256i spread(__m256i x, __m256i lower, __m256i upper) {
+    __m256i toHigher = _mm256_or_si256(_mm256_slli_epi64(x, 1),
+                                       _mm256_srli_epi64(lower, 63));
+    __m256i toLower = _mm256_or_si256(_mm256_srli_epi64(x, 1),
+                                      _mm256_slli_epi64(upper, 63));
+    return _mm256_or_si256(x, _mm256_or_si256(toHigher, toLower));
+}
+
+
+/**
+ *   @brief  Load four words
+ *
+ *   @param  pointer to first word
+ *   @return words
+*/
+__attribute__((target("avx2")))
+inline __m256i load(const uint64_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+
+/**
+ *   @brief  Advance frontier by one hop on rows [firstRow, lastRow]
+ *           four words at a time
+ *
+ *   @param  reference to bit rows
+ *   @param  first row in int
+ *   @param  last row in int
+ *   @param  true for 8 connectivity, false for 4
+ *   @param  reference to first row of new frontier, -1 if empty
+ *   @param  reference to last row of new frontier, -1 if empty
+ *   @return none
+*/
+__attribute__((target("avx2")))
+void stepAvx2(const Planes &p, int firstRow, int lastRow, bool diagonal,
+              int &newFirst, int &newLast) {
+    for (int r = firstRow; r <= lastRow; ++r) {
+        const uint64_t *mid = p.front + static_cast<ptrdiff_t>(r) * p.stride;
+        const uint64_t *up = mid - p.stride;
+        const uint64_t *down = mid + p.stride;
+        const uint64_t *pass = p.passable + (mid - p.front);
+        uint64_t *vis = p.visited + (mid - p.front);
+        uint64_t *out = p.next + (mid - p.front);
+        __m256i any = _mm256_setzero_si256();
+
+        for (int w = 0; w < p.numWords; w += 4) {
+            __m256i n;
+
+            if (diagonal) {
+                __m256i v = _mm256_or_si256(
+                    _mm256_or_si256(load(up + w), load(mid + w)),
+                    load(down + w));
+                __m256i left = _mm256_or_si256(
+                    _mm256_or_si256(load(up + w - 1), load(mid + w - 1)),
+                    load(down + w - 1));
+                __m256i right = _mm256_or_si256(
+                    _mm256_or_si256(load(up + w + 1), load(mid + w + 1)),
+                    load(down + w + 1));
+                n = spread(v, left, right);
+            } else {
+                n = _mm256_or_si256(
+                    _mm256_or_si256(load(up + w), load(down + w)),
+                    spread(load(mid + w), load(mid + w - 1),
+                           load(mid + w + 1)));
+            }
+
+            __m256i seen = load(vis + w);
+            n = _mm256_andnot_si256(seen,
+                                    _mm256_and_si256(n, load(pass + w)));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + w), n);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(vis + w),
+                                _mm256_or_si256(seen, n));
+            any = _mm256_or_si256(any, n);
+        }
+
+        if (!_mm256_testz_si256(any, any)) {
+            if (newFirst < 0)
+                newFirst = r;
+            newLast = r;
+        }
+    }
+}
+
+#endif  // WAVEFRONT_HAS_AVX2
+
+
+/**
+ *   @brief  Count set bits of a word
+ *
+ *   @param  word
+ *   @return number of set bits in int
+*/
+inline int countBits(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int n = 0;
+    for (; x != 0; x &= x - 1)
+        ++n;
+    return n;
+#endif
+}
+
+
+/**
+ *   @brief  Get position of lowest set bit of a non-zero word
+ *
+ *   @param  word
+ *   @return bit position in int
+*/
+inline int lowestBit(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    for (; (x & 1) == 0; x >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+}  // namespace
+
+
+bool Wavefront::hasAvx2(void) {
+#ifdef WAVEFRONT_HAS_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+
+bool Wavefront::build(Map &map) {
+    numRows = map.getRow();
+    numCols = map.getCol();
+
+    if ((numRows <= 0) || (numCols <= 0))
+        return false;
+
+    // whole AVX2 registers per row, plus a zero word on both sides
+    numWords = ((numCols + 63) / 64 + 3) / 4 * 4;
+    stride = numWords + 2;
+
+    size_t size = static_cast<size_t>(numRows + 2) * stride;
+    passable.assign(size, 0);
+    visited.assign(size, 0);
+    front.assign(size, 0);
+    next.assign(size, 0);
+
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numCols; ++j) {
+            if (!map.isBlocked(i * numCols + j + 1))
+                passable[rowOffset(i) + j / 64] |= uint64_t(1) << (j % 64);
+        }
+    }
+
+    return true;
+}
+
+
+bool Wavefront::computeHops(const std::vector<int> &starts, int connectivity,
+                            std::vector<int> &hops) {
+    return flood(starts, connectivity, &hops);
+}
+
+
+bool Wavefront::computeReachable(const std::vector<int> &starts,
+                                 int connectivity) {
+    return flood(starts, connectivity, nullptr);
+}
+
+
+bool Wavefront::flood(const std::vector<int> &starts, int connectivity,
+                      std::vector<int> *hops) {
+    numSteps = 0;
+    numReached = 0;
+
+    if (((connectivity != 4) && (connectivity != 8)) || (numRows == 0))
+        return false;
+
+    usedKernel = ((kernel != SCALAR) && hasAvx2()) ? AVX2 : SCALAR;
+
+    std::fill(visited.begin(), visited.end(), 0);
+    std::fill(front.begin(), front.end(), 0);
+    std::fill(next.begin(), next.end(), 0);
+
+    if (hops)
+        hops->assign(static_cast<size_t>(numRows) * numCols, -1);
+
+    int first = numRows;
+    int last = -1;
+
+    for (int s : starts) {
+        if ((s < 1) || (s > numRows * numCols))
+            return false;
+
+        int i = (s - 1) / numCols;
+        int j = (s - 1) % numCols;
+        size_t w = rowOffset(i) + j / 64;
+        uint64_t bit = uint64_t(1) << (j % 64);
+
+        if ((passable[w] & bit) == 0)
+            return false;
+
+        front[w] |= bit;
+        visited[w] |= bit;
+        first = std::min(first, i);
+        last = std::max(last, i);
+
+        if (hops)
+            (*hops)[s - 1] = 0;
+    }
+
+    while (last >= 0) {
+        Planes p = {&front[rowOffset(0)], &passable[rowOffset(0)],
+                    &visited[rowOffset(0)], &next[rowOffset(0)],
+                    stride, numWords};
+        int newFirst = -1;
+        int newLast = -1;
+        int lo = std::max(first - 1, 0);
+        int hi = std::min(last + 1, numRows - 1);
+
+#ifdef WAVEFRONT_HAS_AVX2
+        if (usedKernel == AVX2)
+            stepAvx2(p, lo, hi, connectivity == 8, newFirst, newLast);
+        else
+#endif
+            stepScalar(p, lo, hi, connectivity == 8, newFirst, newLast);
+
+        // rows outside [lo, hi] of next are zero, clear old frontier so
+        // the same holds after swapping
+        std::fill(front.begin() + rowOffset(first),
+                  front.begin() + rowOffset(last) + numWords, 0);
+        front.swap(next);
+
+        if (newLast < 0)
+            break;
+
+        ++numSteps;
+        first = newFirst;
+        last = newLast;
+
+        if (!hops)
+            continue;
+
+        for (int r = first; r <= last; ++r) {
+            const uint64_t *row = &front[rowOffset(r)];
+            int *rowHops = &(*hops)[static_cast<size_t>(r) * numCols];
+
+            for (int w = 0; w < numWords; ++w) {
+                for (uint64_t bits = row[w]; bits != 0; bits &= bits - 1)
+                    rowHops[w * 64 + lowestBit(bits)] = numSteps;
+            }
+        }
+    }
+
+    for (auto word : visited)
+        numReached += countBits(word);
+
+    return true;
+}
+
+
+size_t Wavefront::getMemoryUsage(void) const {
+    return (passable.capacity() + visited.capacity() + front.capacity() +
+            next.capacity()) * sizeof(uint64_t);
+}
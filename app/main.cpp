@@ -120,8 +120,7 @@ int main(void) {
 
     cout << "Dijkstra's search time is " << elapsed_secs << " seconds" << endl;
 
-    // Init again to clear variables
-    aStar.PathFindingAlgorithm::init(mapFile);
+    // Search state is reset by computPath, no need to init map again
     path.clear();
 
     // Compute using A star
@@ -0,0 +1,151 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ALTBench.cpp
+ *  @brief Benchmark of A star with landmark heuristics
+ *
+ *  This program builds landmark tables of an aisle map and prints
+ *  preprocessing time, table size, and average query latency and
+ *  expanded nodes compared with A star on the same random queries.
+ *
+ *  Usage: alt-bench [rows] [cols] [queries] [landmarks]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "ALTAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries, landmarks
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 256;
+    int cols = (argc > 2) ? atoi(argv[2]) : 256;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 200;
+    int numLandmarks = (argc > 4) ? atoi(argv[4]) : 8;
+    const char *mapFile = "alt_bench.csv";
+    const char *tableFile = "alt_bench.bin";
+    AStarAlgorithm aStar;
+
+    remove(tableFile);
+
+    if (!writeAisleMap(mapFile, rows, cols, 3, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    cout << "aisle map " << rows << "x" << cols << ", " << numLandmarks
+         << " landmarks" << endl;
+
+    for (auto strategy : {Landmarks::FARTHEST, Landmarks::AVOID}) {
+        ALTAlgorithm alt(numLandmarks, strategy);
+
+        alt.setTableFile(tableFile);
+        alt.PathFindingAlgorithm::init(mapFile);
+
+        const Landmarks &landmarks = alt.getLandmarks();
+        cout << ((strategy == Landmarks::AVOID) ? "avoid" : "farthest")
+             << ": preprocess " << landmarks.getPreprocessTime() << " s, "
+             << landmarks.getMemoryUsage() / 1024 << " KiB" << endl;
+
+        // second init reads tables back from file
+        auto begin = std::chrono::steady_clock::now();
+        alt.PathFindingAlgorithm::init(mapFile);
+        cout << "  init with saved tables " << secondsSince(begin) << " s"
+             << endl;
+        remove(tableFile);
+
+        std::mt19937 rng(2);
+        std::uniform_int_distribution<int> indexDist(1, rows * cols);
+        std::vector<int> starts;
+        std::vector<int> goals;
+
+        while (static_cast<int>(starts.size()) < numQueries) {
+            int s = indexDist(rng);
+            int g = indexDist(rng);
+
+            if (aStar.PathFindingAlgorithm::setParam(s, g)) {
+                starts.push_back(s);
+                goals.push_back(g);
+            }
+        }
+
+        double aStarTime = 0;
+        double altTime = 0;
+        double aStarExpanded = 0;
+        double altExpanded = 0;
+        int numMismatch = 0;
+
+        for (int i = 0; i < numQueries; ++i) {
+            aStar.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+            alt.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+            begin = std::chrono::steady_clock::now();
+            bool found = aStar.computPath(1.0);
+            aStarTime += secondsSince(begin);
+
+            begin = std::chrono::steady_clock::now();
+            if (found != alt.computPath(1.0))
+                ++numMismatch;
+            altTime += secondsSince(begin);
+
+            if (found && (aStar.getTotalCost() != alt.getTotalCost()))
+                ++numMismatch;
+
+            aStarExpanded += aStar.getNumExpanded();
+            altExpanded += alt.getNumExpanded();
+        }
+
+        cout << "  A star query " << aStarTime / numQueries * 1e6 << " us, "
+             << aStarExpanded / numQueries << " nodes expanded" << endl;
+        cout << "  ALT query " << altTime / numQueries * 1e6 << " us, "
+             << altExpanded / numQueries << " nodes expanded" << endl;
+        cout << "  " << numMismatch << " cost mismatches" << endl;
+
+        if (numMismatch > 0)
+            return -1;
+    }
+
+    remove(mapFile);
+
+    return 0;
+}
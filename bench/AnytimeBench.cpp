@@ -0,0 +1,171 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file AnytimeBench.cpp
+ *  @brief Benchmark of anytime A star search under a deadline
+ *
+ *  This program runs random queries on a random map with A star and
+ *  with computPathAnytime given a fixed time budget, and prints how
+ *  often the budget is met, the reported suboptimality bound, the
+ *  actual cost over the shortest, and the expansions of reaching the
+ *  shortest path with and without reusing earlier rounds.
+ *
+ *  Usage: anytime-bench [rows] [cols] [queries] [budgetMs] [weight]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "AStarAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries, time budget in
+ *           milliseconds, initial weight
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 1024;
+    int cols = (argc > 2) ? atoi(argv[2]) : 1024;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 20;
+    double budgetMs = (argc > 4) ? atof(argv[4]) : 10;
+    double weight = (argc > 5) ? atof(argv[5]) : 3;
+    const char *mapFile = "anytime_bench.csv";
+    AStarAlgorithm aStar;
+    AStarAlgorithm anytime;
+
+    if (!writeRandomMap(mapFile, rows, cols, 25, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile) ||
+        !anytime.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    auto budget = std::chrono::duration_cast<
+                      std::chrono::steady_clock::duration>(
+                      std::chrono::duration<double, std::milli>(budgetMs));
+    auto later = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    double optimalTime = 0;
+    double anytimeTime = 0;
+    double maxTime = 0;
+    double sumBound = 0;
+    double sumRatio = 0;
+    long restartExpanded = 0;
+    long reuseExpanded = 0;
+    int numMet = 0;
+    int numFound = 0;
+    int numViolations = 0;
+    int q = 0;
+
+    cout << "map " << rows << "x" << cols << ", budget " << budgetMs
+         << " ms, weight " << weight << endl;
+
+    while (q < numQueries) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (!aStar.PathFindingAlgorithm::setParam(s, g))
+            continue;
+
+        auto begin = std::chrono::steady_clock::now();
+        bool found = aStar.computPath(1.0);
+        double time = secondsSince(begin);
+
+        if (!found)
+            continue;
+
+        ++q;
+        optimalTime += time;
+        double shortest = aStar.getTotalCost();
+        anytime.PathFindingAlgorithm::setParam(s, g);
+
+        begin = std::chrono::steady_clock::now();
+        found = anytime.computPathAnytime(weight, begin + budget);
+        time = secondsSince(begin);
+
+        anytimeTime += time;
+        maxTime = std::max(maxTime, time);
+        if (time * 1e3 <= budgetMs * 1.1)
+            ++numMet;
+
+        if (found) {
+            double ratio = anytime.getTotalCost() / shortest;
+
+            ++numFound;
+            sumBound += anytime.getSuboptimalityBound();
+            sumRatio += ratio;
+            if (ratio > anytime.getSuboptimalityBound() + 1e-9)
+                ++numViolations;
+        }
+
+        // expansions of going down to weight 1 with and without reuse
+        anytime.computPathAnytime(weight, later);
+        reuseExpanded += anytime.getNumExpanded();
+
+        for (double w = weight; w > 1; w -= 0.5) {
+            aStar.computPath(w);
+            restartExpanded += aStar.getNumExpanded();
+        }
+        aStar.computPath(1.0);
+        restartExpanded += aStar.getNumExpanded();
+    }
+
+    cout << "  A star:  " << optimalTime * 1e3 / numQueries
+         << " ms/query" << endl;
+    cout << "  anytime: " << anytimeTime * 1e3 / numQueries
+         << " ms/query, max " << maxTime * 1e3 << " ms, " << numMet
+         << " of " << numQueries << " within budget (+10%)" << endl;
+    cout << "  " << numFound << " paths by deadline, mean bound "
+         << (numFound ? sumBound / numFound : 0) << ", mean cost/shortest "
+         << (numFound ? sumRatio / numFound : 0) << endl;
+    cout << "  expansions to shortest: " << reuseExpanded / numQueries
+         << " reusing rounds, " << restartExpanded / numQueries
+         << " restarting per weight" << endl;
+
+    remove(mapFile);
+
+    if (numViolations > 0) {
+        cout << numViolations << " paths exceed their bound" << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file BatchBench.cpp
+ *  @brief Benchmark of parallel batch path queries
+ *
+ *  This program answers the same batch of random queries on a random
+ *  map with 1, 2, 4, ... worker threads up to the number of hardware
+ *  threads, and prints throughput and speedup over one thread.
+ *
+ *  Usage: batch-bench [rows] [cols] [queries]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 512;
+    int cols = (argc > 2) ? atoi(argv[2]) : 512;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 2000;
+    const char *mapFile = "batch_bench.csv";
+    AStarAlgorithm aStar;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<PathQuery> queries;
+    std::vector<PathResult> results;
+
+    for (int i = 0; i < numQueries; ++i)
+        queries.push_back({indexDist(rng), indexDist(rng), 1.0});
+
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    cout << "map " << rows << "x" << cols << ", " << numQueries
+         << " queries" << endl;
+    cout << "threads  queries/sec  speedup" << endl;
+
+    double baseRate = 0;
+    for (int t : threadCounts) {
+        // warm up threads and search contexts
+        aStar.computPaths(queries, results, t);
+
+        auto begin = std::chrono::steady_clock::now();
+        int numFound = aStar.computPaths(queries, results, t);
+        double rate = numQueries / secondsSince(begin);
+
+        if (t == 1)
+            baseRate = rate;
+
+        cout << t << "  " << rate << "  " << rate / baseRate
+             << "  (" << numFound << " found)" << endl;
+    }
+
+    remove(mapFile);
+
+    return 0;
+}
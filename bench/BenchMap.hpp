@@ -0,0 +1,199 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file BenchMap.hpp
+ *  @brief Helpers shared by benchmark programs
+ *
+ *  This file contains helpers to generate random and aisle maps and
+ *  time code in benchmark programs.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef BENCH_BENCHMAP_HPP_
+#define BENCH_BENCHMAP_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+/**
+ *   @brief  Write a random map csv file where each cell is an obstacle
+ *           with the given probability
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  percent of obstacle cells in int
+ *   @param  random seed in unsigned int
+ *   @return true if map is written, false otherwise
+*/
+inline bool writeRandomMap(const std::string &file, int rows, int cols,
+                           int obstaclePercent, unsigned int seed) {
+    std::ofstream out(file);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 99);
+
+    if (!out.is_open())
+        return false;
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            out << ((dist(rng) < obstaclePercent) ? "O" : "1");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+
+    return true;
+}
+
+
+/**
+ *   @brief  Write a map csv file with given obstacle cells
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  reference to obstacle flag of each cell, row by row
+ *   @return true if map is written, false otherwise
+*/
+inline bool writeMap(const std::string &file, int rows, int cols,
+                     const std::vector<bool> &blocked) {
+    std::ofstream out(file);
+
+    if (!out.is_open())
+        return false;
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            out << (blocked[i * cols + j] ? "O" : "1");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+
+    return true;
+}
+
+
+/**
+ *   @brief  Write a map csv file of horizontal walls every fourth row,
+ *           each with a few random gaps, like aisles between shelves
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  number of gaps per wall in int
+ *   @param  random seed in unsigned int
+ *   @return true if map is written, false otherwise
+*/
+inline bool writeAisleMap(const std::string &file, int rows, int cols,
+                          int numGaps, unsigned int seed) {
+    std::ofstream out(file);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> gapDist(0, cols - 1);
+
+    if (!out.is_open())
+        return false;
+
+    for (int i = 0; i < rows; ++i) {
+        std::vector<bool> open(cols, (i % 4) != 3);
+        for (int g = 0; g < numGaps; ++g)
+            open[gapDist(rng)] = true;
+
+        for (int j = 0; j < cols; ++j) {
+            out << (open[j] ? "1" : "O");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+
+    return true;
+}
+
+
+/**
+ *   @brief  Write a map csv file of open yard with rectangular
+ *           buildings of random size placed until the given part of
+ *           the map is covered
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  percent of obstacle cells in int
+ *   @param  random seed in unsigned int
+ *   @return true if map is written, false otherwise
+*/
+inline bool writeYardMap(const std::string &file, int rows, int cols,
+                         int obstaclePercent, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> sizeDist(4, 48);
+    std::uniform_int_distribution<int> rowDist(0, rows - 1);
+    std::uniform_int_distribution<int> colDist(0, cols - 1);
+    std::vector<bool> blocked(static_cast<size_t>(rows) * cols, false);
+    long long numBlocked = 0;
+    long long target = static_cast<long long>(rows) * cols *
+                       obstaclePercent / 100;
+
+    while (numBlocked < target) {
+        int top = rowDist(rng);
+        int left = colDist(rng);
+        int bottom = std::min(rows, top + sizeDist(rng));
+        int right = std::min(cols, left + sizeDist(rng));
+
+        for (int i = top; i < bottom; ++i) {
+            for (int j = left; j < right; ++j) {
+                if (!blocked[i * cols + j]) {
+                    blocked[i * cols + j] = true;
+                    ++numBlocked;
+                }
+            }
+        }
+    }
+
+    return writeMap(file, rows, cols, blocked);
+}
+
+
+/**
+ *   @brief  Get seconds elapsed since a time point
+ *
+ *   @param  start time point
+ *   @return elapsed seconds in double
+*/
+inline double secondsSince(std::chrono::steady_clock::time_point begin) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         begin).count();
+}
+
+#endif  // BENCH_BENCHMAP_HPP_
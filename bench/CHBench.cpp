@@ -0,0 +1,138 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file CHBench.cpp
+ *  @brief Benchmark of contraction hierarchy queries
+ *
+ *  This program contracts a random map and prints preprocessing time,
+ *  number of shortcuts, and average query latency compared with A
+ *  star on the same random queries.
+ *
+ *  Usage: ch-bench [rows] [cols] [queries]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "CHAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 256;
+    int cols = (argc > 2) ? atoi(argv[2]) : 256;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 1000;
+    const char *mapFile = "ch_bench.csv";
+    AStarAlgorithm aStar;
+    CHAlgorithm ch;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile) ||
+        !ch.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    const ContractionHierarchy &hierarchy = ch.getHierarchy();
+    cout << "map " << rows << "x" << cols << ", "
+         << ch.getGraph().getNumEdges() << " edges" << endl;
+    cout << "preprocess " << hierarchy.getPreprocessTime() << " s, "
+         << hierarchy.getNumShortcuts() << " shortcuts" << endl;
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> starts;
+    std::vector<int> goals;
+
+    while (static_cast<int>(starts.size()) < numQueries) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (aStar.PathFindingAlgorithm::setParam(s, g)) {
+            starts.push_back(s);
+            goals.push_back(g);
+        }
+    }
+
+    // run each engine over all queries in turn so neither evicts the
+    // other's data from cache
+    std::vector<double> aStarCosts(numQueries, -1);
+    std::vector<double> chCosts(numQueries, -1);
+    double expanded = 0;
+
+    double aStarTime = 0;
+    double chTime = 0;
+
+    for (int i = 0; i < numQueries; ++i) {
+        aStar.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+        auto begin = std::chrono::steady_clock::now();
+        if (aStar.computPath(1.0))
+            aStarCosts[i] = aStar.getTotalCost();
+        aStarTime += secondsSince(begin);
+    }
+
+    for (int i = 0; i < numQueries; ++i) {
+        ch.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+        auto begin = std::chrono::steady_clock::now();
+        if (ch.computPath(1.0))
+            chCosts[i] = ch.getTotalCost();
+        chTime += secondsSince(begin);
+
+        expanded += ch.getNumExpanded();
+    }
+
+    int numMismatch = 0;
+    for (int i = 0; i < numQueries; ++i) {
+        if (aStarCosts[i] != chCosts[i])
+            ++numMismatch;
+    }
+
+    cout << "A star query " << aStarTime / numQueries * 1e6 << " us" << endl;
+    cout << "CH query " << chTime / numQueries * 1e6 << " us, "
+         << expanded / numQueries << " nodes expanded" << endl;
+    cout << numMismatch << " cost mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
@@ -0,0 +1,159 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DStarLiteBench.cpp
+ *  @brief Benchmark of incremental replanning after map edits
+ *
+ *  This program plans across a random map, then repeatedly drops an
+ *  obstacle on the current path and moves the robot a few cells along
+ *  it.  It prints replanning latency and expanded nodes of D* Lite
+ *  compared with A star run from scratch on the edited map.  Reloading
+ *  the map for A star is not timed.
+ *
+ *  Usage: dstar-bench [rows] [cols] [edits]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "DStarLiteAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of edits
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 256;
+    int cols = (argc > 2) ? atoi(argv[2]) : 256;
+    int numEdits = (argc > 3) ? atoi(argv[3]) : 20;
+    const char *mapFile = "dstar_bench.csv";
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+    std::vector<bool> blocked(rows * cols);
+
+    for (int i = 0; i < rows * cols; ++i)
+        blocked[i] = cellDist(rng) < 20;
+
+    int start = 1;
+    int goal = rows * cols;
+    blocked[start - 1] = false;
+    blocked[goal - 1] = false;
+
+    DStarLiteAlgorithm dStar;
+
+    if (!writeMap(mapFile, rows, cols, blocked) ||
+        !dStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    dStar.PathFindingAlgorithm::setParam(start, goal);
+
+    auto begin = std::chrono::steady_clock::now();
+    if (!dStar.computPath(1.0)) {
+        cout << "No path on map" << endl;
+        return -1;
+    }
+
+    cout << "map " << rows << "x" << cols << ", first plan "
+         << secondsSince(begin) * 1e3 << " ms, " << dStar.getNumExpanded()
+         << " nodes expanded" << endl;
+
+    double dStarTime = 0;
+    double aStarTime = 0;
+    double dStarExpanded = 0;
+    double aStarExpanded = 0;
+    int numEdited = 0;
+    int numMismatch = 0;
+
+    for (int e = 0; e < numEdits; ++e) {
+        std::vector<int> path = dStar.getPath();
+        if (path.size() < 12)
+            break;
+
+        // robot moves a few cells, then a pallet appears ahead
+        std::uniform_int_distribution<int> aheadDist(6, path.size() - 2);
+        int pallet = path[aheadDist(rng)];
+
+        start = path[3];
+        blocked[pallet - 1] = true;
+
+        std::vector<CellChange> changes = {
+            {pallet, std::numeric_limits<int>::max()}};
+
+        begin = std::chrono::steady_clock::now();
+        dStar.updateCells(changes);
+        dStar.PathFindingAlgorithm::setParam(start, goal);
+        bool found = dStar.computPath(1.0);
+        dStarTime += secondsSince(begin);
+        dStarExpanded += dStar.getNumExpanded();
+
+        AStarAlgorithm aStar;
+        writeMap(mapFile, rows, cols, blocked);
+        aStar.PathFindingAlgorithm::init(mapFile);
+        aStar.PathFindingAlgorithm::setParam(start, goal);
+
+        begin = std::chrono::steady_clock::now();
+        if (found != aStar.computPath(1.0))
+            ++numMismatch;
+        aStarTime += secondsSince(begin);
+        aStarExpanded += aStar.getNumExpanded();
+
+        if (found && (aStar.getTotalCost() != dStar.getTotalCost()))
+            ++numMismatch;
+
+        ++numEdited;
+        if (!found)
+            break;
+    }
+
+    if (numEdited > 0) {
+        cout << numEdited << " edits" << endl;
+        cout << "A star replan " << aStarTime / numEdited * 1e3 << " ms, "
+             << aStarExpanded / numEdited << " nodes expanded" << endl;
+        cout << "D* Lite replan " << dStarTime / numEdited * 1e3 << " ms, "
+             << dStarExpanded / numEdited << " nodes expanded" << endl;
+    }
+    cout << numMismatch << " cost mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
@@ -0,0 +1,148 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DeltaSteppingBench.cpp
+ *  @brief Benchmark of parallel delta-stepping one-to-all search
+ *
+ *  This program computes costs from a few start nodes to the whole map
+ *  with a serial Dijkstra and with DeltaStepping over a range of
+ *  bucket widths and thread counts, and prints time per search.
+ *
+ *  Usage: delta-bench [rows] [cols] [starts]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "DeltaStepping.hpp"
+#include "GraphSearch.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of start nodes
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 1024;
+    int cols = (argc > 2) ? atoi(argv[2]) : 1024;
+    int numStarts = (argc > 3) ? atoi(argv[3]) : 4;
+    const char *mapFile = "delta_bench.csv";
+    AStarAlgorithm aStar;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    const Graph &graph = aStar.getGraph();
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> nodeDist(0, rows * cols - 1);
+    std::vector<int> starts;
+
+    while (static_cast<int>(starts.size()) < numStarts) {
+        int s = nodeDist(rng);
+        if (graph.beginEdge(s) != graph.endEdge(s))
+            starts.push_back(s);
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numStarts
+         << " starts, " << std::thread::hardware_concurrency()
+         << " hardware threads" << endl;
+
+    // serial Dijkstra as reference
+    SearchContext<BinaryHeap> context;
+    std::vector<std::vector<double>> expected(numStarts);
+    auto zero = [](int) { return 0.0; };
+    int numExpanded = 0;
+    double time = 0;
+
+    for (int i = 0; i < numStarts; ++i) {
+        auto begin = std::chrono::steady_clock::now();
+        aStarSearch(graph, context, starts[i], -1, 0, zero, numExpanded);
+        time += secondsSince(begin);
+
+        expected[i].resize(graph.getNumNodes());
+        for (int v = 0; v < graph.getNumNodes(); ++v)
+            expected[i][v] = context.getCost(v);
+    }
+
+    cout << "  Dijkstra: " << time / numStarts * 1e3 << " ms/search"
+         << endl;
+
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(std::max(maxThreads, 1));
+
+    int numMismatch = 0;
+    std::vector<double> costs;
+
+    for (int numThreads : threadCounts) {
+        DeltaStepping delta(numThreads);
+
+        for (double width : {1.5, 3.0, 6.0, 12.0}) {
+            delta.setDelta(width);
+            time = 0;
+
+            for (int i = 0; i < numStarts; ++i) {
+                auto begin = std::chrono::steady_clock::now();
+                delta.compute(graph, starts[i], costs);
+                time += secondsSince(begin);
+
+                if (costs != expected[i])
+                    ++numMismatch;
+            }
+
+            cout << "  delta-stepping, " << numThreads << " threads, delta "
+                 << width << ": " << time / numStarts * 1e3 << " ms/search, "
+                 << delta.getNumBuckets() << " buckets" << endl;
+        }
+    }
+
+    cout << numMismatch << " cost mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
@@ -0,0 +1,155 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DistanceMatrixBench.cpp
+ *  @brief Benchmark of many-to-many cost matrices
+ *
+ *  This program picks robot and pick locations on a random map, some
+ *  of them shared, and prints the time of filling the robots x picks
+ *  cost matrix with one A star query per pair against computing it
+ *  with computCostMatrix on 1 and all hardware threads.
+ *
+ *  Usage: matrix-bench [rows] [cols] [robots] [picks]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of robots, number of picks
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 512;
+    int cols = (argc > 2) ? atoi(argv[2]) : 512;
+    int numRobots = (argc > 3) ? atoi(argv[3]) : 20;
+    int numPicks = (argc > 4) ? atoi(argv[4]) : 50;
+    const char *mapFile = "matrix_bench.csv";
+    AStarAlgorithm aStar;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::uniform_int_distribution<int> percentDist(0, 99);
+    std::vector<int> robots;
+    std::vector<int> picks;
+
+    // open cells, with about 1 in 10 picks repeating an earlier one
+    while (static_cast<int>(robots.size()) < numRobots) {
+        int index = indexDist(rng);
+        if (aStar.PathFindingAlgorithm::setParam(index, index))
+            robots.push_back(index);
+    }
+
+    while (static_cast<int>(picks.size()) < numPicks) {
+        if (!picks.empty() && (percentDist(rng) < 10)) {
+            picks.push_back(picks[indexDist(rng) % picks.size()]);
+            continue;
+        }
+
+        int index = indexDist(rng);
+        if (aStar.PathFindingAlgorithm::setParam(index, index))
+            picks.push_back(index);
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numRobots
+         << " robots x " << numPicks << " picks" << endl;
+
+    std::vector<double> naive(numRobots * numPicks,
+                              std::numeric_limits<double>::infinity());
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < numRobots; ++i) {
+        for (int j = 0; j < numPicks; ++j) {
+            aStar.PathFindingAlgorithm::setParam(robots[i], picks[j]);
+            if (aStar.computPath(1.0))
+                naive[i * numPicks + j] = aStar.getTotalCost();
+        }
+    }
+    double naiveTime = secondsSince(begin);
+
+    cout << "  A star per pair: " << naiveTime * 1e3 << " ms" << endl;
+
+    int numMismatches = 0;
+    int maxThreads = std::max(1, static_cast<int>(
+                                     std::thread::hardware_concurrency()));
+
+    for (int numThreads : {1, maxThreads}) {
+        std::vector<double> costs;
+
+        begin = std::chrono::steady_clock::now();
+        aStar.computCostMatrix(robots, picks, costs, nullptr, numThreads);
+        double time = secondsSince(begin);
+
+        std::vector<std::vector<int>> paths;
+        begin = std::chrono::steady_clock::now();
+        aStar.computCostMatrix(robots, picks, costs, &paths, numThreads);
+        double pathTime = secondsSince(begin);
+
+        cout << "  cost matrix, " << numThreads << " threads: "
+             << time * 1e3 << " ms, with paths " << pathTime * 1e3
+             << " ms, " << naiveTime / time << "x" << endl;
+
+        for (size_t k = 0; k < costs.size(); ++k) {
+            if (costs[k] != naive[k])
+                ++numMismatches;
+        }
+
+        if (maxThreads == 1)
+            break;
+    }
+
+    remove(mapFile);
+
+    if (numMismatches > 0) {
+        cout << numMismatches << " costs differ from A star" << endl;
+        return -1;
+    }
+
+    return 0;
+}
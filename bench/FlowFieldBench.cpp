@@ -0,0 +1,130 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file FlowFieldBench.cpp
+ *  @brief Benchmark of flow fields for robots sharing a goal
+ *
+ *  This program sends many robots from random starts to one goal and
+ *  prints time spent by A star per robot compared with one flow field
+ *  computation plus reading every robot's path from it.
+ *
+ *  Usage: flow-bench [rows] [cols] [robots]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "FlowFieldAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of robots
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 256;
+    int cols = (argc > 2) ? atoi(argv[2]) : 256;
+    int numRobots = (argc > 3) ? atoi(argv[3]) : 50;
+    const char *mapFile = "flow_bench.csv";
+    AStarAlgorithm aStar;
+    FlowFieldAlgorithm flow;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile) ||
+        !flow.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> starts;
+    int goal = indexDist(rng);
+
+    while (!aStar.PathFindingAlgorithm::setParam(goal, goal))
+        goal = indexDist(rng);
+
+    while (static_cast<int>(starts.size()) < numRobots) {
+        int s = indexDist(rng);
+
+        if (aStar.PathFindingAlgorithm::setParam(s, goal))
+            starts.push_back(s);
+    }
+
+    std::vector<double> aStarCosts(numRobots, -1);
+    double aStarTime = 0;
+
+    for (int i = 0; i < numRobots; ++i) {
+        aStar.PathFindingAlgorithm::setParam(starts[i], goal);
+
+        auto begin = std::chrono::steady_clock::now();
+        if (aStar.computPath(1.0))
+            aStarCosts[i] = aStar.getTotalCost();
+        aStarTime += secondsSince(begin);
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    const FlowField &field = flow.getFlowField(goal);
+    double fieldTime = secondsSince(begin);
+
+    double readTime = 0;
+    int numMismatch = 0;
+
+    for (int i = 0; i < numRobots; ++i) {
+        flow.PathFindingAlgorithm::setParam(starts[i], goal);
+
+        begin = std::chrono::steady_clock::now();
+        bool found = flow.computPath(1.0);
+        readTime += secondsSince(begin);
+
+        if ((found ? flow.getTotalCost() : -1) != aStarCosts[i])
+            ++numMismatch;
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numRobots
+         << " robots to one goal" << endl;
+    cout << "A star total " << aStarTime * 1e3 << " ms" << endl;
+    cout << "flow field " << fieldTime * 1e3 << " ms ("
+         << field.getMemoryUsage() / 1024 << " KiB), paths "
+         << readTime * 1e3 << " ms" << endl;
+    cout << numMismatch << " cost mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
@@ -0,0 +1,167 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file HPABench.cpp
+ *  @brief Benchmark of hierarchical path finding
+ *
+ *  This program builds the cluster abstraction of a random map and
+ *  prints build time, abstract graph size, average query latency,
+ *  expanded nodes, and path cost compared with A star on the same
+ *  random queries, with and without smoothing.
+ *
+ *  Usage: hpa-bench [rows] [cols] [queries] [cluster size]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "HPAAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries, cluster size
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 512;
+    int cols = (argc > 2) ? atoi(argv[2]) : 512;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 200;
+    int clusterSize = (argc > 4) ? atoi(argv[4]) : 16;
+    const char *mapFile = "hpa_bench.csv";
+    AStarAlgorithm aStar;
+    HPAAlgorithm hpa(clusterSize);
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    if (!hpa.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+    double buildTime = secondsSince(begin);
+
+    cout << "map " << rows << "x" << cols << ", cluster " << clusterSize
+         << endl;
+    cout << "abstraction " << buildTime << " s (includes map load), "
+         << hpa.getNumAbstractNodes() << " nodes, "
+         << hpa.getNumAbstractEdges() << " edges" << endl;
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> starts;
+    std::vector<int> goals;
+
+    while (static_cast<int>(starts.size()) < numQueries) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (aStar.PathFindingAlgorithm::setParam(s, g)) {
+            starts.push_back(s);
+            goals.push_back(g);
+        }
+    }
+
+    std::vector<double> aStarCosts(numQueries, -1);
+    double aStarTime = 0;
+    double aStarExpanded = 0;
+
+    for (int i = 0; i < numQueries; ++i) {
+        aStar.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+        begin = std::chrono::steady_clock::now();
+        if (aStar.computPath(1.0))
+            aStarCosts[i] = aStar.getTotalCost();
+        aStarTime += secondsSince(begin);
+
+        aStarExpanded += aStar.getNumExpanded();
+    }
+
+    cout << "A star query " << aStarTime / numQueries * 1e6 << " us, "
+         << aStarExpanded / numQueries << " nodes expanded" << endl;
+
+    int numMismatch = 0;
+
+    for (bool smoothing : {false, true}) {
+        double time = 0;
+        double expanded = 0;
+        double ratio = 0;
+        double worst = 1;
+        int numFound = 0;
+
+        hpa.setSmoothing(smoothing);
+
+        for (int i = 0; i < numQueries; ++i) {
+            hpa.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+            begin = std::chrono::steady_clock::now();
+            bool found = hpa.computPath(1.0);
+            time += secondsSince(begin);
+
+            expanded += hpa.getNumExpanded();
+
+            if (found != (aStarCosts[i] >= 0)) {
+                ++numMismatch;
+                continue;
+            }
+
+            if (!found || (aStarCosts[i] == 0))
+                continue;
+
+            double r = hpa.getTotalCost() / aStarCosts[i];
+            ratio += r;
+            worst = std::max(worst, r);
+            ++numFound;
+        }
+
+        cout << "HPA" << (smoothing ? " smoothed" : "") << " query "
+             << time / numQueries * 1e6 << " us, "
+             << expanded / numQueries << " nodes expanded, cost ratio "
+             << ((numFound > 0) ? ratio / numFound : 1) << " avg, "
+             << worst << " worst" << endl;
+    }
+
+    cout << numMismatch << " reachability mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
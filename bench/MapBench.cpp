@@ -0,0 +1,161 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file MapBench.cpp
+ *  @brief Benchmark of Map memory and obstacle lookups
+ *
+ *  This program loads a random map and prints bytes per cell of the
+ *  obstacle bitmap, with and without the cost layer, against the 4
+ *  bytes per cell of an int array, along with load time and the time
+ *  of setStartGoal and isBlocked lookups.  Csv parse throughput is
+ *  reported for 1, 2, 4, ... threads and compared with opening the
+ *  same map in binary format.
+ *
+ *  Usage: map-bench [rows] [cols] [lookups]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Map.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of lookups
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 2048;
+    int cols = (argc > 2) ? atoi(argv[2]) : 2048;
+    int numLookups = (argc > 3) ? atoi(argv[3]) : 1000000;
+    const char *mapFile = "map_bench.csv";
+    const char *binFile = "map_bench.map";
+    Map map;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::ifstream in(mapFile, std::ios::binary | std::ios::ate);
+    double fileSize = static_cast<double>(in.tellg());
+    in.close();
+
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(std::max(maxThreads, 1));
+
+    cout << "map " << rows << "x" << cols << ", csv "
+         << fileSize / (1 << 20) << " MB" << endl;
+
+    std::chrono::steady_clock::time_point begin;
+    double loadTime = 0;
+
+    for (int numThreads : threadCounts) {
+        map.setNumThreads(numThreads);
+
+        begin = std::chrono::steady_clock::now();
+        if (!map.createMap(mapFile)) {
+            cout << "Fail to load map" << endl;
+            return -1;
+        }
+        loadTime = secondsSince(begin);
+
+        cout << "  csv parse, " << numThreads << " threads: "
+             << loadTime * 1e3 << " ms, "
+             << fileSize / (1 << 20) / loadTime << " MB/s" << endl;
+    }
+
+    double numCells = static_cast<double>(rows) * cols;
+
+    Map binary;
+    if (!map.saveBinaryMap(binFile)) {
+        cout << "Fail to save binary map" << endl;
+        return -1;
+    }
+
+    begin = std::chrono::steady_clock::now();
+    if (!binary.openMap(binFile)) {
+        cout << "Fail to open binary map" << endl;
+        return -1;
+    }
+    double openTime = secondsSince(begin);
+
+    cout << "  binary open: " << openTime * 1e3 << " ms" << endl;
+    cout << "  int array: " << sizeof(int) << " bytes/cell" << endl;
+    cout << "  obstacle bits: " << map.getMemoryUsage() / numCells
+         << " bytes/cell" << endl;
+
+    std::mt19937 rng(6);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> indices(numLookups);
+    for (auto& i : indices)
+        i = indexDist(rng);
+
+    int numBlocked = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i : indices)
+        numBlocked += map.isBlocked(i);
+    double time = secondsSince(begin);
+
+    cout << "  isBlocked: " << time / numLookups * 1e9 << " ns/lookup, "
+         << numBlocked * 100.0 / numLookups << "% blocked" << endl;
+
+    int numValid = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 1; i < numLookups; ++i)
+        numValid += map.setStartGoal(indices[i - 1], indices[i]);
+    time = secondsSince(begin);
+
+    cout << "  setStartGoal: " << time / (numLookups - 1) * 1e9
+         << " ns/call" << endl;
+
+    // one cell above cost 1 allocates the cost layer
+    map.setCost(indices[0], 2);
+    cout << "  obstacle bits + cost layer: "
+         << map.getMemoryUsage() / numCells << " bytes/cell" << endl;
+
+    remove(mapFile);
+    remove(binFile);
+
+    return (numValid > 0) ? 0 : -1;
+}
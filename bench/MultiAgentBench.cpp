@@ -0,0 +1,165 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file MultiAgentBench.cpp
+ *  @brief Benchmark of prioritized multi-agent planning
+ *
+ *  This program picks distinct start and goal cells for many agents on
+ *  a random map, plans them with MultiAgentPlanner and prints the
+ *  planning time, agents planned per second, sum of arrival times and
+ *  makespan.  Paths are checked for vertex and swap conflicts.
+ *
+ *  Usage: mapf-bench [rows] [cols] [agents] [obstaclePercent]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "MultiAgentPlanner.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/**
+ *   @brief  Count pairs of agents in the same cell or swapping cells,
+ *           with agents staying at goal after arrival
+ *
+ *   @param  reference to paths, empty for unplanned agents
+ *   @return number of conflicts in int
+*/
+static int countConflicts(const std::vector<std::vector<int>> &paths) {
+    size_t makespan = 0;
+    int numConflicts = 0;
+
+    for (auto &p : paths)
+        makespan = std::max(makespan, p.size());
+
+    auto at = [&](size_t i, size_t t) {
+        return paths[i][std::min(t, paths[i].size() - 1)];
+    };
+
+    for (size_t t = 0; t < makespan; ++t) {
+        for (size_t i = 0; i < paths.size(); ++i) {
+            for (size_t j = i + 1; !paths[i].empty() && (j < paths.size());
+                 ++j) {
+                if (paths[j].empty())
+                    continue;
+
+                if ((at(i, t) == at(j, t)) ||
+                    ((t > 0) && (at(i, t) == at(j, t - 1)) &&
+                     (at(j, t) == at(i, t - 1))))
+                    ++numConflicts;
+            }
+        }
+    }
+
+    return numConflicts;
+}
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of agents, obstacle percent
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 64;
+    int cols = (argc > 2) ? atoi(argv[2]) : 64;
+    int numAgents = (argc > 3) ? atoi(argv[3]) : 200;
+    int percent = (argc > 4) ? atoi(argv[4]) : 20;
+    const char *mapFile = "mapf_bench.csv";
+    MultiAgentPlanner planner;
+
+    if (!writeRandomMap(mapFile, rows, cols, percent, 1) ||
+        !planner.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::vector<int> starts;
+    std::vector<int> goals;
+
+    for (int i = 1; i <= rows * cols; ++i) {
+        if (planner.PathFindingAlgorithm::setParam(i, i))
+            starts.push_back(i);
+    }
+
+    if (static_cast<int>(starts.size()) < numAgents) {
+        cout << "Only " << starts.size() << " open cells" << endl;
+        remove(mapFile);
+        return -1;
+    }
+
+    std::mt19937 rng(7);
+    goals = starts;
+    std::shuffle(starts.begin(), starts.end(), rng);
+    std::shuffle(goals.begin(), goals.end(), rng);
+
+    std::vector<AgentTask> tasks;
+    for (int i = 0; i < numAgents; ++i)
+        tasks.push_back({starts[i], goals[i]});
+
+    cout << "map " << rows << "x" << cols << ", " << starts.size()
+         << " open cells, " << numAgents << " agents" << endl;
+
+    std::vector<std::vector<int>> paths;
+    const int repeats = 5;
+    int numPlanned = 0;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        numPlanned = planner.planAgents(tasks, paths);
+    double time = secondsSince(begin) / repeats;
+
+    size_t makespan = 0;
+    for (auto &p : paths)
+        makespan = std::max(makespan, p.size());
+
+    cout << "  planned " << numPlanned << " agents in " << time * 1e3
+         << " ms, " << numPlanned / time << " agents/s, "
+         << planner.getNumExpanded() << " expanded" << endl;
+    cout << "  sum of costs " << planner.getTotalCost() << ", makespan "
+         << (makespan > 0 ? makespan - 1 : 0) << endl;
+
+    remove(mapFile);
+
+    int numConflicts = countConflicts(paths);
+    if (numConflicts > 0) {
+        cout << numConflicts << " conflicts between paths" << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PathCacheBench.cpp
+ *  @brief Benchmark of serving repeated A star queries from PathCache
+ *
+ *  This program runs queries between a fixed set of stations on a
+ *  random map, raising the cost of a random open cell every few
+ *  queries (e.g. a slow zone),
+ *  and prints average latency with and without a path cache along
+ *  with cache hit rate, evictions and invalidated results.
+ *
+ *  Usage: cache-bench [rows] [cols] [stations] [queries] [editEvery]
+ *         [budgetKB]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "PathCache.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of stations, number of
+ *           queries, queries between cell changes, cache budget in KB
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 256;
+    int cols = (argc > 2) ? atoi(argv[2]) : 256;
+    int numStations = (argc > 3) ? atoi(argv[3]) : 20;
+    int numQueries = (argc > 4) ? atoi(argv[4]) : 5000;
+    int editEvery = (argc > 5) ? atoi(argv[5]) : 50;
+    int budgetKB = (argc > 6) ? atoi(argv[6]) : 1024;
+    const char *mapFile = "cache_bench.csv";
+    AStarAlgorithm uncached;
+    AStarAlgorithm cached;
+    std::shared_ptr<PathCache> cache(new PathCache(budgetKB * 1024));
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !uncached.PathFindingAlgorithm::init(mapFile) ||
+        !cached.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+    cached.setPathCache(cache);
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::uniform_int_distribution<int> costDist(2, 9);
+    std::vector<int> stations;
+
+    while (static_cast<int>(stations.size()) < numStations) {
+        int index = indexDist(rng);
+        if (uncached.PathFindingAlgorithm::setParam(index, index))
+            stations.push_back(index);
+    }
+
+    std::uniform_int_distribution<int> stationDist(0, numStations - 1);
+    std::vector<PathQuery> queries;
+    std::vector<CellChange> edits;
+
+    for (int i = 0; i < numQueries; ++i) {
+        queries.push_back({stations[stationDist(rng)],
+                           stations[stationDist(rng)], 1.0});
+
+        int index = indexDist(rng);
+        while (!uncached.PathFindingAlgorithm::setParam(index, index))
+            index = indexDist(rng);
+        edits.push_back({index, costDist(rng)});
+    }
+
+    double uncachedTime = 0;
+    double cachedTime = 0;
+    int numMismatches = 0;
+
+    for (int i = 0; i < numQueries; ++i) {
+        if ((editEvery > 0) && (i % editEvery == editEvery - 1)) {
+            std::vector<CellChange> change(1, edits[i]);
+            uncached.updateCells(change);
+            cached.updateCells(change);
+        }
+
+        uncached.PathFindingAlgorithm::setParam(queries[i].start,
+                                                queries[i].goal);
+        cached.PathFindingAlgorithm::setParam(queries[i].start,
+                                              queries[i].goal);
+
+        auto begin = std::chrono::steady_clock::now();
+        bool found = uncached.computPath(queries[i].weight);
+        uncachedTime += secondsSince(begin);
+
+        begin = std::chrono::steady_clock::now();
+        bool cachedFound = cached.computPath(queries[i].weight);
+        cachedTime += secondsSince(begin);
+
+        if ((found != cachedFound) ||
+            (found && (uncached.getTotalCost() != cached.getTotalCost())))
+            ++numMismatches;
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numStations
+         << " stations, " << numQueries << " queries, cell change every "
+         << editEvery << " queries" << endl;
+    cout << "  no cache: " << uncachedTime / numQueries * 1e3
+         << " ms/query" << endl;
+    cout << "  cache (" << budgetKB << " KB): "
+         << cachedTime / numQueries * 1e3 << " ms/query, hit rate "
+         << cache->getHitRate() * 100 << "%, "
+         << cache->getNumEvictions() << " evictions, "
+         << cache->getNumInvalidated() << " invalidated, "
+         << cache->getMemoryUsage() / 1024.0 << " KB used" << endl;
+
+    remove(mapFile);
+
+    if (numMismatches > 0) {
+        cout << numMismatches << " costs differ from uncached search"
+             << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file RadixBench.cpp
+ *  @brief Benchmark of radix heap open set with integer costs
+ *
+ *  This program runs the same random queries with AStarAlgorithm
+ *  (binary heap, double costs) and IntegerAStarAlgorithm (radix heap,
+ *  fixed-point costs), for Dijkstra and A star weights, and prints
+ *  average query latency and expansions per second.
+ *
+ *  Usage: radix-bench [rows] [cols] [queries]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "IntegerAStarAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  Run queries with one algorithm and print its measurements
+ *
+ *   @param  name of algorithm to report
+ *   @param  reference to algorithm initialized with map
+ *   @param  reference to start indices
+ *   @param  reference to goal indices
+ *   @param  weight of heuristic function in double
+ *   @param  reference to total costs, filled per query, -1 if no path
+ *   @return none
+*/
+template <class Algorithm>
+void runQueries(const char *name, Algorithm &algorithm,
+                const std::vector<int> &starts, const std::vector<int> &goals,
+                double weight, std::vector<double> &costs) {
+    int numQueries = static_cast<int>(starts.size());
+    double time = 0;
+    double expanded = 0;
+
+    costs.assign(numQueries, -1);
+
+    for (int i = 0; i < numQueries; ++i) {
+        algorithm.PathFindingAlgorithm::setParam(starts[i], goals[i]);
+
+        auto begin = std::chrono::steady_clock::now();
+        if (algorithm.computPath(weight))
+            costs[i] = algorithm.getTotalCost();
+        time += secondsSince(begin);
+
+        expanded += algorithm.getNumExpanded();
+    }
+
+    cout << "  " << name << ": " << time / numQueries * 1e6 << " us/query, "
+         << expanded / time << " expansions/sec" << endl;
+}
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 512;
+    int cols = (argc > 2) ? atoi(argv[2]) : 512;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 100;
+    const char *mapFile = "radix_bench.csv";
+    AStarAlgorithm aStar;
+    IntegerAStarAlgorithm integer;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !aStar.PathFindingAlgorithm::init(mapFile) ||
+        !integer.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> starts;
+    std::vector<int> goals;
+
+    while (static_cast<int>(starts.size()) < numQueries) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (aStar.PathFindingAlgorithm::setParam(s, g)) {
+            starts.push_back(s);
+            goals.push_back(g);
+        }
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numQueries
+         << " queries" << endl;
+
+    int numMismatch = 0;
+
+    for (double weight : {0.0, 1.0}) {
+        std::vector<double> heapCosts;
+        std::vector<double> radixCosts;
+
+        cout << ((weight == 0) ? "Dijkstra" : "A star") << endl;
+        runQueries("binary heap", aStar, starts, goals, weight, heapCosts);
+        runQueries("radix heap", integer, starts, goals, weight,
+                   radixCosts);
+
+        for (int i = 0; i < numQueries; ++i) {
+            if (heapCosts[i] != radixCosts[i])
+                ++numMismatch;
+        }
+    }
+
+    cout << numMismatch << " cost mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
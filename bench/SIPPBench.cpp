@@ -0,0 +1,280 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SIPPBench.cpp
+ *  @brief Benchmark of safe interval path planning
+ *
+ *  This program lets forklifts drive random walks on a random map,
+ *  marks the cells they hold as unsafe over time, and prints expanded
+ *  states and latency of SIPPAlgorithm against space-time A* over
+ *  (cell, half time unit) states on the same queries.  Arrival times
+ *  of both must match.
+ *
+ *  Usage: sipp-bench [rows] [cols] [forklifts] [queries]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "SIPPAlgorithm.hpp"
+#include "ReservationTable.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/**
+ *   @brief  Check if a cell is safe over closed time range [from, to]
+ *
+ *   @param  reference to unsafe intervals of cell
+ *   @param  first time in double
+ *   @param  last time in double
+ *   @return true if no unsafe interval overlaps range, false otherwise
+*/
+static bool isSafe(const std::vector<TimeInterval> &intervals, double from,
+                   double to) {
+    for (auto &interval : intervals) {
+        if ((interval.begin <= to) && (interval.end > from))
+            return false;
+    }
+
+    return true;
+}
+
+
+/**
+ *   @brief  Find earliest arrival by A star over (node, time step)
+ *           states, where waiting is a move of half a time unit.  Edge
+ *           costs and interval bounds must be multiples of half a unit.
+ *
+ *   @param  reference to graph
+ *   @param  reference to unsafe intervals per node id
+ *   @param  start node id in int
+ *   @param  goal node id in int
+ *   @param  last time searched in double
+ *   @param  reference to arrival time at goal
+ *   @param  reference to number of expanded states
+ *   @return true if goal is reached, false otherwise
+*/
+static bool spaceTimeAStar(const Graph &graph,
+                           const std::vector<std::vector<TimeInterval>>
+                               &unsafe,
+                           int startId, int goalId, double maxTime,
+                           double &arrival, int &numExpanded) {
+    const double step = 0.5;
+    const uint64_t n = graph.getNumNodes();
+    typedef std::tuple<double, int, int> Entry;   // estimate, step, node
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>
+        openSet;
+    ReservationTable closedSet;
+    double goalX = 0;
+    double goalY = 0;
+
+    std::tie(goalX, goalY) = graph.getPos(goalId);
+
+    auto heuristic = [&](int id) {
+        double x = 0;
+        double y = 0;
+        std::tie(x, y) = graph.getPos(id);
+        return sqrt((x - goalX) * (x - goalX) + (y - goalY) * (y - goalY));
+    };
+
+    numExpanded = 0;
+    if (!isSafe(unsafe[startId], 0, 0))
+        return false;
+
+    openSet.push(Entry(heuristic(startId), 0, startId));
+
+    while (!openSet.empty()) {
+        int ticks = std::get<1>(openSet.top());
+        int id = std::get<2>(openSet.top());
+        double time = ticks * step;
+
+        openSet.pop();
+        if (!closedSet.insert(ticks * n + id))
+            continue;
+
+        ++numExpanded;
+
+        if ((id == goalId) &&
+            isSafe(unsafe[id], time, std::numeric_limits<double>::max())) {
+            arrival = time;
+            return true;
+        }
+
+        if (time >= maxTime)
+            continue;
+
+        if (isSafe(unsafe[id], time, time + step))
+            openSet.push(Entry(time + step + heuristic(id), ticks + 1, id));
+
+        graph.forEachNeighbor(id, [&](int next, double cost) {
+            int nextTicks = ticks + static_cast<int>(cost / step + 0.5);
+
+            if (isSafe(unsafe[next], time, time + cost) &&
+                !closedSet.contains(nextTicks * n + next)) {
+                openSet.push(Entry(time + cost + heuristic(next), nextTicks,
+                                   next));
+            }
+        });
+    }
+
+    return false;
+}
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of forklifts, number of
+ *           queries
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 32;
+    int cols = (argc > 2) ? atoi(argv[2]) : 32;
+    int numForklifts = (argc > 3) ? atoi(argv[3]) : 16;
+    int numQueries = (argc > 4) ? atoi(argv[4]) : 10;
+    const char *mapFile = "sipp_bench.csv";
+    SIPPAlgorithm sipp;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !sipp.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    const Graph &graph = sipp.getGraph();
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<std::vector<TimeInterval>> unsafe(rows * cols);
+    int walkLength = 4 * (rows + cols);
+    int numUnsafe = 0;
+
+    // each forklift holds a cell from arrival until half a unit after
+    // it leaves
+    for (int f = 0; f < numForklifts; ++f) {
+        int id = indexDist(rng) - 1;
+
+        while (graph.beginEdge(id) == graph.endEdge(id) ||
+               !sipp.PathFindingAlgorithm::setParam(id + 1, id + 1))
+            id = indexDist(rng) - 1;
+
+        for (int t = 0; t < walkLength; ++t) {
+            unsafe[id].push_back({static_cast<double>(t), t + 1.5});
+            ++numUnsafe;
+
+            std::vector<int> next;
+            graph.forEachNeighbor(id, [&](int n, double cost) {
+                if (cost == 1)
+                    next.push_back(n);
+            });
+
+            if (!next.empty())
+                id = next[rng() % next.size()];
+        }
+    }
+
+    for (int id = 0; id < rows * cols; ++id)
+        sipp.setUnsafeIntervals(id + 1, unsafe[id]);
+
+    std::vector<std::pair<int, int>> queries;
+    std::vector<double> arrivals;
+    long sippExpanded = 0;
+    int numTried = 0;
+
+    // queries with a path, so space-time A* does not search up to its
+    // time limit
+    auto begin = std::chrono::steady_clock::now();
+    while (static_cast<int>(queries.size()) < numQueries) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (!sipp.PathFindingAlgorithm::setParam(s, g))
+            continue;
+
+        ++numTried;
+        bool found = sipp.computPath(1.0);
+        sippExpanded += sipp.getNumExpanded();
+
+        if (found) {
+            queries.push_back({s, g});
+            arrivals.push_back(sipp.getTotalCost());
+        }
+    }
+    double sippTime = secondsSince(begin);
+
+    cout << "map " << rows << "x" << cols << ", " << numForklifts
+         << " forklifts, " << numUnsafe << " unsafe intervals, "
+         << sipp.getNumStates() << " safe intervals" << endl;
+
+    double maxTime = walkLength + 3.0 * (rows + cols);
+    long naiveExpanded = 0;
+    int numMismatches = 0;
+
+    begin = std::chrono::steady_clock::now();
+    for (int q = 0; q < numQueries; ++q) {
+        double arrival = -1;
+        int expanded = 0;
+
+        spaceTimeAStar(graph, unsafe, queries[q].first - 1,
+                       queries[q].second - 1, maxTime, arrival, expanded);
+        naiveExpanded += expanded;
+
+        if (arrival != arrivals[q])
+            ++numMismatches;
+    }
+    double naiveTime = secondsSince(begin);
+
+    cout << "  " << numQueries << " of " << numTried << " queries reached"
+         << endl;
+    cout << "  space-time A*: " << naiveTime * 1e3 / numQueries
+         << " ms/query, " << naiveExpanded / numQueries
+         << " expanded/query" << endl;
+    cout << "  SIPP:          " << sippTime * 1e3 / numTried
+         << " ms/query, " << sippExpanded / numTried
+         << " expanded/query, " << naiveTime / sippTime << "x" << endl;
+
+    remove(mapFile);
+
+    if (numMismatches > 0) {
+        cout << numMismatches << " arrival times differ" << endl;
+        return -1;
+    }
+
+    return 0;
+}
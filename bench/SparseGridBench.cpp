@@ -0,0 +1,188 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SparseGridBench.cpp
+ *  @brief Benchmark of A star on the sparse chunked grid
+ *
+ *  This program writes a yard map of open space with a few
+ *  rectangular buildings and prints memory per cell, build time and
+ *  average query latency of A star on the node and edge graph, on the
+ *  padded cell grid, and on the sparse chunked grid, for the same
+ *  random queries.
+ *
+ *  Usage: sparse-bench [rows] [cols] [queries] [obstaclePercent]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "AStarAlgorithm.hpp"
+#include "GridAStarAlgorithm.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  Load map into a search, run queries, and print build time,
+ *           memory and latency
+ *
+ *   @param  name of search in string
+ *   @param  reference to search
+ *   @param  map file path in string
+ *   @param  memory used by graph or grid of search, called after build
+ *   @param  number of map cells in double
+ *   @param  reference to start, goal pairs of map indices
+ *   @param  reference to costs of queries, -1 if no path
+ *   @return true if map is loaded, false otherwise
+*/
+template <class Algorithm, class MemoryFunction>
+static bool runQueries(const std::string &name, Algorithm &algorithm,
+                       const std::string &mapFile, MemoryFunction memory,
+                       double numCells,
+                       const std::vector<std::pair<int, int>> &queries,
+                       std::vector<double> &costs) {
+    auto begin = std::chrono::steady_clock::now();
+    if (!algorithm.PathFindingAlgorithm::init(mapFile))
+        return false;
+    double buildTime = secondsSince(begin);
+
+    costs.clear();
+    begin = std::chrono::steady_clock::now();
+    for (auto& q : queries) {
+        algorithm.PathFindingAlgorithm::setParam(q.first, q.second);
+        costs.push_back(algorithm.computPath(1.0) ?
+                        algorithm.getTotalCost() : -1);
+    }
+    double time = secondsSince(begin);
+
+    cout << "  " << name << ": " << memory() / numCells << " bytes/cell, "
+         << "init " << buildTime * 1e3 << " ms, "
+         << time / queries.size() * 1e3 << " ms/query" << endl;
+
+    return true;
+}
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of queries, percent of
+ *           obstacle cells
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 2048;
+    int cols = (argc > 2) ? atoi(argv[2]) : 2048;
+    int numQueries = (argc > 3) ? atoi(argv[3]) : 100;
+    int obstaclePercent = (argc > 4) ? atoi(argv[4]) : 5;
+    const char *mapFile = "sparse_bench.csv";
+    Map map;
+
+    if (!writeYardMap(mapFile, rows, cols, obstaclePercent, 1) ||
+        !map.createMap(mapFile)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<std::pair<int, int>> queries;
+
+    while (static_cast<int>(queries.size()) < numQueries) {
+        int start = indexDist(rng);
+        int goal = indexDist(rng);
+
+        if (!map.isBlocked(start) && !map.isBlocked(goal))
+            queries.push_back(std::make_pair(start, goal));
+    }
+
+    cout << "yard map " << rows << "x" << cols << ", " << obstaclePercent
+         << "% obstacles, " << numQueries << " queries" << endl;
+    cout << "  map obstacle bits: "
+         << map.getMemoryUsage() / (static_cast<double>(rows) * cols)
+         << " bytes/cell" << endl;
+
+    double numCells = static_cast<double>(rows) * cols;
+    std::vector<double> graphCosts;
+    std::vector<double> gridCosts;
+    std::vector<double> sparseCosts;
+    bool loaded = true;
+
+    {
+        AStarAlgorithm aStar;
+        loaded = loaded && runQueries("node and edge graph", aStar, mapFile,
+            [&]() { return aStar.getGraph().getMemoryUsage(); },
+            numCells, queries, graphCosts);
+    }
+
+    {
+        Grid8AStarAlgorithm grid;
+        loaded = loaded && runQueries("padded grid", grid, mapFile,
+            [&]() { return grid.getGrid().getMemoryUsage(); },
+            numCells, queries, gridCosts);
+    }
+
+    {
+        Sparse8AStarAlgorithm sparse;
+        loaded = loaded && runQueries("sparse grid", sparse, mapFile,
+            [&]() { return sparse.getGrid().getMemoryUsage(); },
+            numCells, queries, sparseCosts);
+
+        if (loaded)
+            cout << "    " << sparse.getGrid().getNumDenseChunks()
+                 << " of " << sparse.getGrid().getNumChunks()
+                 << " chunks dense" << endl;
+    }
+
+    remove(mapFile);
+
+    if (!loaded) {
+        cout << "Fail to load map" << endl;
+        return -1;
+    }
+
+    int numMismatches = 0;
+    for (int i = 0; i < numQueries; ++i) {
+        if ((graphCosts[i] != sparseCosts[i]) ||
+            (gridCosts[i] != sparseCosts[i]))
+            ++numMismatches;
+    }
+
+    if (numMismatches > 0) {
+        cout << numMismatches << " costs differ between searches" << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file TiledMapBench.cpp
+ *  @brief Benchmark of searching a tiled map through its tile cache
+ *
+ *  This program writes a random map in tiled format and runs the same
+ *  A star queries on the in-memory grid and on the tiled map with
+ *  cache budgets from 1/64 of the map up to the whole map, printing
+ *  query time, tile hit rate and misses per query.  Goals are within
+ *  a window around the start, as for local replanning on a large site.
+ *
+ *  Usage: tile-bench [rows] [cols] [tileSize] [queries] [window]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "GraphSearch.hpp"
+#include "GridAStarAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "TiledMap.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, tile size, number of queries, goal
+ *           window
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 2048;
+    int cols = (argc > 2) ? atoi(argv[2]) : 2048;
+    int tileSize = (argc > 3) ? atoi(argv[3]) : 64;
+    int numQueries = (argc > 4) ? atoi(argv[4]) : 200;
+    int window = (argc > 5) ? atoi(argv[5]) : 256;
+    const char *mapFile = "tile_bench.csv";
+    const char *tileFile = "tile_bench.tiles";
+    Map map;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !map.createMap(mapFile) ||
+        !TiledMap::create(map, tileFile, tileSize)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    // start and goal are open cells at most window apart
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> rowDist(0, rows - 1);
+    std::uniform_int_distribution<int> colDist(0, cols - 1);
+    std::uniform_int_distribution<int> offsetDist(-window, window);
+    std::vector<std::pair<int, int>> queries;
+
+    while (static_cast<int>(queries.size()) < numQueries) {
+        int r = rowDist(rng);
+        int c = colDist(rng);
+        int gr = std::min(std::max(r + offsetDist(rng), 0), rows - 1);
+        int gc = std::min(std::max(c + offsetDist(rng), 0), cols - 1);
+        int start = r * cols + c + 1;
+        int goal = gr * cols + gc + 1;
+
+        if (!map.isBlocked(start) && !map.isBlocked(goal))
+            queries.push_back(std::make_pair(start, goal));
+    }
+
+    Grid8AStarAlgorithm grid;
+    if (!grid.PathFindingAlgorithm::init(mapFile)) {
+        cout << "Fail to load map" << endl;
+        return -1;
+    }
+
+    std::vector<double> costs;
+    auto begin = std::chrono::steady_clock::now();
+    for (auto& q : queries) {
+        grid.PathFindingAlgorithm::setParam(q.first, q.second);
+        costs.push_back(grid.computPath(1.0) ? grid.getTotalCost() : -1);
+    }
+    double gridTime = secondsSince(begin);
+
+    double mapBytes = static_cast<double>(rows) * cols;
+    cout << "map " << rows << "x" << cols << ", " << tileSize << "x"
+         << tileSize << " tiles, " << numQueries << " queries within "
+         << window << " cells" << endl;
+    cout << "  in-memory grid: " << gridTime / numQueries * 1e3
+         << " ms/query" << endl;
+
+    int numMismatches = 0;
+
+    for (int fraction : {64, 16, 4, 1}) {
+        TiledMap tiled;
+        size_t budget = static_cast<size_t>(mapBytes / fraction);
+
+        if (!tiled.open(tileFile, budget)) {
+            cout << "Fail to open tiled map" << endl;
+            return -1;
+        }
+
+        TiledGraph graph(tiled);
+        SearchContext<BinaryHeap> context;
+
+        begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            int goalId = graph.toId(queries[i].second);
+            int numExpanded = 0;
+
+            auto heuristic = [&](int id) {
+                double x0, y0, x1, y1;
+                std::tie(x0, y0) = graph.getPos(id);
+                std::tie(x1, y1) = graph.getPos(goalId);
+                return sqrt((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1));
+            };
+
+            bool found = aStarSearch(graph, context,
+                                     graph.toId(queries[i].first), goalId,
+                                     1.0, heuristic, numExpanded);
+            double cost = found ? context.getCost(goalId) : -1;
+
+            if (cost != costs[i])
+                ++numMismatches;
+        }
+        double time = secondsSince(begin);
+
+        double numReads = static_cast<double>(tiled.getNumHits() +
+                                              tiled.getNumMisses());
+
+        cout << "  budget 1/" << fraction << " ("
+             << tiled.getNumSlots() << " tiles, "
+             << tiled.getMemoryUsage() / 1024 << " KB): "
+             << time / numQueries * 1e3 << " ms/query, hit rate "
+             << tiled.getNumHits() * 100.0 / numReads << "%, "
+             << static_cast<double>(tiled.getNumMisses()) / numQueries
+             << " misses/query" << endl;
+    }
+
+    remove(mapFile);
+    remove(tileFile);
+
+    if (numMismatches > 0) {
+        cout << numMismatches << " costs differ from in-memory grid" << endl;
+        return -1;
+    }
+
+    return 0;
+}
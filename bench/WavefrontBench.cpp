@@ -0,0 +1,147 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file WavefrontBench.cpp
+ *  @brief Benchmark of bit-parallel wavefront flood
+ *
+ *  This program floods a random map from a few start cells with
+ *  Dijkstra on the 8-connected cell grid and with Wavefront using the
+ *  scalar and AVX2 kernels, for hop distances and for reachability
+ *  only, and prints time per flood.
+ *
+ *  Usage: wave-bench [rows] [cols] [starts]
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "GraphSearch.hpp"
+#include "GridGraph.hpp"
+#include "Map.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "Wavefront.hpp"
+#include "BenchMap.hpp"
+
+using std::cout;
+using std::endl;
+
+
+/*
+ *   @brief  benchmark program entrypoint
+ *
+ *   @param  number of arguments
+ *   @param  arguments: rows, cols, number of start cells
+ *   @return integer 0 upon exit success \n
+ *           integer -1 upon exit failure
+*/
+int main(int argc, char **argv) {
+    int rows = (argc > 1) ? atoi(argv[1]) : 1024;
+    int cols = (argc > 2) ? atoi(argv[2]) : 1024;
+    int numStarts = (argc > 3) ? atoi(argv[3]) : 8;
+    const char *mapFile = "wave_bench.csv";
+    Map map;
+    GridGraph<8> grid;
+    Wavefront wavefront;
+
+    if (!writeRandomMap(mapFile, rows, cols, 20, 1) ||
+        !map.createMap(mapFile) || !grid.build(map) ||
+        !wavefront.build(map)) {
+        cout << "Fail to create map" << endl;
+        return -1;
+    }
+
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    std::vector<int> starts;
+
+    while (static_cast<int>(starts.size()) < numStarts) {
+        int s = indexDist(rng);
+        if (!grid.isBlocked(grid.toId(s)))
+            starts.push_back(s);
+    }
+
+    cout << "map " << rows << "x" << cols << ", " << numStarts
+         << " starts, AVX2 " << (Wavefront::hasAvx2() ? "on" : "off")
+         << endl;
+
+    SearchContext<BinaryHeap> context;
+    std::vector<int> reached(numStarts);
+    auto zero = [](int) { return 0.0; };
+    double time = 0;
+
+    for (int i = 0; i < numStarts; ++i) {
+        auto begin = std::chrono::steady_clock::now();
+        aStarSearch(grid, context, grid.toId(starts[i]), -1, 0, zero,
+                    reached[i]);
+        time += secondsSince(begin);
+    }
+
+    cout << "  Dijkstra: " << time / numStarts * 1e3 << " ms/flood" << endl;
+
+    int numMismatch = 0;
+    std::vector<int> hops;
+    const struct {
+        const char *name;
+        Wavefront::Kernel kernel;
+    } kernels[] = {{"scalar", Wavefront::SCALAR}, {"AVX2", Wavefront::AVX2}};
+
+    for (auto& k : kernels) {
+        if ((k.kernel == Wavefront::AVX2) && !Wavefront::hasAvx2())
+            continue;
+
+        wavefront.setKernel(k.kernel);
+
+        for (bool withHops : {true, false}) {
+            time = 0;
+
+            for (int i = 0; i < numStarts; ++i) {
+                auto begin = std::chrono::steady_clock::now();
+                if (withHops)
+                    wavefront.computeHops({starts[i]}, 8, hops);
+                else
+                    wavefront.computeReachable({starts[i]}, 8);
+                time += secondsSince(begin);
+
+                if (wavefront.getNumReached() != reached[i])
+                    ++numMismatch;
+            }
+
+            cout << "  wavefront " << k.name << ", "
+                 << (withHops ? "hops" : "reachability") << ": "
+                 << time / numStarts * 1e3 << " ms/flood" << endl;
+        }
+    }
+
+    cout << numMismatch << " reachability mismatches" << endl;
+
+    remove(mapFile);
+
+    return (numMismatch == 0) ? 0 : -1;
+}
@@ -0,0 +1,143 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ALTAlgorithm.hpp
+ *  @brief Definition of class ALTAlgorithm
+ *
+ *  This file contains definitions and prototypes of class ALTAlgorithm,
+ *  an A star search whose heuristic is derived from landmark cost
+ *  tables.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_ALTALGORITHM_HPP_
+#define INCLUDE_ALTALGORITHM_HPP_
+
+#include <string>
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "Landmarks.hpp"
+
+
+/**
+ *  @brief Class definition of ALTAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  Landmark bounds follow walls and aisles that the euclidean distance
+ *  ignores, so far fewer nodes are expanded on maze-like maps.  The
+ *  heuristic is consistent, so weight 1 gives the same total cost as
+ *  A star.
+*/
+class ALTAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of ALTAlgorithm class
+      *
+      *   @param  number of landmarks in int
+      *   @param  landmark selection strategy
+      *   @return none
+     */
+     explicit ALTAlgorithm(int count = 8,
+                           Landmarks::Strategy selection =
+                               Landmarks::AVOID)
+             : numLandmarks(count), strategy(selection), numThreads(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of ALTAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~ALTAlgorithm() {}
+
+
+     /**
+      *   @brief  Build graph from map, then load landmark tables from
+      *           table file if it was built for this graph, otherwise
+      *           compute them and write them to table file
+      *
+      *   @param  none
+      *   @return true if graph is built, false otherwise
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices, and weight for heuristic estimates
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Set file to load landmark tables from and save them
+      *           to, used by the next init
+      *
+      *   @param  file path in string, empty to always compute tables
+      *   @return none
+     */
+     void setTableFile(const std::string &file)
+                { tableFile = file; }
+
+
+     /**
+      *   @brief  Set number of threads computing landmark tables, used
+      *           by the next init
+      *
+      *   @param  number of threads in int, 0 for one per hardware
+      *           thread
+      *   @return none
+     */
+     void setNumThreads(int threads)
+                { numThreads = threads; }
+
+
+     /**
+      *   @brief  Get landmarks and cost tables
+      *
+      *   @param  none
+      *   @return const reference to landmarks
+     */
+     const Landmarks& getLandmarks()
+                { return landmarks; }
+
+ private:
+     int numLandmarks;                      ///< landmarks to select
+     Landmarks::Strategy strategy;          ///< landmark selection
+     int numThreads;                        ///< threads of table build
+     std::string tableFile;                 ///< saved landmark tables
+     Landmarks landmarks;                   ///< landmark cost tables
+
+     ///< cost, parent, open and closed sets of the current search
+     SearchContext<BinaryHeap> context;
+};
+
+#endif  // INCLUDE_ALTALGORITHM_HPP_
@@ -25,8 +25,8 @@
 /** @file AStarAlgorithm.hpp
  *  @brief Definition of class AStarAlgorithm
  *
- *  This file contains definitions and prototypes of class AStarAlgorithm
- *  and its helper functions.
+ *  This file contains definitions and prototypes of class template
+ *  BasicAStarAlgorithm and its AStarAlgorithm instantiations.
  *
  *  @author Huei Tzu Tsai
  *  @date   03/07/2017
@@ -36,33 +36,53 @@
 #define INCLUDE_ASTARALGORITHM_HPP_
 
 
-#include <list>
+#include <stdint.h>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <vector>
+#include "CellChange.hpp"
+#include "PathCache.hpp"
 #include "PathFindAlgorithm.hpp"
+#include "PathQuery.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "ThreadPool.hpp"
 
 
 /**
- *  @brief Class definition of AStarAlgorithm class which is derived
+ *  @brief Class definition of BasicAStarAlgorithm class which is derived
  *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  The open set is kept in the priority queue given by policy
+ *  parameter Queue (e.g. BinaryHeap, QuaternaryHeap, PairingHeap).
+ *  Search state lives in a SearchContext that is reused by every
+ *  call of computPath, so graph does not need to be rebuilt between
+ *  queries.  Results can be served from a PathCache, which is kept
+ *  valid across updateCells.
 */
-class AStarAlgorithm : public PathFindingAlgorithm {
+template <class Queue>
+class BasicAStarAlgorithm : public PathFindingAlgorithm {
  public:
      /**
-      *   @brief  Constructor of AStarAlgorithm class
+      *   @brief  Constructor of BasicAStarAlgorithm class
       *
       *   @param  none
       *   @return none
      */
-     AStarAlgorithm() {}
+     BasicAStarAlgorithm() : reverseBuilt(false), mapVersion(0),
+                             iteration(0),
+                             suboptimalityBound(
+                                 std::numeric_limits<double>::infinity()) {}
 
 
      /**
-      *   @brief  Deconstructor of AStarAlgorithm class
+      *   @brief  Deconstructor of BasicAStarAlgorithm class
       *
       *   @param  none
       *   @return none
      */
-     ~AStarAlgorithm() {}
+     ~BasicAStarAlgorithm() {}
 
 
      /**
@@ -74,64 +94,196 @@ class AStarAlgorithm : public PathFindingAlgorithm {
      */
      bool computPath(double);
 
- private:
-     ///< pointers to nodes in open set
-     std::list<std::shared_ptr<Node>> openSet;
 
-     ///< pointers to nodes in closed set
-     std::list<std::shared_ptr<Node>> closedSet;
+     /**
+      *   @brief  Build graph from map.  Reversed graph used by
+      *           bidirectional search is rebuilt on its next use.
+      *           Map version is increased and path cache cleared.
+      *
+      *   @param  none
+      *   @return true if graph is built, false otherwise
+     */
+     bool buildGraph();
 
 
      /**
-      *   @brief  Compute heuristic cost between start and end nodes
-      *           using euclidean distance
+      *   @brief  Change costs of map cells and of the edges into them
+      *           in place, without rebuilding graph.  Map version is
+      *           increased and cached paths that cross a changed cell
+      *           are dropped.
       *
-      *   @param  reference to pointer of start node
-      *   @param  reference to pointer of end node
-      *   @return heuristic cost estimation in double
+      *   @param  reference to cell changes
+      *   @return true if cells are changed, false if an index is
+      *           outside map or a cost is not in [1, 255] or max int,
+      *           in which case no cell is changed
      */
-     double getHeuristicCost(std::shared_ptr<Node> &, std::shared_ptr<Node> &);
+     bool updateCells(const std::vector<CellChange>&);
 
 
      /**
-      *   @brief  Get the cost between two given indices
+      *   @brief  Get version of map, a hash of the built graph mixed
+      *           with each cell change since.  Searches that load the
+      *           same map and make the same changes get the same
+      *           version.
       *
-      *   @param  start node index in int
-      *   @param  end node index in int
-      *   @return edge cost between two indices in double
+      *   @param  none
+      *   @return map version in uint64_t
      */
-     double getCostToNeighbor(int, int);
+     uint64_t getMapVersion(void) const { return mapVersion; }
 
 
      /**
-      *   @brief  Find the list of neighbors for given node index
+      *   @brief  Set cache of results used by computPath and
+      *           computPaths.  Searches may share a cache if they load
+      *           the same map and make the same cell changes.
       *
-      *   @param  node index in int
-      *   @param  reference to the node neighbor pointer list
+      *   @param  shared pointer to cache, nullptr to search every query
       *   @return none
      */
-     void findNeighbors(int, std::list<std::shared_ptr<Node>> &);
+     void setPathCache(std::shared_ptr<PathCache>);
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices by searching from both ends.  Weight 0 gives
+      *           bidirectional Dijkstra, weight 1 bidirectional A star
+      *           with consistent average potentials.  Weights above 1
+      *           are not guaranteed to give the shortest path.
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPathBidirectional(double);
+
+
+     /**
+      *   @brief  Compute path in anytime mode with ARA*.  A path within
+      *           weight times the shortest is found first, then weight
+      *           is lowered by weight step and the path improved,
+      *           reusing open and inconsistent nodes of earlier rounds,
+      *           until weight reaches 1 or deadline passes.  Path and
+      *           total cost are of the best path found.
+      *
+      *   @param  initial weight of heuristic function in double
+      *   @param  wall clock time to stop at
+      *   @param  weight decrease per round in double, 0 for one round
+      *   @return true if a path is found before deadline, false
+      *           otherwise
+     */
+     bool computPathAnytime(double, std::chrono::steady_clock::time_point,
+                            double weightStep = 0.5);
+
+
+     /**
+      *   @brief  Get bound on cost of path from computPathAnytime over
+      *           shortest path cost
+      *
+      *   @param  none
+      *   @return bound in double, 1 if path is shortest, infinity if no
+      *           path is found
+     */
+     double getSuboptimalityBound(void) const { return suboptimalityBound; }
+
+
+     /**
+      *   @brief  Compute shortest paths of many queries in parallel.
+      *           Graph is only read, and each worker thread has its own
+      *           search context, so queries do not share state.  Start
+      *           and goal set by setParam are not used or changed.
+      *
+      *   @param  reference to queries (start, goal indices and weight)
+      *   @param  reference to results, resized to number of queries and
+      *           filled in query order.  Reusing results across calls
+      *           reuses path memory.
+      *   @param  number of worker threads in int, 0 for one per
+      *           hardware thread
+      *   @return number of queries whose path is found in int
+     */
+     int computPaths(const std::vector<PathQuery>&,
+                     std::vector<PathResult>&, int numThreads = 0);
+
+
+     /**
+      *   @brief  Compute costs from every source to every target.  One
+      *           Dijkstra search runs per distinct source, in parallel,
+      *           and stops once every distinct target is settled, so
+      *           repeated sources and targets are searched once.  Start
+      *           and goal set by setParam are not used or changed.
+      *
+      *   @param  reference to source indices (rows of matrix)
+      *   @param  reference to target indices (columns of matrix)
+      *   @param  reference to costs, resized to sources x targets and
+      *           filled row by row, infinity if target cannot be
+      *           reached or an index is outside map or an obstacle
+      *   @param  pointer to paths, filled like costs with path indices
+      *           of each pair (empty if not reached), nullptr to skip
+      *           paths
+      *   @param  number of worker threads in int, 0 for one per
+      *           hardware thread
+      *   @return number of pairs whose path is found in int
+     */
+     int computCostMatrix(const std::vector<int>&, const std::vector<int>&,
+                          std::vector<double>&,
+                          std::vector<std::vector<int>> *paths = nullptr,
+                          int numThreads = 0);
+
+ private:
+     ///< cost, parent, open and closed sets of the current search
+     SearchContext<Queue> context;
+
+     ///< search state from goal of bidirectional search
+     SearchContext<Queue> backwardContext;
+
+     Graph reverseGraph;                    ///< graph with edges reversed
+     bool reverseBuilt;                     ///< reverseGraph matches graph
+     uint64_t mapVersion;                   ///< identity of map and changes
+
+     std::shared_ptr<PathCache> cache;      ///< results of past queries
+
+     std::unique_ptr<ThreadPool> pool;      ///< workers of computPaths
+
+     ///< search state of each worker of computPaths
+     std::vector<SearchContext<Queue>> workerContexts;
+
+     std::vector<uint32_t> closedStamp;     ///< round a node was closed in
+     uint32_t iteration;                    ///< stamp of current round
+     std::vector<int> inconsistent;         ///< closed nodes improved in
+                                            ///< current round
+     double suboptimalityBound;             ///< bound of anytime path
+
+
+     /**
+      *   @brief  Compute shortest path of one query without touching
+      *           members other than graph and map, so it can run on
+      *           several threads at once
+      *
+      *   @param  reference to query
+      *   @param  reference to search context of calling thread
+      *   @param  reference to result
+      *   @return none
+     */
+     void computQuery(const PathQuery&, SearchContext<Queue>&, PathResult&);
+
+
+     /**
+      *   @brief  Compute heuristic cost between start and end nodes
+      *           using euclidean distance
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int) const;
 };
 
 
-/*
- *   @brief  Helper function, check if node is in a given list
- *  
- *   @param  node index in int
- *   @param  reference to the node pointer list to check
- *   @return true if node is in the list, false otherwise
-*/
-bool checkList(int, std::list<std::shared_ptr<Node>> const &);
+///< A star using an indexed binary heap as open set
+typedef BasicAStarAlgorithm<BinaryHeap> AStarAlgorithm;
 
+///< A star using an indexed 4-ary heap as open set
+typedef BasicAStarAlgorithm<QuaternaryHeap> QuaternaryAStarAlgorithm;
 
-/*
- *   @brief  Helper function, compare estimated cost of two nodes
- *  
- *   @param  pointer to first node
- *   @param  pointer to second node
- *   @return true if estimated cost of first node is lower than second node
- *           false otherwise
-*/
-bool compareCost(const std::shared_ptr<Node> &, const std::shared_ptr<Node> &);
+///< A star using a pairing heap as open set
+typedef BasicAStarAlgorithm<PairingHeap> PairingAStarAlgorithm;
 
 #endif  // INCLUDE_ASTARALGORITHM_HPP_
@@ -0,0 +1,104 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file CHAlgorithm.hpp
+ *  @brief Definition of class CHAlgorithm
+ *
+ *  This file contains definitions and prototypes of class CHAlgorithm,
+ *  which answers path queries on a contraction hierarchy of the map
+ *  graph.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_CHALGORITHM_HPP_
+#define INCLUDE_CHALGORITHM_HPP_
+
+#include "PathFindAlgorithm.hpp"
+#include "ContractionHierarchy.hpp"
+
+
+/**
+ *  @brief Class definition of CHAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  init builds the graph and contracts it once, which pays off when a
+ *  static map is queried many times.  Queries return the same total
+ *  cost as A star and the full cell path.
+*/
+class CHAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of CHAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     CHAlgorithm() {}
+
+
+     /**
+      *   @brief  Deconstructor of CHAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~CHAlgorithm() {}
+
+
+     /**
+      *   @brief  Build graph from map and contract it
+      *
+      *   @param  none
+      *   @return true if graph is built, false otherwise
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices
+      *
+      *   @param  weight of heuristic function in double, unused as
+      *           hierarchy queries are always exact
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Get contraction hierarchy built from map
+      *
+      *   @param  none
+      *   @return const reference to contraction hierarchy
+     */
+     const ContractionHierarchy& getHierarchy()
+                { return hierarchy; }
+
+ private:
+     ContractionHierarchy hierarchy;        ///< contracted graph
+};
+
+#endif  // INCLUDE_CHALGORITHM_HPP_
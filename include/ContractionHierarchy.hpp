@@ -0,0 +1,180 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ContractionHierarchy.hpp
+ *  @brief Definition of class ContractionHierarchy
+ *
+ *  This file contains definitions and prototypes of class
+ *  ContractionHierarchy, a preprocessed form of a Graph that answers
+ *  exact shortest path queries by searching only a small part of it.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_CONTRACTIONHIERARCHY_HPP_
+#define INCLUDE_CONTRACTIONHIERARCHY_HPP_
+
+#include <vector>
+#include "Graph.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+
+
+/**
+ *  @brief Class that contracts nodes of a directed graph one by one,
+ *         adding shortcut edges that keep shortest path costs between
+ *         the remaining nodes, and answers queries with a
+ *         bidirectional search that only moves to higher ranked nodes
+*/
+class ContractionHierarchy {
+ public:
+     /**
+      *   @brief  Constructor of ContractionHierarchy class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ContractionHierarchy() : numShortcuts(0), preprocessTime(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of ContractionHierarchy class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~ContractionHierarchy() {}
+
+
+     /**
+      *   @brief  Order and contract every node of graph and store the
+      *           upward and downward edges of the hierarchy
+      *
+      *   @param  reference to graph
+      *   @return none
+     */
+     void build(const Graph&);
+
+
+     /**
+      *   @brief  Compute shortest path between two nodes
+      *
+      *   @param  start node id in int
+      *   @param  goal node id in int
+      *   @param  reference to cost of shortest path
+      *   @param  reference to vector int of node ids from start to goal,
+      *           with shortcuts unpacked into original edges
+      *   @param  reference to number of expanded nodes
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool query(int, int, double&, std::vector<int>&, int&);
+
+
+     /**
+      *   @brief  Get number of nodes
+      *
+      *   @param  none
+      *   @return number of nodes in int
+     */
+     int getNumNodes(void) const { return static_cast<int>(rank.size()); }
+
+
+     /**
+      *   @brief  Get contraction order of a node
+      *
+      *   @param  node id in int
+      *   @return rank in int, higher ranks were contracted later
+     */
+     int getRank(int node) const { return rank[node]; }
+
+
+     /**
+      *   @brief  Get number of shortcut edges added by build
+      *
+      *   @param  none
+      *   @return number of shortcuts in int
+     */
+     int getNumShortcuts(void) const { return numShortcuts; }
+
+
+     /**
+      *   @brief  Get time spent by last build
+      *
+      *   @param  none
+      *   @return preprocessing time in seconds in double
+     */
+     double getPreprocessTime(void) const { return preprocessTime; }
+
+ private:
+     /**
+      *  @brief Edge of the hierarchy
+     */
+     struct Edge {
+          int node;                         ///< other end node
+          double cost;                      ///< edge cost
+          int middle;                       ///< node skipped by shortcut,
+                                            ///< -1 for original edge
+     };
+
+     std::vector<int> rank;                        ///< contraction order
+     int numShortcuts;                             ///< shortcuts added
+     double preprocessTime;                        ///< seconds of build
+
+     std::vector<int> upOffsets;                   ///< first up edge
+     std::vector<Edge> upEdges;                    ///< edges to higher
+                                                   ///< ranked end nodes
+     std::vector<int> downOffsets;                 ///< first down edge
+     std::vector<Edge> downEdges;                  ///< edges from higher
+                                                   ///< ranked start nodes,
+                                                   ///< kept at end node
+
+     SearchContext<BinaryHeap> forward;            ///< search from start
+     SearchContext<BinaryHeap> backward;           ///< search from goal
+     std::vector<int> upPath;                      ///< path in hierarchy
+
+
+     /**
+      *   @brief  Get middle node of hierarchy edge between two nodes
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return middle node id in int, -1 for original edge
+     */
+     int getMiddle(int, int) const;
+
+
+     /**
+      *   @brief  Append nodes of an edge with shortcuts unpacked,
+      *           excluding its start node
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @param  reference to vector int of node ids
+      *   @return none
+     */
+     void unpack(int, int, std::vector<int>&) const;
+};
+
+#endif  // INCLUDE_CONTRACTIONHIERARCHY_HPP_
@@ -0,0 +1,190 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DStarLiteAlgorithm.hpp
+ *  @brief Definition of class DStarLiteAlgorithm
+ *
+ *  This file contains definitions and prototypes of class
+ *  DStarLiteAlgorithm, an incremental planner that repairs its last
+ *  search when cell costs change or the start moves.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_DSTARLITEALGORITHM_HPP_
+#define INCLUDE_DSTARLITEALGORITHM_HPP_
+
+#include <utility>
+#include <vector>
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "GridGraph.hpp"
+#include "CellChange.hpp"
+
+
+/**
+ *  @brief Class definition of DStarLiteAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  D* Lite searches backward from goal and keeps costs to goal of the
+ *  cells it reached between calls of computPath.  After updateCells
+ *  or a move of the start by setParam, only cells whose cost to goal
+ *  may have changed are expanded again.  While the start stays in
+ *  place this is LPA* on reversed moves.  A new goal or weight starts
+ *  a new search.
+*/
+class DStarLiteAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of DStarLiteAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     DStarLiteAlgorithm() : searchStart(-1), searchGoal(-1),
+                            searchWeight(0), keyModifier(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of DStarLiteAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~DStarLiteAlgorithm() {}
+
+
+     /**
+      *   @brief  Build padded cell array from map and drop search state
+      *
+      *   @param  none
+      *   @return true if grid is built, false if map is 4-connected or
+      *           grid cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices, and weight for heuristic estimates, reusing
+      *           the previous search when goal and weight are the same.
+      *           Weights above 1 are not guaranteed to give the
+      *           shortest path.
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Change costs of map cells, and mark cells whose cost to
+      *           goal may change for repair by the next computPath
+      *
+      *   @param  reference to cell changes
+      *   @return true if every change is applied, false if an index is
+      *           out of map or a cost is not in [1, 255] or max int.
+      *           Changes before the invalid one are kept.
+     */
+     bool updateCells(const std::vector<CellChange>&);
+
+ private:
+     ///< lexicographic key of a cell in open set
+     typedef std::pair<double, double> Key;
+
+     GridGraph<8> grid;                            ///< padded cell array
+     int searchStart;                              ///< start id when keys
+                                                   ///< were last offset
+     int searchGoal;                               ///< goal id of search,
+                                                   ///< -1 if none
+     double searchWeight;                          ///< heuristic weight
+     double keyModifier;                           ///< heuristic drop since
+                                                   ///< search began
+     std::vector<double> g;                        ///< cost to goal
+     std::vector<double> rhs;                      ///< one step lookahead
+                                                   ///< cost to goal
+     IndexedHeap<2, Key> openSet;                  ///< inconsistent cells
+
+
+     /**
+      *   @brief  Start a new search towards goal
+      *
+      *   @param  goal node id in int
+      *   @param  weight of heuristic function in double
+      *   @return none
+     */
+     void resetSearch(int, double);
+
+
+     /**
+      *   @brief  Expand inconsistent cells until cost of start is known
+      *
+      *   @param  start node id in int
+      *   @return none
+     */
+     void computeShortestPath(int);
+
+
+     /**
+      *   @brief  Recompute lookahead cost of a cell from its neighbors
+      *           and update its place in open set
+      *
+      *   @param  node id in int
+      *   @return none
+     */
+     void updateCell(int);
+
+
+     /**
+      *   @brief  Put cell in open set if it is inconsistent, remove it
+      *           otherwise
+      *
+      *   @param  node id in int
+      *   @return none
+     */
+     void updateOpenSet(int);
+
+
+     /**
+      *   @brief  Compute key of a cell for current start
+      *
+      *   @param  node id in int
+      *   @return key
+     */
+     Key getKey(int);
+
+
+     /**
+      *   @brief  Compute heuristic cost between two nodes using octile
+      *           distance
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int);
+};
+
+#endif  // INCLUDE_DSTARLITEALGORITHM_HPP_
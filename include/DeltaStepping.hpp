@@ -0,0 +1,186 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DeltaStepping.hpp
+ *  @brief Definition of class DeltaStepping
+ *
+ *  This file contains definitions and prototypes of class
+ *  DeltaStepping, a parallel one-to-all shortest path search over the
+ *  map graph.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_DELTASTEPPING_HPP_
+#define INCLUDE_DELTASTEPPING_HPP_
+
+#include <stddef.h>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Graph.hpp"
+#include "ThreadPool.hpp"
+
+
+/**
+ *  @brief Class that computes shortest path costs from one node to
+ *         every node with delta-stepping on a thread pool
+ *
+ *  Nodes are kept in buckets of width delta by tentative cost.  The
+ *  lowest bucket is emptied by relaxing edges no longer than delta
+ *  from all its nodes in parallel, until none re-enters it, then the
+ *  longer edges of the nodes it held are relaxed once.  Costs are the
+ *  same as those of Dijkstra, since edge costs of a map add up
+ *  exactly in double.
+*/
+class DeltaStepping {
+ public:
+     /**
+      *   @brief  Constructor of DeltaStepping class
+      *
+      *   @param  number of worker threads in int, 0 for one per
+      *           hardware thread
+      *   @return none
+     */
+     explicit DeltaStepping(int numThreads = 0)
+             : pool(numThreads), delta(0), usedDelta(0), numBuckets(0),
+               numNodes(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of DeltaStepping class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~DeltaStepping() {}
+
+
+     /**
+      *   @brief  Set bucket width.  Smaller widths do less repeated
+      *           work, larger ones give each bucket more parallel work.
+      *
+      *   @param  bucket width in double, 0 for the largest edge cost
+      *   @return none
+     */
+     void setDelta(double width) { delta = width; }
+
+
+     /**
+      *   @brief  Get bucket width used by last compute
+      *
+      *   @param  none
+      *   @return bucket width in double
+     */
+     double getDelta(void) const { return usedDelta; }
+
+
+     /**
+      *   @brief  Get number of worker threads
+      *
+      *   @param  none
+      *   @return number of threads in int
+     */
+     int getNumThreads(void) const { return pool.getNumThreads(); }
+
+
+     /**
+      *   @brief  Get number of buckets emptied by last compute
+      *
+      *   @param  none
+      *   @return number of buckets in int
+     */
+     int getNumBuckets(void) const { return numBuckets; }
+
+
+     /**
+      *   @brief  Compute shortest path costs from a node to every node
+      *
+      *   @param  reference to graph
+      *   @param  start node id in int
+      *   @param  reference to costs, resized to number of nodes,
+      *           infinity for nodes that cannot be reached
+      *   @return none
+     */
+     void compute(const Graph&, int, std::vector<double>&);
+
+ private:
+     ///< bucket index and node id of an improved node
+     typedef std::pair<size_t, int> Request;
+
+     ThreadPool pool;                              ///< worker threads
+     double delta;                                 ///< bucket width set,
+                                                   ///< 0 for automatic
+     double usedDelta;                             ///< bucket width of
+                                                   ///< last compute
+     int numBuckets;                               ///< buckets emptied
+     size_t numNodes;                              ///< size of cost array
+
+     std::unique_ptr<std::atomic<double>[]> cost;  ///< tentative costs
+     std::vector<std::vector<int>> buckets;        ///< cyclic buckets of
+                                                   ///< node ids
+     std::vector<std::vector<Request>> requests;   ///< improved nodes of
+                                                   ///< each worker
+     std::vector<int> frontier;                    ///< nodes relaxed in
+                                                   ///< current round
+     std::vector<int> settled;                     ///< nodes taken from
+                                                   ///< current bucket
+
+
+     /**
+      *   @brief  Relax edges of nodes in parallel
+      *
+      *   @param  reference to graph
+      *   @param  reference to node ids
+      *   @param  true to relax edges no longer than delta, false for
+      *           longer ones
+      *   @return none
+     */
+     void relax(const Graph&, const std::vector<int>&, bool);
+
+
+     /**
+      *   @brief  Move improved nodes of every worker into buckets
+      *
+      *   @param  none
+      *   @return number of nodes added in size_t
+     */
+     size_t collectRequests(void);
+
+
+     /**
+      *   @brief  Run a function over ranges of [0, n) on the workers,
+      *           or on the calling thread if n is small
+      *
+      *   @param  number of items in size_t
+      *   @param  function called with worker, first and end item
+      *   @return none
+     */
+     template <class Function>
+     void forEachRange(size_t, Function);
+};
+
+#endif  // INCLUDE_DELTASTEPPING_HPP_
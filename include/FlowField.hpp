@@ -0,0 +1,163 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file FlowField.hpp
+ *  @brief Definition of class FlowField
+ *
+ *  This file contains definitions and prototypes of class FlowField,
+ *  the cost to one goal and the next step towards it from every cell
+ *  of a grid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_FLOWFIELD_HPP_
+#define INCLUDE_FLOWFIELD_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "GridGraph.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+
+
+/**
+ *  @brief Class that stores, for every cell of a padded 8-connected
+ *         grid, the shortest path cost to a goal cell and the direction
+ *         of the next cell on that path
+ *
+ *  The field is filled by one Dijkstra from the goal over reversed
+ *  moves.  Afterwards a path from any cell is read by following
+ *  directions, in time linear in path length.  Each cell takes a
+ *  float cost and a one byte direction.
+*/
+class FlowField {
+ public:
+     /**
+      *   @brief  Constructor of FlowField class
+      *
+      *   @param  none
+      *   @return none
+     */
+     FlowField() : goalId(-1), numExpanded(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of FlowField class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~FlowField() {}
+
+
+     /**
+      *   @brief  Compute cost to goal and next direction of every cell
+      *
+      *   @param  reference to grid
+      *   @param  goal node id in int
+      *   @param  reference to search context used by Dijkstra
+      *   @return none
+     */
+     void build(const GridGraph<8>&, int, SearchContext<BinaryHeap>&);
+
+
+     /**
+      *   @brief  Get path from a cell to goal
+      *
+      *   @param  start node id in int
+      *   @param  reference to vector int of node ids from start to goal
+      *   @return true if goal can be reached from start, false otherwise
+     */
+     bool extractPath(int, std::vector<int>&) const;
+
+
+     /**
+      *   @brief  Get goal of field
+      *
+      *   @param  none
+      *   @return goal node id in int, -1 if field is not built
+     */
+     int getGoal(void) const { return goalId; }
+
+
+     /**
+      *   @brief  Get shortest path cost from a cell to goal
+      *
+      *   @param  node id in int
+      *   @return cost in double, infinity if goal cannot be reached
+     */
+     double getCost(int id) const { return cost[id]; }
+
+
+     /**
+      *   @brief  Get next cell on shortest path from a cell to goal
+      *
+      *   @param  node id in int
+      *   @return node id in int, -1 at goal or if goal cannot be
+      *           reached
+     */
+     int getNextHop(int id) const {
+         return (direction[id] == noDirection) ? -1 :
+                                                 id + offset[direction[id]];
+     }
+
+
+     /**
+      *   @brief  Get number of cells expanded by last build
+      *
+      *   @param  none
+      *   @return number of expanded nodes in int
+     */
+     int getNumExpanded(void) const { return numExpanded; }
+
+
+     /**
+      *   @brief  Get memory used by cost and direction arrays
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const {
+         return cost.capacity() * sizeof(float) + direction.capacity();
+     }
+
+ private:
+     static const uint8_t noDirection = 0xff;      ///< direction of goal
+                                                   ///< and unreachable
+                                                   ///< cells
+
+     int goalId;                                   ///< goal node id
+     int numExpanded;                              ///< cells expanded by
+                                                   ///< last build
+     int offset[8];                                ///< id offset of each
+                                                   ///< direction
+     std::vector<float> cost;                      ///< cost to goal
+     std::vector<uint8_t> direction;               ///< direction of next
+                                                   ///< cell
+};
+
+#endif  // INCLUDE_FLOWFIELD_HPP_
@@ -0,0 +1,165 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file FlowFieldAlgorithm.hpp
+ *  @brief Definition of class FlowFieldAlgorithm
+ *
+ *  This file contains definitions and prototypes of class
+ *  FlowFieldAlgorithm, which answers path queries from flow fields
+ *  kept for the most recently used goals.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_FLOWFIELDALGORITHM_HPP_
+#define INCLUDE_FLOWFIELDALGORITHM_HPP_
+
+#include <list>
+#include <unordered_map>
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "GridGraph.hpp"
+#include "FlowField.hpp"
+
+
+/**
+ *  @brief Class definition of FlowFieldAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  The first query to a goal computes its flow field, a Dijkstra over
+ *  the whole map.  Later queries to the same goal, e.g. many robots
+ *  heading to one dock, only follow the field from their start.
+ *  Fields of the most recently used goals are cached, up to a given
+ *  number.
+*/
+class FlowFieldAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of FlowFieldAlgorithm class
+      *
+      *   @param  number of goals whose fields are cached in int
+      *   @return none
+     */
+     explicit FlowFieldAlgorithm(int size = 8)
+             : cacheSize((size < 1) ? 1 : size) {}
+
+
+     /**
+      *   @brief  Deconstructor of FlowFieldAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~FlowFieldAlgorithm() {}
+
+
+     /**
+      *   @brief  Build padded cell array from map and drop cached
+      *           fields
+      *
+      *   @param  none
+      *   @return true if grid is built, false if map is 4-connected or
+      *           grid cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices from flow field of goal.  Number of expanded
+      *           nodes is that of building the field, 0 if it was
+      *           cached.
+      *
+      *   @param  weight of heuristic function in double, unused as
+      *           fields are always exact
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Get flow field of a goal, computing it if it is not
+      *           cached
+      *
+      *   @param  goal map index (1 based) in int
+      *   @return const reference to flow field, valid until a field of
+      *           another goal is computed
+     */
+     const FlowField& getFlowField(int);
+
+
+     /**
+      *   @brief  Set number of goals whose fields are cached.  Least
+      *           recently used fields beyond it are dropped.
+      *
+      *   @param  number of fields in int, at least 1
+      *   @return none
+     */
+     void setCacheSize(int);
+
+
+     /**
+      *   @brief  Get number of cached fields
+      *
+      *   @param  none
+      *   @return number of fields in int
+     */
+     int getNumCached()
+                { return static_cast<int>(fields.size()); }
+
+
+     /**
+      *   @brief  Get grid built from map
+      *
+      *   @param  none
+      *   @return const reference to grid
+     */
+     const GridGraph<8>& getGrid()
+                { return grid; }
+
+ private:
+     GridGraph<8> grid;                            ///< padded cell array
+     int cacheSize;                                ///< fields to keep
+     std::list<FlowField> fields;                  ///< cached fields, most
+                                                   ///< recently used first
+     std::unordered_map<int, std::list<FlowField>::iterator> cache;
+                                                   ///< field of goal id
+
+     ///< cost, parent, open and closed sets of field computation
+     SearchContext<BinaryHeap> context;
+
+
+     /**
+      *   @brief  Find field of a goal, computing it if it is not cached
+      *
+      *   @param  goal node id in int
+      *   @param  reference set to true if field was cached
+      *   @return reference to field
+     */
+     FlowField& findField(int, bool&);
+};
+
+#endif  // INCLUDE_FLOWFIELDALGORITHM_HPP_
@@ -0,0 +1,283 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file Graph.hpp
+ *  @brief Definition of class Graph
+ *
+ *  This file contains definitions and prototypes of class Graph which
+ *  stores the map graph in compressed sparse row (CSR) form: an offset
+ *  array per node, followed by contiguous edge targets and contiguous
+ *  edge costs.  Neighbors of a node are the edges in
+ *  [beginEdge(node), endEdge(node)).
+ *
+ *  Nodes are identified by id = map index - 1 and laid out in row
+ *  major order, so the position of a node is derived from its id.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_GRAPH_HPP_
+#define INCLUDE_GRAPH_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+
+/**
+ *  @brief Class that keeps nodes and directed edges of a grid map in
+ *         compressed sparse row form
+*/
+class Graph {
+ public:
+     /**
+      *   @brief  Constructor of Graph class
+      *
+      *   @param  none
+      *   @return none
+     */
+     Graph() : numRows(0), numCols(0), lastSource(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of Graph class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~Graph() {}
+
+
+     /**
+      *   @brief  Remove all edges and size graph for a grid map
+      *
+      *   @param  number of rows in map in int
+      *   @param  number of columns in map in int
+      *   @return none
+     */
+     void reset(int, int);
+
+
+     /**
+      *   @brief  Append a directed edge.  Edges must be added in
+      *           ascending order of their start node.
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @param  edge cost in double, infinity if end is not passable
+      *   @return none
+     */
+     void addEdge(int, int, double);
+
+
+     /**
+      *   @brief  Complete offsets of nodes after last edge is added
+      *
+      *   @param  none
+      *   @return none
+     */
+     void finalize(void);
+
+
+     /**
+      *   @brief  Build graph with every passable edge reversed, so that
+      *           a search from the goal follows edges backward.  Edge
+      *           cost is kept, i.e. it is still the cost of entering
+      *           the end node of the original edge.
+      *
+      *   @param  reference to graph to store reversed edges
+      *   @return none
+     */
+     void buildReverse(Graph&) const;
+
+
+     /**
+      *   @brief  Get number of nodes
+      *
+      *   @param  none
+      *   @return number of nodes in int
+     */
+     int getNumNodes(void) const { return numRows * numCols; }
+
+
+     /**
+      *   @brief  Get number of edges
+      *
+      *   @param  none
+      *   @return number of edges in int
+     */
+     int getNumEdges(void) const { return static_cast<int>(targets.size()); }
+
+
+     /**
+      *   @brief  Get number of rows of the grid map
+      *
+      *   @param  none
+      *   @return number of rows in int
+     */
+     int getRow(void) const { return numRows; }
+
+
+     /**
+      *   @brief  Get number of columns of the grid map
+      *
+      *   @param  none
+      *   @return number of columns in int
+     */
+     int getCol(void) const { return numCols; }
+
+
+     /**
+      *   @brief  Get first edge of a node
+      *
+      *   @param  node id in int
+      *   @return edge id in int
+     */
+     int beginEdge(int node) const { return offsets[node]; }
+
+
+     /**
+      *   @brief  Get one past the last edge of a node
+      *
+      *   @param  node id in int
+      *   @return edge id in int
+     */
+     int endEdge(int node) const { return offsets[node + 1]; }
+
+
+     /**
+      *   @brief  Get end node of an edge
+      *
+      *   @param  edge id in int
+      *   @return node id in int
+     */
+     int getTarget(int edge) const { return targets[edge]; }
+
+
+     /**
+      *   @brief  Get cost of an edge
+      *
+      *   @param  edge id in int
+      *   @return edge cost in double
+     */
+     double getCost(int edge) const { return costs[edge]; }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every passable
+      *           neighbor of a node
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int node, Function f) const {
+         for (int e = offsets[node]; e < offsets[node + 1]; ++e) {
+             if (costs[e] < std::numeric_limits<float>::infinity())
+                 f(targets[e], static_cast<double>(costs[e]));
+         }
+     }
+
+
+     /**
+      *   @brief  Get cost of edge between two nodes in O(degree)
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return edge cost in double, infinity if there is no edge
+     */
+     double getCost(int, int) const;
+
+
+     /**
+      *   @brief  Change cost of edge between two nodes in O(degree)
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @param  edge cost in double, infinity for edge into obstacle
+      *   @return true if edge exists, false otherwise
+     */
+     bool setCost(int, int, double);
+
+
+     /**
+      *   @brief  Get x, y (row, column) position of node
+      *
+      *   @param  node id in int
+      *   @return x, y position group by tuple in double
+     */
+     std::tuple<double, double> getPos(int node) const {
+         return std::make_tuple(static_cast<double>(node / numCols),
+                                static_cast<double>(node % numCols));
+     }
+
+
+     /**
+      *   @brief  Get memory used by node and edge arrays
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const;
+
+
+     /**
+      *   @brief  Get 64 bit FNV-1a hash of edge targets and costs, which
+      *           differs between maps of one size with other obstacles
+      *           or cell costs
+      *
+      *   @param  none
+      *   @return hash in uint64_t
+     */
+     uint64_t getFingerprint(void) const;
+
+
+     /**
+      *   @brief  Cost used for edges into obstacle nodes
+      *
+      *   @param  none
+      *   @return infinity in double
+     */
+     static double infinity(void) {
+         return std::numeric_limits<double>::infinity();
+     }
+
+ private:
+     int numRows;                                  ///< number of rows in map
+     int numCols;                                  ///< number of cols in map
+     int lastSource;                               ///< start node of last
+                                                   ///< added edge
+
+     std::vector<int> offsets;                     ///< first edge of node
+     std::vector<int> targets;                     ///< end node of edge
+     std::vector<float> costs;                     ///< cost of edge, costs
+                                                   ///< are multiples of 0.5
+                                                   ///< so float is exact
+};
+
+#endif  // INCLUDE_GRAPH_HPP_
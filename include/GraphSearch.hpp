@@ -0,0 +1,303 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file GraphSearch.hpp
+ *  @brief Definition of generic A star search over any graph
+ *
+ *  This file contains the A star search loop shared by the path
+ *  finding algorithms.  It runs over any graph type that provides
+ *
+ *  - int getNumNodes() const
+ *  - void forEachNeighbor(int id, F f) const, calling f(neighbor, cost)
+ *    for every passable neighbor
+ *
+ *  so the same search can run on the CSR Graph or on graphs that
+ *  generate neighbors on the fly (e.g. GridGraph).  It also holds a
+ *  Dijkstra search that stops once a set of targets is settled, used
+ *  for many-to-many cost matrices.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_GRAPHSEARCH_HPP_
+#define INCLUDE_GRAPHSEARCH_HPP_
+
+#include <limits>
+#include "SearchContext.hpp"
+
+
+/**
+ *   @brief  Compute shortest path between two nodes using A star.
+ *           Setting weight to 0 gives Dijkstra's algorithm.
+ *
+ *   @param  reference to graph to search
+ *   @param  reference to search context, reset by this function
+ *   @param  start node id in int
+ *   @param  goal node id in int
+ *   @param  weight of heuristic function in double
+ *   @param  heuristic function, returns estimated cost from node id
+ *           to goal
+ *   @param  reference to number of expanded nodes
+ *   @return true if shortest path can be found, false otherwise.  Path
+ *           and cost can be read from context.
+*/
+template <class GraphType, class Queue, class Heuristic>
+bool aStarSearch(const GraphType &graph, SearchContext<Queue> &context,
+                 int startId, int goalId, double weight,
+                 Heuristic heuristic, int &numExpanded) {
+    numExpanded = 0;
+
+    // discard state of previous search
+    context.reset(graph.getNumNodes());
+    Queue &openSet = context.getOpenSet();
+
+    // initialize start node's cost and heuristic cost to goal, and
+    // add start node to open set
+    context.visit(startId, 0, weight * heuristic(startId), -1);
+    openSet.push(startId, context.getEstimateCost(startId));
+
+    while (!openSet.empty()) {
+        // current node in open set with lowest cost
+        int cur = openSet.top();
+
+        // check if current equals to goal
+        if (cur == goalId)
+            return true;
+
+        // remove current from open set and add to closed set
+        openSet.pop();
+        context.close(cur);
+        ++numExpanded;
+
+        double curCost = context.getCost(cur);
+
+        graph.forEachNeighbor(cur, [&](int n, double edgeCost) {
+            // if neighbor in closed set, continue
+            if (context.isClosed(n))
+                return;
+
+            double tempCost = curCost + edgeCost;
+
+            bool inOpenSet = context.isVisited(n);
+            if (inOpenSet && tempCost >= context.getCost(n)) {
+                // not a better path
+                return;
+            }
+
+            // update neighbor's parent to current, cost to tempCost,
+            // and estimated cost to tempCost + heuristic estimate
+            double estimate = tempCost + weight * heuristic(n);
+            context.visit(n, tempCost, estimate, cur);
+
+            // if neighbor not in open set, add, otherwise move it up
+            if (inOpenSet)
+                openSet.decreaseKey(n, estimate);
+            else
+                openSet.push(n, estimate);
+        });
+    }
+
+    return false;
+}
+
+
+/**
+ *   @brief  Compute shortest path between two nodes by searching
+ *           forward from start and backward from goal at the same
+ *           time.
+ *
+ *           Both searches use the potential p(v) of the forward
+ *           direction and -p(v) of the backward direction, which
+ *           gives both the same non-negative reduced edge costs when
+ *           p is consistent, e.g. p(v) = (h_goal(v) - h_start(v)) / 2.
+ *           A zero potential gives bidirectional Dijkstra.  Search
+ *           stops when the lowest keys of both open sets add up to at
+ *           least the best path cost found so far.
+ *
+ *   @param  reference to graph to search forward
+ *   @param  reference to graph with edges reversed, searched backward
+ *   @param  reference to forward search context, reset by this function
+ *   @param  reference to backward search context, reset by this
+ *           function
+ *   @param  start node id in int
+ *   @param  goal node id in int
+ *   @param  potential function, returns forward potential of node id
+ *   @param  reference to cost of shortest path
+ *   @param  reference to node id where forward and backward paths meet
+ *   @param  reference to number of expanded nodes of both searches
+ *   @return true if shortest path can be found, false otherwise.  Path
+ *           from start to meeting node is kept in forward context and
+ *           path from meeting node to goal in backward context.
+*/
+template <class GraphType, class Queue, class Potential>
+bool bidirectionalSearch(const GraphType &forwardGraph,
+                         const GraphType &backwardGraph,
+                         SearchContext<Queue> &forward,
+                         SearchContext<Queue> &backward,
+                         int startId, int goalId, Potential potential,
+                         double &pathCost, int &meetId, int &numExpanded) {
+    const double inf = std::numeric_limits<double>::infinity();
+
+    numExpanded = 0;
+    pathCost = inf;
+    meetId = -1;
+
+    forward.reset(forwardGraph.getNumNodes());
+    backward.reset(backwardGraph.getNumNodes());
+
+    forward.visit(startId, 0, potential(startId), -1);
+    forward.getOpenSet().push(startId, forward.getEstimateCost(startId));
+    backward.visit(goalId, 0, -potential(goalId), -1);
+    backward.getOpenSet().push(goalId, backward.getEstimateCost(goalId));
+
+    if (startId == goalId) {
+        pathCost = 0;
+        meetId = startId;
+    }
+
+    while (true) {
+        Queue &forwardOpen = forward.getOpenSet();
+        Queue &backwardOpen = backward.getOpenSet();
+        double forwardTop = forwardOpen.empty() ? inf : forwardOpen.topKey();
+        double backwardTop = backwardOpen.empty() ? inf :
+                                                    backwardOpen.topKey();
+
+        // no path through an unexpanded node can be shorter
+        if (forwardTop + backwardTop >= pathCost)
+            break;
+
+        // expand the direction with the lower key
+        bool isForward = forwardTop <= backwardTop;
+        const GraphType &graph = isForward ? forwardGraph : backwardGraph;
+        SearchContext<Queue> &context = isForward ? forward : backward;
+        SearchContext<Queue> &other = isForward ? backward : forward;
+        Queue &openSet = context.getOpenSet();
+        double sign = isForward ? 1.0 : -1.0;
+
+        int cur = openSet.top();
+        openSet.pop();
+        context.close(cur);
+        ++numExpanded;
+
+        double curCost = context.getCost(cur);
+
+        graph.forEachNeighbor(cur, [&](int n, double edgeCost) {
+            if (context.isClosed(n))
+                return;
+
+            double tempCost = curCost + edgeCost;
+
+            bool inOpenSet = context.isVisited(n);
+            if (inOpenSet && tempCost >= context.getCost(n))
+                return;
+
+            double estimate = tempCost + sign * potential(n);
+            context.visit(n, tempCost, estimate, cur);
+
+            if (inOpenSet)
+                openSet.decreaseKey(n, estimate);
+            else
+                openSet.push(n, estimate);
+
+            // path through n if the other search has reached it
+            double total = tempCost + other.getCost(n);
+            if (total < pathCost) {
+                pathCost = total;
+                meetId = n;
+            }
+        });
+    }
+
+    return meetId >= 0;
+}
+
+/**
+ *   @brief  Compute costs from one node to a set of target nodes using
+ *           Dijkstra's algorithm.  Search stops as soon as every
+ *           target is settled, so only nodes closer than the farthest
+ *           target are expanded.
+ *
+ *   @param  reference to graph to search
+ *   @param  reference to search context, reset by this function
+ *   @param  start node id in int
+ *   @param  number of distinct target nodes in int
+ *   @param  function returning true if node id is a target
+ *   @param  reference to number of expanded nodes
+ *   @return number of targets reached in int.  Cost and path of a
+ *           target can be read from context if it is closed.
+*/
+template <class GraphType, class Queue, class IsTarget>
+int settleTargets(const GraphType &graph, SearchContext<Queue> &context,
+                  int startId, int numTargets, IsTarget isTarget,
+                  int &numExpanded) {
+    int numSettled = 0;
+    numExpanded = 0;
+
+    context.reset(graph.getNumNodes());
+    Queue &openSet = context.getOpenSet();
+
+    context.visit(startId, 0, 0, -1);
+    openSet.push(startId, 0);
+
+    while (!openSet.empty() && (numSettled < numTargets)) {
+        int cur = openSet.top();
+
+        // cost of current is final once it leaves open set
+        openSet.pop();
+        context.close(cur);
+
+        if (isTarget(cur))
+            ++numSettled;
+
+        if (numSettled == numTargets)
+            break;
+
+        ++numExpanded;
+
+        double curCost = context.getCost(cur);
+
+        graph.forEachNeighbor(cur, [&](int n, double edgeCost) {
+            if (context.isClosed(n))
+                return;
+
+            double tempCost = curCost + edgeCost;
+
+            bool inOpenSet = context.isVisited(n);
+            if (inOpenSet && tempCost >= context.getCost(n))
+                return;
+
+            context.visit(n, tempCost, tempCost, cur);
+
+            if (inOpenSet)
+                openSet.decreaseKey(n, tempCost);
+            else
+                openSet.push(n, tempCost);
+        });
+    }
+
+    return numSettled;
+}
+
+#endif  // INCLUDE_GRAPHSEARCH_HPP_
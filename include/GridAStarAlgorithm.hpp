@@ -0,0 +1,139 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file GridAStarAlgorithm.hpp
+ *  @brief Definition of class template GridAStarAlgorithm
+ *
+ *  This file contains definitions and prototypes of class template
+ *  GridAStarAlgorithm, an A star search that runs directly on the
+ *  map cells instead of a graph of nodes and edges.  Cells are kept
+ *  either in a padded array (GridGraph) or in chunks that are stored
+ *  as a single cost when uniform (SparseGrid).
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_GRIDASTARALGORITHM_HPP_
+#define INCLUDE_GRIDASTARALGORITHM_HPP_
+
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "GridGraph.hpp"
+#include "SparseGrid.hpp"
+
+
+/**
+ *  @brief Class definition of GridAStarAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  Neighbors are generated on the fly from the cells, so no edge is
+ *  ever stored.  Connectivity (4 or 8) and the cell storage are fixed
+ *  at compile time.
+*/
+template <int Connectivity, class GridType = GridGraph<Connectivity> >
+class GridAStarAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of GridAStarAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     GridAStarAlgorithm() {}
+
+
+     /**
+      *   @brief  Deconstructor of GridAStarAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~GridAStarAlgorithm() {}
+
+
+     /**
+      *   @brief  Build cell storage from map.  No edge is generated.
+      *           Csv maps take the connectivity of the search.
+      *
+      *   @param  none
+      *   @return true if grid is built, false if map has another
+      *           connectivity or grid cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices, and weight for heuristic estimates
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Get grid built from map
+      *
+      *   @param  none
+      *   @return const reference to grid
+     */
+     const GridType& getGrid()
+                { return grid; }
+
+ private:
+     ///< cells of map
+     GridType grid;
+
+     ///< cost, parent, open and closed sets of the current search
+     SearchContext<BinaryHeap> context;
+
+
+     /**
+      *   @brief  Compute heuristic cost between start and end nodes
+      *           using euclidean distance
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int);
+};
+
+
+///< A star on a 4-connected grid
+typedef GridAStarAlgorithm<4> Grid4AStarAlgorithm;
+
+///< A star on an 8-connected grid
+typedef GridAStarAlgorithm<8> Grid8AStarAlgorithm;
+
+///< A star on a 4-connected sparse chunked grid
+typedef GridAStarAlgorithm<4, SparseGrid<4> > Sparse4AStarAlgorithm;
+
+///< A star on an 8-connected sparse chunked grid
+typedef GridAStarAlgorithm<8, SparseGrid<8> > Sparse8AStarAlgorithm;
+
+#endif  // INCLUDE_GRIDASTARALGORITHM_HPP_
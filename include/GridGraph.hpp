@@ -0,0 +1,332 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file GridGraph.hpp
+ *  @brief Definition of class template GridGraph
+ *
+ *  This file contains definitions of class template GridGraph which
+ *  lets a search run directly on the map cells without materializing
+ *  edges.  Each cell is one byte holding its cost (0 for obstacle) and
+ *  the grid is padded by a border of obstacle cells, so neighbors are
+ *  generated from fixed index offsets without bounds checks.
+ *
+ *  Connectivity is a compile time parameter; GridConnectivity<4> and
+ *  GridConnectivity<8> select which of Map's moving directions are
+ *  used.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_GRIDGRAPH_HPP_
+#define INCLUDE_GRIDGRAPH_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "Map.hpp"
+
+
+/**
+ *  @brief Moving directions used by a grid with given connectivity,
+ *         as indices into Map's moving direction array
+*/
+template <int Connectivity>
+struct GridConnectivity;
+
+
+/**
+ *  @brief 4-connected grid: up, left, right, down
+*/
+template <>
+struct GridConnectivity<4> {
+     static int direction(int k) {
+         static const int dirs[4] = {1, 3, 4, 6};
+         return dirs[k];
+     }
+};
+
+
+/**
+ *  @brief 8-connected grid: all of Map's moving directions
+*/
+template <>
+struct GridConnectivity<8> {
+     static int direction(int k) { return k; }
+};
+
+
+/**
+ *  @brief Class that generates neighbors of map cells on the fly from
+ *         a padded one byte per cell cost array
+*/
+template <int Connectivity>
+class GridGraph {
+ public:
+     /**
+      *   @brief  Constructor of GridGraph class
+      *
+      *   @param  none
+      *   @return none
+     */
+     GridGraph() : numRows(0), numCols(0), stride(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of GridGraph class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~GridGraph() {}
+
+
+     /**
+      *   @brief  Copy cell costs from map into padded cell array
+      *
+      *   @param  reference to map
+      *   @return true if grid is built, false if map has another
+      *           connectivity or a cell cost does not fit in one byte
+     */
+     bool build(Map &map) {
+         int *dir = map.getMoveDir();
+
+         if (map.getNumDir() != Connectivity)
+             return false;
+
+         numRows = map.getRow();
+         numCols = map.getCol();
+         stride = numCols + 2;
+
+         // border cells stay 0 (obstacle)
+         cells.assign(static_cast<size_t>(numRows + 2) * stride, 0);
+
+         for (int i = 0; i < numRows; ++i) {
+             for (int j = 0; j < numCols; ++j) {
+                 int cost = map.getCost(i * numCols + j + 1);
+
+                 if (cost == std::numeric_limits<int>::max())
+                     continue;
+
+                 if ((cost < 1) || (cost > 255))
+                     return false;
+
+                 cells[(i + 1) * stride + j + 1] = static_cast<uint8_t>(cost);
+             }
+         }
+
+         for (int k = 0; k < Connectivity; ++k) {
+             int d = GridConnectivity<Connectivity>::direction(k);
+             int dx = dir[d * 2];
+             int dy = dir[d * 2 + 1];
+
+             offset[k] = dy * stride + dx;
+             stepX[k] = dx;
+             stepY[k] = dy;
+
+             // setting cost to 1.5x for diagonal movement
+             multiplier[k] = ((dx != 0) && (dy != 0)) ? 1.5 : 1.0;
+         }
+
+         return true;
+     }
+
+
+     /**
+      *   @brief  Get number of node ids, including padding cells
+      *
+      *   @param  none
+      *   @return number of node ids in int
+     */
+     int getNumNodes(void) const { return static_cast<int>(cells.size()); }
+
+
+     /**
+      *   @brief  Convert map index to node id
+      *
+      *   @param  map index (1 based) in int
+      *   @return node id in int
+     */
+     int toId(int index) const {
+         return ((index - 1) / numCols + 1) * stride +
+                (index - 1) % numCols + 1;
+     }
+
+
+     /**
+      *   @brief  Convert node id to map index
+      *
+      *   @param  node id in int
+      *   @return map index (1 based) in int
+     */
+     int toIndex(int id) const {
+         return (id / stride - 1) * numCols + id % stride;
+     }
+
+
+     /**
+      *   @brief  Check if node is an obstacle or padding cell
+      *
+      *   @param  node id in int
+      *   @return true if node cannot be crossed, false otherwise
+     */
+     bool isBlocked(int id) const { return cells[id] == 0; }
+
+
+     /**
+      *   @brief  Get cost of moving into a node straight
+      *
+      *   @param  node id in int
+      *   @return cell cost in int, 0 if node is blocked
+     */
+     int getCellCost(int id) const { return cells[id]; }
+
+
+     /**
+      *   @brief  Change cost of a node
+      *
+      *   @param  node id in int, not a padding cell
+      *   @param  cell cost in int, max int for obstacle
+      *   @return true if cost is set, false if it does not fit in one
+      *           byte
+     */
+     bool setCellCost(int id, int cost) {
+         if (cost == std::numeric_limits<int>::max()) {
+             cells[id] = 0;
+             return true;
+         }
+
+         if ((cost < 1) || (cost > 255))
+             return false;
+
+         cells[id] = static_cast<uint8_t>(cost);
+         return true;
+     }
+
+
+     /**
+      *   @brief  Get id difference of moving one cell in a direction
+      *
+      *   @param  direction in int, [0, Connectivity)
+      *   @return id offset in int
+     */
+     int getOffset(int k) const { return offset[k]; }
+
+
+     /**
+      *   @brief  Get column change of moving one cell in a direction
+      *
+      *   @param  direction in int, [0, Connectivity)
+      *   @return -1, 0, or 1
+     */
+     int getStepX(int k) const { return stepX[k]; }
+
+
+     /**
+      *   @brief  Get row change of moving one cell in a direction
+      *
+      *   @param  direction in int, [0, Connectivity)
+      *   @return -1, 0, or 1
+     */
+     int getStepY(int k) const { return stepY[k]; }
+
+
+     /**
+      *   @brief  Get cost multiplier of moving in a direction
+      *
+      *   @param  direction in int, [0, Connectivity)
+      *   @return 1.5 for diagonal, 1 otherwise
+     */
+     double getMultiplier(int k) const { return multiplier[k]; }
+
+
+     /**
+      *   @brief  Get number of ids between two rows
+      *
+      *   @param  none
+      *   @return row stride in int
+     */
+     int getStride(void) const { return stride; }
+
+
+     /**
+      *   @brief  Get x, y (row, column) position of node in map
+      *
+      *   @param  node id in int
+      *   @return x, y position group by tuple in double
+     */
+     std::tuple<double, double> getPos(int id) const {
+         return std::make_tuple(static_cast<double>(id / stride - 1),
+                                static_cast<double>(id % stride - 1));
+     }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every passable
+      *           neighbor of a node
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         for (int k = 0; k < Connectivity; ++k) {
+             int n = id + offset[k];
+             uint8_t cost = cells[n];
+
+             if (cost != 0)
+                 f(n, cost * multiplier[k]);
+         }
+     }
+
+
+     /**
+      *   @brief  Get memory used by cell array
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const { return cells.capacity(); }
+
+ private:
+     int numRows;                                  ///< number of rows in map
+     int numCols;                                  ///< number of cols in map
+     int stride;                                   ///< padded row length
+
+     std::vector<uint8_t> cells;                   ///< padded cell costs,
+                                                   ///< 0 is obstacle
+     int offset[Connectivity];                     ///< id offset of each
+                                                   ///< direction
+     int stepX[Connectivity];                      ///< column change of
+                                                   ///< each direction
+     int stepY[Connectivity];                      ///< row change of each
+                                                   ///< direction
+     double multiplier[Connectivity];              ///< cost multiplier of
+                                                   ///< each direction
+};
+
+#endif  // INCLUDE_GRIDGRAPH_HPP_
@@ -0,0 +1,323 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file HPAAlgorithm.hpp
+ *  @brief Definition of class HPAAlgorithm
+ *
+ *  This file contains definitions and prototypes of class HPAAlgorithm,
+ *  a hierarchical path finder (HPA*) that plans over clusters of the
+ *  map before planning cell by cell.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_HPAALGORITHM_HPP_
+#define INCLUDE_HPAALGORITHM_HPP_
+
+#include <unordered_map>
+#include <vector>
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "GridGraph.hpp"
+
+
+/**
+ *  @brief Class definition of HPAAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  The map is split into square clusters.  Cells where a path can
+ *  cross between neighboring clusters become nodes of an abstract
+ *  graph, connected by precomputed costs inside each cluster.  A query
+ *  searches the abstract graph, then refines each abstract edge with a
+ *  search limited to one cluster, so search state is sized by cluster
+ *  instead of map.  Start and goal in the same or neighboring
+ *  clusters are also searched directly within those clusters and the
+ *  ones around them, so short paths do not detour through entrances.
+ *
+ *  Paths are not guaranteed to be shortest.  Abstract edges only pass
+ *  through entrance cells, which costs little on maps of uniform cell
+ *  cost but may give paths well above optimal on maps with weighted
+ *  cells.  Use an exact engine where cost matters; the optional
+ *  smoothing pass shortens detours around entrance cells.
+*/
+class HPAAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of HPAAlgorithm class
+      *
+      *   @param  cluster width and height in cells in int
+      *   @return none
+     */
+     explicit HPAAlgorithm(int size = 16) : clusterSize(size),
+                                            smoothing(false), numRows(0),
+                                            numCols(0), numClusterRows(0),
+                                            numClusterCols(0), minCost(0),
+                                            directCost(0), windowRow(0),
+                                            windowCol(0), windowRows(0),
+                                            windowCols(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of HPAAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~HPAAlgorithm() {}
+
+
+     /**
+      *   @brief  Build padded cell array and abstract graph from map.
+      *           No cell level edge is generated.
+      *
+      *   @param  none
+      *   @return true if graph is built, false if map is 4-connected or
+      *           graph cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute path using given start, goal nodes indices,
+      *           and weight for heuristic estimates
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if a path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Set cluster width and height, used by next init
+      *
+      *   @param  cluster size in cells in int
+      *   @return none
+     */
+     void setClusterSize(int size)
+                { clusterSize = size; }
+
+
+     /**
+      *   @brief  Enable or disable path smoothing after refinement
+      *
+      *   @param  true to smooth paths
+      *   @return none
+     */
+     void setSmoothing(bool enable)
+                { smoothing = enable; }
+
+
+     /**
+      *   @brief  Get number of nodes of abstract graph
+      *
+      *   @param  none
+      *   @return number of abstract nodes in int
+     */
+     int getNumAbstractNodes()
+                { return static_cast<int>(nodeCell.size()); }
+
+
+     /**
+      *   @brief  Get number of edges of abstract graph
+      *
+      *   @param  none
+      *   @return number of abstract edges in int
+     */
+     int getNumAbstractEdges();
+
+ private:
+     /**
+      *  @brief Edge of abstract graph
+     */
+     struct AbstractEdge {
+          int node;                         ///< end abstract node
+          double cost;                      ///< cost between cells
+     };
+
+     GridGraph<8> grid;                     ///< padded cell array
+     int clusterSize;                       ///< cluster width in cells
+     bool smoothing;                        ///< smooth refined paths
+     int numRows;                           ///< number of rows in map
+     int numCols;                           ///< number of cols in map
+     int numClusterRows;                    ///< clusters per column
+     int numClusterCols;                    ///< clusters per row
+     int minCost;                           ///< lowest cell cost
+
+     std::vector<int> nodeCell;             ///< cell id of abstract node
+     std::vector<std::vector<AbstractEdge>> edges;  ///< abstract edges
+     std::vector<std::vector<int>> clusterNodes;    ///< abstract nodes of
+                                                    ///< each cluster
+     std::unordered_map<int, int> cellNode; ///< abstract node of cell
+
+     std::vector<AbstractEdge> startEdges;  ///< edges from query start
+     std::vector<double> toGoal;            ///< cost from abstract node
+                                            ///< to query goal
+     double directCost;                     ///< cost from start to goal
+                                            ///< inside their clusters
+     std::vector<int> directPath;           ///< cells from start to goal
+                                            ///< inside their clusters
+
+     SearchContext<BinaryHeap> abstractContext;    ///< abstract search
+     SearchContext<BinaryHeap> localContext;       ///< cluster search
+     int windowRow;                                ///< first padded row
+                                                   ///< of cluster search
+     int windowCol;                                ///< first padded col
+                                                   ///< of cluster search
+     int windowRows;                               ///< rows of cluster
+                                                   ///< search
+     int windowCols;                               ///< cols of cluster
+                                                   ///< search
+     std::vector<int> abstractPath;                ///< abstract nodes
+     std::vector<int> localPath;                   ///< cluster search
+                                                   ///< path
+
+
+     /**
+      *   @brief  Get cell id of map row and column
+      *
+      *   @param  row in int
+      *   @param  column in int
+      *   @return cell id in int
+     */
+     int cellId(int, int);
+
+
+     /**
+      *   @brief  Get cluster of a cell
+      *
+      *   @param  cell id in int
+      *   @return cluster index in int
+     */
+     int getCluster(int);
+
+
+     /**
+      *   @brief  Get cost of moving between two adjacent cells
+      *
+      *   @param  start cell id in int
+      *   @param  end cell id in int
+      *   @return move cost in double
+     */
+     double getMoveCost(int, int);
+
+
+     /**
+      *   @brief  Connect two adjacent cells in different clusters,
+      *           adding abstract nodes as needed
+      *
+      *   @param  cell id in int
+      *   @param  cell id in int
+      *   @return none
+     */
+     void addTransition(int, int);
+
+
+     /**
+      *   @brief  Add transitions across one border between clusters
+      *
+      *   @param  true for border between left and right clusters,
+      *           false for border between upper and lower clusters
+      *   @param  first row (or column) along border in int
+      *   @param  one past last row (or column) along border in int
+      *   @param  last column (or row) before border in int
+      *   @return none
+     */
+     void addBorderTransitions(bool, int, int, int);
+
+
+     /**
+      *   @brief  Search from a cell inside its cluster
+      *
+      *   @param  true to follow edges backward
+      *   @param  start cell id in int
+      *   @param  goal cell id in int, -1 to reach every cell
+      *   @param  weight of heuristic function in double
+      *   @param  reference to number of expanded nodes
+      *   @return true if goal is reached, false otherwise.  Costs are
+      *           read with getLocalCost.
+     */
+     bool searchCluster(bool, int, int, double, int&);
+
+
+     /**
+      *   @brief  Search from start to goal inside the rectangle of
+      *           their clusters, which must be the same or neighbors,
+      *           and the clusters around it
+      *
+      *   @param  start cell id in int
+      *   @param  goal cell id in int
+      *   @param  weight of heuristic function in double
+      *   @param  reference to number of expanded nodes
+      *   @return true if goal is reached, false otherwise.  Costs are
+      *           read with getLocalCost.
+     */
+     bool searchDirect(int, int, double, int&);
+
+
+     /**
+      *   @brief  Set search window to the rectangle of two clusters,
+      *           grown by a number of clusters on each side and
+      *           clipped to the map
+      *
+      *   @param  first cluster index in int
+      *   @param  second cluster index in int
+      *   @param  number of clusters added on each side in int
+      *   @return none
+     */
+     void setWindow(int, int, int);
+
+
+     /**
+      *   @brief  Get cost from last cluster search start to a cell
+      *
+      *   @param  cell id in int, must be in searched cluster
+      *   @return cost in double, infinity if not reached
+     */
+     double getLocalCost(int);
+
+
+     /**
+      *   @brief  Shorten path by replacing parts of it with straight or
+      *           diagonal runs of cells that cost less
+      *
+      *   @param  reference to vector int of cell ids
+      *   @return none
+     */
+     void smoothPath(std::vector<int>&);
+
+
+     /**
+      *   @brief  Compute heuristic cost between two cells using octile
+      *           distance with 1.5 diagonal cost
+      *
+      *   @param  start cell id in int
+      *   @param  end cell id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int);
+};
+
+#endif  // INCLUDE_HPAALGORITHM_HPP_
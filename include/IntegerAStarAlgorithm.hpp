@@ -0,0 +1,109 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file IntegerAStarAlgorithm.hpp
+ *  @brief Definition of class IntegerAStarAlgorithm
+ *
+ *  This file contains definitions and prototypes of class
+ *  IntegerAStarAlgorithm, an A star search over fixed-point integer
+ *  costs with a radix heap as open set.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_INTEGERASTARALGORITHM_HPP_
+#define INCLUDE_INTEGERASTARALGORITHM_HPP_
+
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+
+
+/**
+ *  @brief Class definition of IntegerAStarAlgorithm class which is
+ *         derived from base class PathFindingAlgorithm for path
+ *         planning.
+ *
+ *  Edge costs are whole cell costs times 1 or 1.5, so scaled by 2
+ *  every cost is an integer and sums are exact.  Keys of the open set
+ *  are integers as well, which lets it be a monotone radix heap.
+ *  getTotalCost is the integer cost divided by 2, equal to the cost
+ *  found by AStarAlgorithm.
+*/
+class IntegerAStarAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of IntegerAStarAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     IntegerAStarAlgorithm() {}
+
+
+     /**
+      *   @brief  Deconstructor of IntegerAStarAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~IntegerAStarAlgorithm() {}
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices, and weight for heuristic estimates.  Weights
+      *           above 1 would make keys non-monotone, which the radix
+      *           heap cannot order, so they are rejected.
+      *
+      *   @param  weight of heuristic function in double, at most 1
+      *   @return true if shortest path can be found, false if weight
+      *           is above 1 or no path exists
+     */
+     bool computPath(double);
+
+
+     ///< factor turning edge costs into integers
+     static const int costScale = 2;
+
+ private:
+     ///< integer cost, parent, open and closed sets of current search
+     SearchContext<RadixHeap> context;
+
+
+     /**
+      *   @brief  Compute heuristic cost between start and end nodes
+      *           using euclidean distance, scaled and rounded down to
+      *           an integer so it stays consistent
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @param  weight of heuristic function in double
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int, double) const;
+};
+
+#endif  // INCLUDE_INTEGERASTARALGORITHM_HPP_
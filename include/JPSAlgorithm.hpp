@@ -0,0 +1,164 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file JPSAlgorithm.hpp
+ *  @brief Definition of class JPSAlgorithm
+ *
+ *  This file contains definitions and prototypes of class JPSAlgorithm,
+ *  a Jump Point Search over the 8-connected map grid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_JPSALGORITHM_HPP_
+#define INCLUDE_JPSALGORITHM_HPP_
+
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "GridGraph.hpp"
+
+
+/**
+ *  @brief Class definition of JPSAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning.
+ *
+ *  On maps where every passable cell has the same cost, symmetric
+ *  paths are pruned and only jump points are pushed into the open set.
+ *  Diagonal moves cost 1.5x a straight move and may cut corners, as
+ *  in the graph built by PathFindingAlgorithm, so the total cost is
+ *  the same as A star's.  Maps with varying cell costs fall back to
+ *  A star over the same grid.
+*/
+class JPSAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of JPSAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     JPSAlgorithm() : minCost(0), uniform(false) {}
+
+
+     /**
+      *   @brief  Deconstructor of JPSAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~JPSAlgorithm() {}
+
+
+     /**
+      *   @brief  Build padded cell array from map and check if cell
+      *           costs are uniform.  No edge is generated.
+      *
+      *   @param  none
+      *   @return true if grid is built, false if map is 4-connected or
+      *           grid cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Compute shortest path using given start, goal nodes
+      *           indices, and weight for heuristic estimates
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if shortest path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Check if last built map can be searched by jumping
+      *
+      *   @param  none
+      *   @return true if every passable cell has the same cost,
+      *           false if computPath falls back to A star
+     */
+     bool isUniform()
+                { return uniform; }
+
+ private:
+     GridGraph<8> grid;                     ///< padded cell array
+     int minCost;                           ///< lowest passable cell cost
+     bool uniform;                          ///< all passable cells have
+                                            ///< the same cost
+
+     ///< cost, parent, open and closed sets of the current search
+     SearchContext<BinaryHeap> context;
+
+
+     /**
+      *   @brief  Search jump points from start to goal
+      *
+      *   @param  start node id in int
+      *   @param  goal node id in int
+      *   @param  weight of heuristic function in double
+      *   @return true if goal is reached, false otherwise
+     */
+     bool jumpSearch(int, int, double);
+
+
+     /**
+      *   @brief  Walk from a node in one direction until a jump point,
+      *           the goal, or an obstacle is reached
+      *
+      *   @param  node id to jump from in int
+      *   @param  column step of direction in int, -1, 0, or 1
+      *   @param  row step of direction in int, -1, 0, or 1
+      *   @param  goal node id in int
+      *   @param  reference to number of steps taken
+      *   @return id of jump point in int, -1 if there is none
+     */
+     int jump(int, int, int, int, int&);
+
+
+     /**
+      *   @brief  Check if a node reached by moving in a direction has
+      *           a forced neighbor
+      *
+      *   @param  node id in int
+      *   @param  column step of direction in int, -1, 0, or 1
+      *   @param  row step of direction in int, -1, 0, or 1
+      *   @return true if node has a forced neighbor, false otherwise
+     */
+     bool hasForcedNeighbor(int, int, int);
+
+
+     /**
+      *   @brief  Compute heuristic cost between start and end nodes
+      *           using octile distance with 1.5 diagonal cost
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int);
+};
+
+#endif  // INCLUDE_JPSALGORITHM_HPP_
@@ -0,0 +1,207 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file Landmarks.hpp
+ *  @brief Definition of class Landmarks
+ *
+ *  This file contains definitions and prototypes of class Landmarks,
+ *  which stores shortest path costs from and to a few landmark nodes
+ *  and derives A star heuristics from them with the triangle
+ *  inequality (ALT).
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_LANDMARKS_HPP_
+#define INCLUDE_LANDMARKS_HPP_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "Graph.hpp"
+
+
+/**
+ *  @brief Class that selects landmark nodes of a graph, stores costs
+ *         from every landmark to every node and from every node to
+ *         every landmark, and gives lower bounds of shortest path
+ *         costs between any two nodes
+ *
+ *  Costs are kept as float, node by node, so a lower bound reads two
+ *  short contiguous rows.  Costs of a grid map are multiples of 0.5,
+ *  which float holds exactly up to 2^23.
+*/
+class Landmarks {
+ public:
+     /**
+      *  @brief Landmark selection strategy
+     */
+     enum Strategy {
+          FARTHEST,                         ///< node farthest from the
+                                            ///< landmarks chosen so far
+          AVOID                             ///< leaf of the shortest path
+                                            ///< tree from a random node
+                                            ///< whose branch is covered
+                                            ///< worst by current bounds
+     };
+
+
+     /**
+      *   @brief  Constructor of Landmarks class
+      *
+      *   @param  none
+      *   @return none
+     */
+     Landmarks() : numNodes(0), numEdges(0), fingerprint(0),
+                   preprocessTime(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of Landmarks class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~Landmarks() {}
+
+
+     /**
+      *   @brief  Select landmarks of graph and compute their cost tables.
+      *           Selection is sequential, as each landmark depends on
+      *           the previous ones; tables of costs to landmarks are
+      *           then computed in parallel, one landmark per task.
+      *
+      *   @param  reference to graph
+      *   @param  number of landmarks in int
+      *   @param  selection strategy
+      *   @param  number of worker threads in int, 0 for one per
+      *           hardware thread
+      *   @return none
+     */
+     void build(const Graph&, int, Strategy, int numThreads = 0);
+
+
+     /**
+      *   @brief  Write landmarks and cost tables to a binary file
+      *
+      *   @param  file path in string
+      *   @return true if file is written, false otherwise
+     */
+     bool save(const std::string&) const;
+
+
+     /**
+      *   @brief  Read landmarks and cost tables written by save
+      *
+      *   @param  file path in string
+      *   @param  reference to graph the tables must belong to
+      *   @return true if tables are read, false if file cannot be read,
+      *           is shorter than its landmark count needs, or was built
+      *           for a graph of another size, obstacles or edge costs
+     */
+     bool load(const std::string&, const Graph&);
+
+
+     /**
+      *   @brief  Get lower bound of shortest path cost between two nodes
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return lower bound in double, infinity if end cannot be
+      *           reached from start
+     */
+     double getLowerBound(int from, int to) const {
+         int k = getNumLandmarks();
+         const float *s = &table[static_cast<size_t>(from) * 2 * k];
+         const float *t = &table[static_cast<size_t>(to) * 2 * k];
+         float bound = 0;
+
+         for (int i = 0; i < 2 * k; i += 2) {
+             // d(L, to) - d(L, from) and d(from, L) - d(to, L); a NaN
+             // from two unreachable costs fails both comparisons
+             float a = t[i] - s[i];
+             float b = s[i + 1] - t[i + 1];
+
+             if (a > bound)
+                 bound = a;
+             if (b > bound)
+                 bound = b;
+         }
+
+         return bound;
+     }
+
+
+     /**
+      *   @brief  Get number of landmarks
+      *
+      *   @param  none
+      *   @return number of landmarks in int
+     */
+     int getNumLandmarks(void) const
+                { return static_cast<int>(landmarks.size()); }
+
+
+     /**
+      *   @brief  Get node id of a landmark
+      *
+      *   @param  landmark number in int
+      *   @return node id in int
+     */
+     int getLandmark(int i) const { return landmarks[i]; }
+
+
+     /**
+      *   @brief  Get time spent by last build
+      *
+      *   @param  none
+      *   @return preprocessing time in seconds in double
+     */
+     double getPreprocessTime(void) const { return preprocessTime; }
+
+
+     /**
+      *   @brief  Get memory used by cost tables
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const
+                { return table.capacity() * sizeof(float); }
+
+ private:
+     int numNodes;                                 ///< nodes of graph
+     int numEdges;                                 ///< edges of graph
+     uint64_t fingerprint;                         ///< hash of edge costs
+     double preprocessTime;                        ///< seconds of build
+     std::vector<int> landmarks;                   ///< landmark node ids
+     std::vector<float> table;                     ///< for node v and
+                                                   ///< landmark i, cost
+                                                   ///< from i to v at
+                                                   ///< (v * k + i) * 2,
+                                                   ///< from v to i next
+};
+
+#endif  // INCLUDE_LANDMARKS_HPP_
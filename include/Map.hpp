@@ -34,6 +34,9 @@
 #ifndef INCLUDE_MAP_HPP_
 #define INCLUDE_MAP_HPP_
 
+#include <stddef.h>
+#include <stdint.h>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -41,6 +44,11 @@
 /**
  *  @brief Class definition of Map used for keeping map
  *         information for path planning.
+ *
+ *  Obstacles are kept as one bit per cell.  Cell costs are kept in a
+ *  one byte per cell layer which is only allocated once a cell costs
+ *  more than 1.  Both are read in place from a memory mapped file when
+ *  the map is loaded from the binary format.
 */
 class Map {
  public:
@@ -51,7 +59,9 @@ class Map {
       *   @return none
      */
      Map() : startIdx(0), goalIdx(0),
-             row(0), col(0), numDir(8),
+             row(0), col(0), numDir(8), numDirSet(false), numThreads(0),
+             obstacleData(nullptr), costData(nullptr),
+             mapping(nullptr), mappingSize(0),
              moveDirection {-1, -1,              ///< top left
                              0, -1,              ///< up
                              1, -1,              ///< top right
@@ -69,17 +79,40 @@ class Map {
       *   @param  none
       *   @return none
      */
-     ~Map() {}
+     ~Map() { unmap(); }
 
      /**
       *   @brief  Read map info from csv file and store
-      *           in mapArray
+      *           obstacle bits and costs.  Cells are 'o' or 'O' for
+      *           obstacle or a cost in [1, 255].  Large files are
+      *           parsed in parallel.  Files starting with the binary
+      *           map header are opened with openMap instead.
       *  
       *   @param  input file path in string
-      *   @return true is reading map is successful, false otherwise
+      *   @return true is reading map is successful, false if file
+      *           cannot be read, has no cells, has a cell that is not
+      *           valid, or has rows of different lengths
      */
      bool createMap(std::string);
 
+     /**
+      *   @brief  Open binary map file.  Cells are memory mapped rather
+      *           than copied, so pages are shared by processes opening
+      *           the same file.  Cell changes stay private to the map.
+      *
+      *   @param  input file path in string
+      *   @return true if file is a valid binary map, false otherwise
+     */
+     bool openMap(std::string);
+
+     /**
+      *   @brief  Write map cells in binary map format
+      *
+      *   @param  output file path in string
+      *   @return true if file is written, false otherwise
+     */
+     bool saveBinaryMap(std::string) const;
+
      /**
       *   @brief  Output map including start, goal, and
       *           shortest path to a csv file
@@ -147,12 +180,97 @@ class Map {
 
 
      /**
-      *   @brief  Get map array
+      *   @brief  Set number of moving directions of a node
+      *
+      *   @param  4 to move straight only, 8 to move diagonally too
+      *   @return true if number is 4 or 8, false otherwise
+     */
+     bool setNumDir(int);
+
+
+     /**
+      *   @brief  Check if number of moving directions is stored in a
+      *           binary map or set by setNumDir, rather than the
+      *           default of csv maps
+      *
+      *   @param  none
+      *   @return true if number of directions is given, false otherwise
+     */
+     bool hasNumDir(void) const { return numDirSet; }
+
+
+     /**
+      *   @brief  Set number of threads parsing csv files
+      *
+      *   @param  number of threads in int, 0 for one per hardware
+      *           thread
+      *   @return none
+     */
+     void setNumThreads(int n) { numThreads = n; }
+
+
+     /**
+      *   @brief  Check if cells are read from a memory mapped file
+      *
+      *   @param  none
+      *   @return true if map is memory mapped, false otherwise
+     */
+     bool isMapped(void) const { return mapping != nullptr; }
+
+
+     /**
+      *   @brief  Check if cell is an obstacle
+      *
+      *   @param  map index (1 based) in int, within map
+      *   @return true if cell is an obstacle, false otherwise
+     */
+     bool isBlocked(int index) const {
+         return (obstacleData[(index - 1) / 64] >> ((index - 1) % 64)) & 1;
+     }
+
+
+     /**
+      *   @brief  Get cost of moving into a cell
+      *
+      *   @param  map index (1 based) in int, within map
+      *   @return cell cost in int, max int for obstacle
+     */
+     int getCost(int index) const {
+         if (isBlocked(index))
+             return std::numeric_limits<int>::max();
+
+         return costData ? costData[index - 1] : 1;
+     }
+
+
+     /**
+      *   @brief  Change cost of a cell
+      *
+      *   @param  map index (1 based) in int, within map
+      *   @param  cell cost in int, [1, 255] or max int for obstacle
+      *   @return true if cost is set, false if it does not fit in one
+      *           byte
+     */
+     bool setCost(int, int);
+
+
+     /**
+      *   @brief  Check if any cell costs more than 1
+      *
+      *   @param  none
+      *   @return true if cost layer is allocated, false otherwise
+     */
+     bool hasCostLayer(void) const { return costData != nullptr; }
+
+
+     /**
+      *   @brief  Get memory used by obstacle bits and cost layer,
+      *           including mapped file
       *
       *   @param  none
-      *   @return pointer to vector int of map array
+      *   @return number of bytes in size_t
      */
-     std::vector<int>* getMap(void) { return &mapArray; }
+     size_t getMemoryUsage(void) const;
 
 
      /**
@@ -171,11 +289,31 @@ class Map {
      int col;                                      ///< number of cols in map
      int numDir;                                   ///< number of direction
                                                    ///< a node can move
-
-     std::vector<int> mapArray;                    ///< 2D map array
+     bool numDirSet;                               ///< numDir not default
+     int numThreads;                               ///< threads parsing
+                                                   ///< csv files
+
+     std::vector<uint64_t> obstacles;              ///< 1 bit per cell, set
+                                                   ///< for obstacle
+     std::vector<uint8_t> costs;                   ///< cost of each cell,
+                                                   ///< empty if all cost 1
+     uint64_t *obstacleData;                       ///< obstacle bits, in
+                                                   ///< obstacles or mapping
+     uint8_t *costData;                            ///< cell costs, nullptr
+                                                   ///< if all cost 1
+     void *mapping;                                ///< mapped binary file
+     size_t mappingSize;                           ///< bytes mapped
 
      int moveDirection[16];                        ///< moving direction
 
+     /**
+      *   @brief  Release mapped file and owned cells
+      *
+      *   @param  none
+      *   @return none
+     */
+     void unmap(void);
+
      /**
       *   @brief  Check if index is in shortest path
       *  
@@ -185,6 +323,10 @@ class Map {
       *           false otherwise
      */
      bool isInPath(int, std::vector<int>&);
+
+     // cells may point into the map itself
+     Map(const Map&) = delete;
+     Map& operator=(const Map&) = delete;
 };
 
 
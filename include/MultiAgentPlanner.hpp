@@ -0,0 +1,225 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file MultiAgentPlanner.hpp
+ *  @brief Definition of class MultiAgentPlanner
+ *
+ *  This file contains definitions and prototypes of class
+ *  MultiAgentPlanner, a prioritized planner that gives many agents
+ *  paths on one map without vertex or edge conflicts.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_MULTIAGENTPLANNER_HPP_
+#define INCLUDE_MULTIAGENTPLANNER_HPP_
+
+#include <stdint.h>
+#include <vector>
+#include "PathFindAlgorithm.hpp"
+#include "GridGraph.hpp"
+#include "ReservationTable.hpp"
+
+
+/**
+ *  @brief Start and goal of one agent as map indices
+*/
+struct AgentTask {
+     int start;                                    ///< start map index
+     int goal;                                     ///< goal map index
+};
+
+
+/**
+ *  @brief Class definition of MultiAgentPlanner class which is derived
+ *         from base class PathFindingAlgorithm for planning many
+ *         agents at once.
+ *
+ *  Agents are planned one by one in the given order.  Each runs
+ *  space-time A* over (cell, timestep) on the 4-connected grid, where
+ *  every step is a move to a neighbor or a wait, and must avoid what
+ *  earlier agents reserved: the cell they occupy at each timestep,
+ *  the moves they make (so no two agents swap cells), and their goal
+ *  cell from arrival on, since agents stay at their goal.  Cell costs
+ *  other than obstacles are ignored; every step takes one timestep.
+*/
+class MultiAgentPlanner : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of MultiAgentPlanner class
+      *
+      *   @param  none
+      *   @return none
+     */
+     MultiAgentPlanner() : horizon(0), lastTime(-1) {}
+
+
+     /**
+      *   @brief  Deconstructor of MultiAgentPlanner class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~MultiAgentPlanner() {}
+
+
+     /**
+      *   @brief  Build padded cell array from map.  Csv maps are
+      *           taken as 4-connected.
+      *
+      *   @param  none
+      *   @return true if grid is built, false if map is 8-connected or
+      *           grid cannot be built
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Set last timestep an agent may need to reach its goal
+      *
+      *   @param  horizon in int, 0 for twice the number of rows plus
+      *           columns plus the number of agents
+      *   @return none
+     */
+     void setHorizon(int steps) { horizon = steps; }
+
+
+     /**
+      *   @brief  Get horizon set by setHorizon
+      *
+      *   @param  none
+      *   @return horizon in int, 0 if chosen per call
+     */
+     int getHorizon(void) const { return horizon; }
+
+
+     /**
+      *   @brief  Plan agents in priority order, first agent first.
+      *           Total cost is set to the sum of arrival timesteps and
+      *           number of expanded nodes to the sum over all agents.
+      *
+      *   @param  reference to agent tasks
+      *   @param  reference to paths, one per task; path i holds the
+      *           map index of agent i at timesteps 0 to its arrival,
+      *           and is empty if the agent has an invalid start or
+      *           goal or no conflict free path within horizon.  Such
+      *           agents reserve nothing.
+      *   @return number of agents with a path in int
+     */
+     int planAgents(const std::vector<AgentTask>&,
+                    std::vector<std::vector<int>>&);
+
+ private:
+     /**
+      *  @brief State of space-time search
+     */
+     struct State {
+          int id;                                  ///< node id
+          int time;                                ///< timestep
+          int parent;                              ///< parent state, -1
+                                                   ///< for start
+     };
+
+     GridGraph<4> grid;                            ///< padded cell array
+     int horizon;                                  ///< last timestep,
+                                                   ///< 0 for automatic
+     int lastTime;                                 ///< last reserved
+                                                   ///< timestep
+     ReservationTable vertexTable;                 ///< (cell, time) taken
+     ReservationTable edgeTable;                   ///< (cell, move, time)
+                                                   ///< taken
+     ReservationTable closedSet;                   ///< expanded states
+     std::vector<int> parkedFrom;                  ///< time from which an
+                                                   ///< agent stays at cell
+     std::vector<int> lastReserved;                ///< last reserved time
+                                                   ///< of cell, -1 if none
+     std::vector<int> distance;                    ///< steps to goal
+                                                   ///< ignoring agents
+     std::vector<int> parkedDistance;              ///< steps to goal
+                                                   ///< around parked agents
+     std::vector<State> states;                    ///< generated states
+     std::vector<int> queue;                       ///< breadth first queue
+
+
+     /**
+      *   @brief  Plan one agent against current reservations
+      *
+      *   @param  start node id in int
+      *   @param  goal node id in int
+      *   @param  last timestep in int
+      *   @param  reference to path of map indices per timestep
+      *   @return true if a path is found, false otherwise
+     */
+     bool planAgent(int, int, int, std::vector<int>&);
+
+
+     /**
+      *   @brief  Reserve cells and moves of a path and park agent at
+      *           its last cell
+      *
+      *   @param  reference to path of node ids per timestep
+      *   @return none
+     */
+     void reservePath(const std::vector<int>&);
+
+
+     /**
+      *   @brief  Compute steps from every cell to goal by breadth first
+      *           search
+      *
+      *   @param  goal node id in int
+      *   @param  true to treat cells of parked agents as obstacles
+      *   @param  reference to steps per node id, -1 if unreachable
+      *   @return none
+     */
+     void computeDistance(int, bool, std::vector<int>&);
+
+
+     /**
+      *   @brief  Check if a cell is free at a timestep
+      *
+      *   @param  node id in int
+      *   @param  timestep in int
+      *   @return true if no agent holds cell at time, false otherwise
+     */
+     bool isFree(int id, int time) const {
+         return (time < parkedFrom[id]) &&
+                !vertexTable.contains(getKey(id, time));
+     }
+
+
+     /**
+      *   @brief  Get key of a node at a timestep
+      *
+      *   @param  node id in int
+      *   @param  timestep in int
+      *   @return key in uint64_t
+     */
+     uint64_t getKey(int id, int time) const {
+         return static_cast<uint64_t>(time) * grid.getNumNodes() + id;
+     }
+};
+
+#endif  // INCLUDE_MULTIAGENTPLANNER_HPP_
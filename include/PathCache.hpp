@@ -0,0 +1,297 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PathCache.hpp
+ *  @brief Definition of class PathCache
+ *
+ *  This file contains definitions and prototypes of class PathCache,
+ *  a thread safe least recently used cache of path search results
+ *  tied to a version of the map they were computed on.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_PATHCACHE_HPP_
+#define INCLUDE_PATHCACHE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "PathQuery.hpp"
+
+
+/**
+ *  @brief Class that keeps results of path searches keyed by start,
+ *         goal, heuristic weight and map version, within a memory
+ *         budget.
+ *
+ *  The cache follows one map version, which identifies the map and
+ *  the cell changes made to it, so searches of different maps
+ *  sharing a cache never see results of each other.  When cells of the map change, only
+ *  results whose path crosses a changed cell are dropped if no cell
+ *  got cheaper, since raising costs elsewhere cannot make another
+ *  path better.  A cell that got cheaper may open a better path for
+ *  any query, so every result is dropped.  Remaining results move on
+ *  to the new map version.  All methods may be called from several
+ *  threads at once.
+*/
+class PathCache {
+ public:
+     /**
+      *   @brief  Constructor of PathCache class
+      *
+      *   @param  memory budget in bytes, counting paths and bookkeeping
+      *   @return none
+     */
+     explicit PathCache(size_t maxBytes = 1 << 20);
+
+
+     /**
+      *   @brief  Deconstructor of PathCache class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~PathCache() {}
+
+
+     /**
+      *   @brief  Look up result of a query and mark it most recently
+      *           used
+      *
+      *   @param  reference to query
+      *   @param  map version the caller searches
+      *   @param  reference to result, filled on hit
+      *   @return true if result is cached, false otherwise
+     */
+     bool find(const PathQuery&, uint64_t, PathResult&);
+
+
+     /**
+      *   @brief  Add result of a query, evicting least recently used
+      *           results until it fits in the memory budget.  Results
+      *           of another map version than the cache follows, or
+      *           larger than the whole budget, are not kept.
+      *
+      *   @param  reference to query
+      *   @param  map version the result was computed on
+      *   @param  reference to result
+      *   @return none
+     */
+     void insert(const PathQuery&, uint64_t, const PathResult&);
+
+
+     /**
+      *   @brief  Move cache to a map version built from another map.
+      *           Every result is dropped unless the cache already
+      *           follows that version.
+      *
+      *   @param  map version
+      *   @return none
+     */
+     void follow(uint64_t);
+
+
+     /**
+      *   @brief  Move cache to a new map version after cells changed.
+      *           Calls with a version the cache already follows are
+      *           ignored, so several searches sharing the cache can
+      *           report the same change.  Every result is dropped if
+      *           the cache did not follow the old version.
+      *
+      *   @param  reference to changed map indices
+      *   @param  true if any changed cell got cheaper
+      *   @param  map version before the change
+      *   @param  map version after the change
+      *   @return none
+     */
+     void invalidate(const std::vector<int>&, bool, uint64_t, uint64_t);
+
+
+     /**
+      *   @brief  Drop every result.  Counters are kept.
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clear(void);
+
+
+     /**
+      *   @brief  Get map version the cache follows
+      *
+      *   @param  none
+      *   @return map version in uint64_t
+     */
+     uint64_t getVersion(void) const;
+
+
+     /**
+      *   @brief  Get number of cached results
+      *
+      *   @param  none
+      *   @return number of results in size_t
+     */
+     size_t getNumEntries(void) const;
+
+
+     /**
+      *   @brief  Get number of lookups answered from cache
+      *
+      *   @param  none
+      *   @return number of hits in uint64_t
+     */
+     uint64_t getNumHits(void) const;
+
+
+     /**
+      *   @brief  Get number of lookups not answered from cache
+      *
+      *   @param  none
+      *   @return number of misses in uint64_t
+     */
+     uint64_t getNumMisses(void) const;
+
+
+     /**
+      *   @brief  Get fraction of lookups answered from cache
+      *
+      *   @param  none
+      *   @return hit rate in [0, 1], 0 before first lookup
+     */
+     double getHitRate(void) const;
+
+
+     /**
+      *   @brief  Get number of results dropped to stay within memory
+      *           budget
+      *
+      *   @param  none
+      *   @return number of evictions in uint64_t
+     */
+     uint64_t getNumEvictions(void) const;
+
+
+     /**
+      *   @brief  Get number of results dropped because map changed
+      *
+      *   @param  none
+      *   @return number of invalidated results in uint64_t
+     */
+     uint64_t getNumInvalidated(void) const;
+
+
+     /**
+      *   @brief  Get memory counted against the budget
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const;
+
+
+     /**
+      *   @brief  Get memory budget
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMaxBytes(void) const { return maxBytes; }
+
+ private:
+     /**
+      *  @brief Start, goal and weight of a cached query
+     */
+     struct Key {
+          int start;                               ///< start index
+          int goal;                                ///< goal index
+          double weight;                           ///< weight of heuristic
+
+          /**
+           *   @brief  Check if keys are equal
+           *
+           *   @param  reference to other key
+           *   @return true if all fields are equal, false otherwise
+          */
+          bool operator==(const Key &other) const {
+              return (start == other.start) && (goal == other.goal) &&
+                     (weight == other.weight);
+          }
+     };
+
+     /**
+      *  @brief Hash of a key
+     */
+     struct KeyHash {
+          /**
+           *   @brief  Compute hash of key
+           *
+           *   @param  reference to key
+           *   @return hash value in size_t
+          */
+          size_t operator()(const Key&) const;
+     };
+
+     /**
+      *  @brief Cached result with its key and range of path indices
+     */
+     struct Entry {
+          Key key;                                 ///< query of result
+          PathResult result;                       ///< cached result
+          int minIndex;                            ///< lowest index in path
+          int maxIndex;                            ///< highest index in
+                                                   ///< path
+          size_t bytes;                            ///< memory counted
+     };
+
+     typedef std::list<Entry> EntryList;
+
+     const size_t maxBytes;                        ///< memory budget
+     size_t usedBytes;                             ///< memory counted
+     uint64_t version;                             ///< map version
+     uint64_t numHits;                             ///< lookups found
+     uint64_t numMisses;                           ///< lookups not found
+     uint64_t numEvictions;                        ///< dropped for budget
+     uint64_t numInvalidated;                      ///< dropped for changes
+
+     EntryList entries;                            ///< most recently used
+                                                   ///< first
+     std::unordered_map<Key, EntryList::iterator,
+                        KeyHash> lookup;           ///< entry of each key
+     mutable std::mutex mutex;                     ///< guards all members
+
+     /**
+      *   @brief  Drop an entry
+      *
+      *   @param  iterator of entry in entries
+      *   @return iterator of next entry
+     */
+     EntryList::iterator erase(EntryList::iterator);
+};
+
+#endif  // INCLUDE_PATHCACHE_HPP_
@@ -37,9 +37,7 @@
 
 #include <vector>
 #include <string>
-#include <memory>
-#include "Node.hpp"
-#include "Edge.hpp"
+#include "Graph.hpp"
 #include "Map.hpp"
 
 
@@ -60,7 +58,8 @@ class PathFindingAlgorithm {
       *   @param  none
       *   @return none
      */
-     PathFindingAlgorithm() : start(0), goal(0), totalCost(0) {}
+     PathFindingAlgorithm() : start(0), goal(0), totalCost(0),
+                              numExpanded(0) {}
 
 
      /**
@@ -69,10 +68,10 @@ class PathFindingAlgorithm {
       *   @param  none
       *   @return none
      */
-     ~PathFindingAlgorithm() {}
+     virtual ~PathFindingAlgorithm() {}
 
      /**
-      *   @brief  Initialize map and graph node, edges
+      *   @brief  Initialize map and graph
       *
       *   @param  input map file path
       *   @return true if init is successful, false otherwise
@@ -81,24 +80,15 @@ class PathFindingAlgorithm {
 
 
      /**
-      *   @brief  Build graph by storing map info into nodes 
-      *           and edges for finding shortest path
+      *   @brief  Build graph by storing map info into compressed
+      *           sparse row nodes and edges for finding shortest path.
+      *           Algorithms that search the map directly override
+      *           this to build their own representation.
       *  
       *   @param  none
-      *   @return none
-     */
-     void buildGraph();
-
-
-     /**
-      *   @brief  Reconstruct graph by traversing from goal to start via
-      *           parentIndex of nodes and store the path indices in member
-      *           path which is a vector of integers
-      *
-      *   @param  reference to pointer of goal node
-      *   @return none
+      *   @return true if graph is built, false otherwise
      */
-     void reconstructPath(std::shared_ptr<Node> &);
+     virtual bool buildGraph();
 
 
      /**
@@ -162,16 +152,45 @@ class PathFindingAlgorithm {
                 { return totalCost; }
 
 
+     /**
+      *   @brief  Get number of nodes expanded by last path search
+      *
+      *   @param  none
+      *   @return number of expanded nodes in int
+     */
+     int getNumExpanded()
+                { return numExpanded; }
+
+
+     /**
+      *   @brief  Get graph built from map
+      *
+      *   @param  none
+      *   @return const reference to graph
+     */
+     const Graph& getGraph()
+                { return graph; }
+
+
  protected:
-     std::vector<std::shared_ptr<Node>> nodes;           ///< vector of nodes
-     std::vector<std::shared_ptr<Edge>> edges;           ///< vector of edges
+     Graph graph;                           ///< nodes and edges of map
      int start;                             ///< start index
      int goal;                              ///< goal index
      double totalCost;                      ///< cost of shortest path
+     int numExpanded;                       ///< nodes expanded by search
      std::vector<int> path;                 ///< indices of shortest path
-
- private:
      Map map;                               ///< map info
+
+
+     /**
+      *   @brief  Check if index is within map and not an obstacle.
+      *           Unlike setParam, start and goal are not changed.
+      *
+      *   @param  node index in int
+      *   @return true if node can be used as start or goal, false
+      *           otherwise
+     */
+     bool isPassable(int);
 };
 
 #endif  // INCLUDE_PATHFINDALGORITHM_HPP_
@@ -0,0 +1,61 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PathQuery.hpp
+ *  @brief Definition of structs PathQuery and PathResult
+ *
+ *  This file contains definitions of the query and result of one path
+ *  search, used by APIs that answer many queries at once.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_PATHQUERY_HPP_
+#define INCLUDE_PATHQUERY_HPP_
+
+#include <vector>
+
+
+/**
+ *  @brief Start, goal and heuristic weight of one path search
+*/
+struct PathQuery {
+     int start;                             ///< start index
+     int goal;                              ///< goal index
+     double weight;                         ///< weight of heuristic
+};
+
+
+/**
+ *  @brief Result of one path search
+*/
+struct PathResult {
+     bool found;                            ///< shortest path is found
+     double totalCost;                      ///< cost of shortest path
+     int numExpanded;                       ///< nodes expanded by search
+     std::vector<int> path;                 ///< indices of shortest path
+};
+
+#endif  // INCLUDE_PATHQUERY_HPP_
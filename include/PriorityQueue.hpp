@@ -0,0 +1,778 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PriorityQueue.hpp
+ *  @brief Definition of indexed priority queues used as open set
+ *
+ *  This file contains the priority queues that path finding algorithms
+ *  can plug in as their open set.  All queues are indexed by node id
+ *  (0 based) and keep a per-node handle so membership checks are O(1)
+ *  and keys can be decreased in place.
+ *
+ *  - IndexedHeap<D>: implicit d-ary heap (BinaryHeap, QuaternaryHeap)
+ *  - PairingHeap: pairing heap with two-pass pop
+ *  - RadixHeap: monotone radix heap for integer keys
+ *
+ *  Every queue provides the same interface so it can be used as a
+ *  policy parameter (see BasicAStarAlgorithm).
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_PRIORITYQUEUE_HPP_
+#define INCLUDE_PRIORITYQUEUE_HPP_
+
+#include <stdint.h>
+#include <vector>
+
+
+/**
+ *  @brief Indexed d-ary min heap with decrease-key.  The position
+ *         of each node in the heap array is kept in a handle vector
+ *         indexed by node id.  Key may be any type ordered by
+ *         operator<, e.g. std::pair for lexicographic keys.
+*/
+template <int D, class Key = double>
+class IndexedHeap {
+ public:
+     /**
+      *   @brief  Constructor of IndexedHeap class
+      *
+      *   @param  none
+      *   @return none
+     */
+     IndexedHeap() {}
+
+
+     /**
+      *   @brief  Make room for node ids in [0, n).  Existing entries
+      *           are kept and no memory is released.
+      *
+      *   @param  number of node ids in int
+      *   @return none
+     */
+     void resize(int n) {
+         if (n > static_cast<int>(pos.size()))
+             pos.resize(n, -1);
+     }
+
+
+     /**
+      *   @brief  Check if heap is empty
+      *
+      *   @param  none
+      *   @return true if heap has no element, false otherwise
+     */
+     bool empty(void) const { return heap.empty(); }
+
+
+     /**
+      *   @brief  Get number of elements in heap
+      *
+      *   @param  none
+      *   @return number of elements in int
+     */
+     int size(void) const { return static_cast<int>(heap.size()); }
+
+
+     /**
+      *   @brief  Check if node is in heap
+      *
+      *   @param  node id in int
+      *   @return true if node is in heap, false otherwise
+     */
+     bool contains(int id) const { return pos[id] >= 0; }
+
+
+     /**
+      *   @brief  Insert node with given key
+      *
+      *   @param  node id in int, must not be in heap
+      *   @param  key
+      *   @return none
+     */
+     void push(int id, Key key) {
+         heap.push_back(Entry{key, id});
+         siftUp(static_cast<int>(heap.size()) - 1);
+     }
+
+
+     /**
+      *   @brief  Lower the key of a node already in heap
+      *
+      *   @param  node id in int
+      *   @param  new key, must not be greater than current key
+      *   @return none
+     */
+     void decreaseKey(int id, Key key) {
+         heap[pos[id]].key = key;
+         siftUp(pos[id]);
+     }
+
+
+     /**
+      *   @brief  Change the key of a node already in heap
+      *
+      *   @param  node id in int
+      *   @param  new key
+      *   @return none
+     */
+     void update(int id, Key key) {
+         int i = pos[id];
+         bool lower = key < heap[i].key;
+
+         heap[i].key = key;
+         if (lower)
+             siftUp(i);
+         else
+             siftDown(i);
+     }
+
+
+     /**
+      *   @brief  Remove a node from anywhere in heap
+      *
+      *   @param  node id in int, must be in heap
+      *   @return none
+     */
+     void remove(int id) {
+         int i = pos[id];
+         Entry last = heap.back();
+
+         pos[id] = -1;
+         heap.pop_back();
+
+         if (i < static_cast<int>(heap.size())) {
+             heap[i] = last;
+             pos[last.id] = i;
+             siftUp(i);
+             siftDown(pos[last.id]);
+         }
+     }
+
+
+     /**
+      *   @brief  Get node with lowest key
+      *
+      *   @param  none
+      *   @return node id in int
+     */
+     int top(void) const { return heap[0].id; }
+
+
+     /**
+      *   @brief  Get lowest key in heap
+      *
+      *   @param  none
+      *   @return key
+     */
+     Key topKey(void) const { return heap[0].key; }
+
+
+     /**
+      *   @brief  Get key of a node in heap
+      *
+      *   @param  node id in int
+      *   @return key
+     */
+     Key getKey(int id) const { return heap[pos[id]].key; }
+
+
+     /**
+      *   @brief  Remove node with lowest key
+      *
+      *   @param  none
+      *   @return removed node id in int
+     */
+     int pop(void) {
+         int id = heap[0].id;
+         Entry last = heap.back();
+
+         pos[id] = -1;
+         heap.pop_back();
+
+         if (!heap.empty()) {
+             heap[0] = last;
+             siftDown(0);
+         }
+
+         return id;
+     }
+
+
+     /**
+      *   @brief  Remove all elements.  Runs in time proportional to
+      *           number of elements left in heap.
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clear(void) {
+         for (auto& e : heap)
+             pos[e.id] = -1;
+         heap.clear();
+     }
+
+ private:
+     struct Entry {
+         Key key;                                  ///< priority of node
+         int id;                                   ///< node id
+     };
+
+     std::vector<Entry> heap;                      ///< implicit d-ary heap
+     std::vector<int> pos;                         ///< heap slot of node,
+                                                   ///< -1 if not in heap
+
+     void siftUp(int i) {
+         Entry e = heap[i];
+
+         while (i > 0) {
+             int parent = (i - 1) / D;
+             if (!(e.key < heap[parent].key))
+                 break;
+             heap[i] = heap[parent];
+             pos[heap[i].id] = i;
+             i = parent;
+         }
+
+         heap[i] = e;
+         pos[e.id] = i;
+     }
+
+     void siftDown(int i) {
+         Entry e = heap[i];
+         int n = static_cast<int>(heap.size());
+
+         while (true) {
+             int first = D * i + 1;
+             if (first >= n)
+                 break;
+
+             int last = (first + D < n) ? first + D : n;
+             int best = first;
+             for (int c = first + 1; c < last; ++c) {
+                 if (heap[c].key < heap[best].key)
+                     best = c;
+             }
+
+             if (!(heap[best].key < e.key))
+                 break;
+
+             heap[i] = heap[best];
+             pos[heap[i].id] = i;
+             i = best;
+         }
+
+         heap[i] = e;
+         pos[e.id] = i;
+     }
+};
+
+
+typedef IndexedHeap<2> BinaryHeap;                 ///< indexed binary heap
+typedef IndexedHeap<4> QuaternaryHeap;             ///< indexed 4-ary heap
+
+
+/**
+ *  @brief Pairing heap with decrease-key.  Tree links are kept in
+ *         vectors indexed by node id so pushing a node never
+ *         allocates once the heap is sized.
+*/
+class PairingHeap {
+ public:
+     /**
+      *   @brief  Constructor of PairingHeap class
+      *
+      *   @param  none
+      *   @return none
+     */
+     PairingHeap() : root(-1), count(0) {}
+
+
+     /**
+      *   @brief  Make room for node ids in [0, n)
+      *
+      *   @param  number of node ids in int
+      *   @return none
+     */
+     void resize(int n) {
+         if (n > static_cast<int>(keys.size())) {
+             keys.resize(n, 0);
+             child.resize(n, -1);
+             sibling.resize(n, -1);
+             prev.resize(n, -1);
+             inHeap.resize(n, 0);
+         }
+     }
+
+
+     /**
+      *   @brief  Check if heap is empty
+      *
+      *   @param  none
+      *   @return true if heap has no element, false otherwise
+     */
+     bool empty(void) const { return root < 0; }
+
+
+     /**
+      *   @brief  Get number of elements in heap
+      *
+      *   @param  none
+      *   @return number of elements in int
+     */
+     int size(void) const { return count; }
+
+
+     /**
+      *   @brief  Check if node is in heap
+      *
+      *   @param  node id in int
+      *   @return true if node is in heap, false otherwise
+     */
+     bool contains(int id) const { return inHeap[id] != 0; }
+
+
+     /**
+      *   @brief  Insert node with given key
+      *
+      *   @param  node id in int, must not be in heap
+      *   @param  key in double
+      *   @return none
+     */
+     void push(int id, double key) {
+         keys[id] = key;
+         child[id] = -1;
+         sibling[id] = -1;
+         prev[id] = -1;
+         inHeap[id] = 1;
+         ++count;
+
+         root = meld(root, id);
+     }
+
+
+     /**
+      *   @brief  Lower the key of a node already in heap
+      *
+      *   @param  node id in int
+      *   @param  new key in double, must not be greater than current key
+      *   @return none
+     */
+     void decreaseKey(int id, double key) {
+         keys[id] = key;
+
+         if (id == root)
+             return;
+
+         // cut subtree rooted at id and meld it back with root
+         if (child[prev[id]] == id)
+             child[prev[id]] = sibling[id];
+         else
+             sibling[prev[id]] = sibling[id];
+
+         if (sibling[id] >= 0)
+             prev[sibling[id]] = prev[id];
+
+         sibling[id] = -1;
+         prev[id] = -1;
+
+         root = meld(root, id);
+     }
+
+
+     /**
+      *   @brief  Get node with lowest key
+      *
+      *   @param  none
+      *   @return node id in int
+     */
+     int top(void) const { return root; }
+
+
+     /**
+      *   @brief  Get lowest key in heap
+      *
+      *   @param  none
+      *   @return key in double
+     */
+     double topKey(void) const { return keys[root]; }
+
+
+     /**
+      *   @brief  Get key of a node in heap
+      *
+      *   @param  node id in int
+      *   @return key in double
+     */
+     double getKey(int id) const { return keys[id]; }
+
+
+     /**
+      *   @brief  Remove node with lowest key
+      *
+      *   @param  none
+      *   @return removed node id in int
+     */
+     int pop(void) {
+         int id = root;
+
+         inHeap[id] = 0;
+         --count;
+
+         // first pass: meld children pairwise from left to right
+         scratch.clear();
+         int c = child[id];
+         while (c >= 0) {
+             int a = c;
+             int b = sibling[a];
+             c = (b >= 0) ? sibling[b] : -1;
+
+             sibling[a] = -1;
+             prev[a] = -1;
+             if (b >= 0) {
+                 sibling[b] = -1;
+                 prev[b] = -1;
+             }
+
+             scratch.push_back(meld(a, b));
+         }
+
+         // second pass: meld pairs from right to left
+         root = -1;
+         for (auto it = scratch.rbegin(); it != scratch.rend(); ++it)
+             root = meld(root, *it);
+
+         child[id] = -1;
+         return id;
+     }
+
+
+     /**
+      *   @brief  Remove all elements.  Runs in time proportional to
+      *           number of elements left in heap.
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clear(void) {
+         scratch.clear();
+         if (root >= 0)
+             scratch.push_back(root);
+
+         while (!scratch.empty()) {
+             int n = scratch.back();
+             scratch.pop_back();
+             inHeap[n] = 0;
+
+             for (int c = child[n]; c >= 0; c = sibling[c])
+                 scratch.push_back(c);
+         }
+
+         root = -1;
+         count = 0;
+     }
+
+ private:
+     int root;                                     ///< node with lowest key
+     int count;                                    ///< number of elements
+     std::vector<double> keys;                     ///< key of node
+     std::vector<int> child;                       ///< leftmost child
+     std::vector<int> sibling;                     ///< right sibling
+     std::vector<int> prev;                        ///< left sibling, or
+                                                   ///< parent if leftmost
+     std::vector<char> inHeap;                     ///< membership flag
+     std::vector<int> scratch;                     ///< work list for pop
+
+     int meld(int a, int b) {
+         if (a < 0)
+             return b;
+         if (b < 0)
+             return a;
+
+         if (keys[b] < keys[a]) {
+             int t = a;
+             a = b;
+             b = t;
+         }
+
+         // b becomes leftmost child of a
+         sibling[b] = child[a];
+         if (child[a] >= 0)
+             prev[child[a]] = b;
+         prev[b] = a;
+         child[a] = b;
+
+         return a;
+     }
+};
+
+
+/**
+ *  @brief Monotone radix heap with decrease-key for integer keys.
+ *
+ *  Keys are whole numbers up to 2^32 - 1 passed as double, and may
+ *  not be lower than the last popped key, which holds for Dijkstra and
+ *  for A star with a consistent integer heuristic.  A lower key is
+ *  raised to the last popped key and a fractional key is truncated.
+ *  Bucket i > 0 holds keys whose highest bit differing from the last
+ *  popped key is bit i - 1, so push and decrease-key are O(1) and pop
+ *  is O(log C) amortized for largest key difference C, with no key
+ *  comparisons between nodes.
+*/
+class RadixHeap {
+ public:
+     /**
+      *   @brief  Constructor of RadixHeap class
+      *
+      *   @param  none
+      *   @return none
+     */
+     RadixHeap() : last(0), count(0) {}
+
+
+     /**
+      *   @brief  Make room for node ids in [0, n)
+      *
+      *   @param  number of node ids in int
+      *   @return none
+     */
+     void resize(int n) {
+         if (n > static_cast<int>(keys.size())) {
+             keys.resize(n, 0);
+             bucketOf.resize(n, -1);
+             slot.resize(n, -1);
+         }
+     }
+
+
+     /**
+      *   @brief  Check if heap is empty
+      *
+      *   @param  none
+      *   @return true if heap has no element, false otherwise
+     */
+     bool empty(void) const { return count == 0; }
+
+
+     /**
+      *   @brief  Get number of elements in heap
+      *
+      *   @param  none
+      *   @return number of elements in int
+     */
+     int size(void) const { return count; }
+
+
+     /**
+      *   @brief  Check if node is in heap
+      *
+      *   @param  node id in int
+      *   @return true if node is in heap, false otherwise
+     */
+     bool contains(int id) const { return bucketOf[id] >= 0; }
+
+
+     /**
+      *   @brief  Insert node with given key
+      *
+      *   @param  node id in int, must not be in heap
+      *   @param  key in double, not below the last popped key or it
+      *           is raised to that key
+      *   @return none
+     */
+     void push(int id, double key) {
+         keys[id] = toKey(key);
+         insert(id);
+         ++count;
+     }
+
+
+     /**
+      *   @brief  Lower the key of a node already in heap
+      *
+      *   @param  node id in int
+      *   @param  new key in double, must not be greater than current key
+      *   @return none
+     */
+     void decreaseKey(int id, double key) {
+         erase(id);
+         keys[id] = toKey(key);
+         insert(id);
+     }
+
+
+     /**
+      *   @brief  Get node with lowest key
+      *
+      *   @param  none
+      *   @return node id in int
+     */
+     int top(void) {
+         settle();
+         return buckets[0].back();
+     }
+
+
+     /**
+      *   @brief  Get lowest key in heap
+      *
+      *   @param  none
+      *   @return key in double
+     */
+     double topKey(void) {
+         settle();
+         return last;
+     }
+
+
+     /**
+      *   @brief  Get key of a node in heap
+      *
+      *   @param  node id in int
+      *   @return key in double
+     */
+     double getKey(int id) const { return keys[id]; }
+
+
+     /**
+      *   @brief  Remove node with lowest key
+      *
+      *   @param  none
+      *   @return removed node id in int
+     */
+     int pop(void) {
+         settle();
+
+         int id = buckets[0].back();
+         buckets[0].pop_back();
+         bucketOf[id] = -1;
+         --count;
+
+         return id;
+     }
+
+
+     /**
+      *   @brief  Remove all elements and reset last popped key to 0.
+      *           Runs in time proportional to number of elements left
+      *           in heap.
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clear(void) {
+         for (auto& b : buckets) {
+             for (int id : b)
+                 bucketOf[id] = -1;
+             b.clear();
+         }
+
+         last = 0;
+         count = 0;
+     }
+
+ private:
+     static const int numBuckets = 33;             ///< bucket 0 and one per
+                                                   ///< key bit
+
+     std::vector<int> buckets[numBuckets];         ///< node ids by bucket
+     std::vector<uint32_t> keys;                   ///< key of node
+     std::vector<int> bucketOf;                    ///< bucket of node, -1
+                                                   ///< if not in heap
+     std::vector<int> slot;                        ///< index of node in
+                                                   ///< its bucket
+     std::vector<int> scratch;                     ///< work list for pop
+     uint32_t last;                                ///< last popped key
+     int count;                                    ///< number of elements
+
+     uint32_t toKey(double key) const {
+         if (key <= last)
+             return last;
+         if (key >= 4294967295.0)
+             return 4294967295u;
+         return static_cast<uint32_t>(key);
+     }
+
+     int getBucket(uint32_t key) const {
+         uint32_t diff = key ^ last;
+
+         if (diff == 0)
+             return 0;
+#if defined(__GNUC__)
+         return 32 - __builtin_clz(diff);
+#else
+         int b = 0;
+         while (diff != 0) {
+             diff >>= 1;
+             ++b;
+         }
+         return b;
+#endif
+     }
+
+     void insert(int id) {
+         int b = getBucket(keys[id]);
+
+         bucketOf[id] = b;
+         slot[id] = static_cast<int>(buckets[b].size());
+         buckets[b].push_back(id);
+     }
+
+     void erase(int id) {
+         std::vector<int> &bucket = buckets[bucketOf[id]];
+         int moved = bucket.back();
+
+         bucket[slot[id]] = moved;
+         slot[moved] = slot[id];
+         bucket.pop_back();
+         bucketOf[id] = -1;
+     }
+
+     // make bucket 0 hold the lowest key by redistributing the first
+     // non-empty bucket around its minimum
+     void settle(void) {
+         if (!buckets[0].empty())
+             return;
+
+         int b = 1;
+         while (buckets[b].empty())
+             ++b;
+
+         uint32_t minKey = keys[buckets[b][0]];
+         for (int id : buckets[b]) {
+             if (keys[id] < minKey)
+                 minKey = keys[id];
+         }
+
+         last = minKey;
+         scratch.swap(buckets[b]);
+         for (int id : scratch)
+             insert(id);
+         scratch.clear();
+     }
+};
+
+#endif  // INCLUDE_PRIORITYQUEUE_HPP_
@@ -0,0 +1,186 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ReservationTable.hpp
+ *  @brief Definition of class ReservationTable
+ *
+ *  This file contains definitions of class ReservationTable, a hashed
+ *  set of space-time keys used by multi-agent planning to record which
+ *  cells and moves are taken at which timestep.
+ *
+ *  Keys are 64 bit integers stored in one open addressing array with
+ *  linear probing, so a lookup is a multiply and usually one cache
+ *  line.  Clearing keeps the array for the next use.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_RESERVATIONTABLE_HPP_
+#define INCLUDE_RESERVATIONTABLE_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+
+/**
+ *  @brief Class of hashed set of 64 bit space-time keys
+*/
+class ReservationTable {
+ public:
+     /**
+      *   @brief  Constructor of ReservationTable class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ReservationTable() : numKeys(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of ReservationTable class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~ReservationTable() {}
+
+
+     /**
+      *   @brief  Remove every key, keeping allocated slots
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clear(void) {
+         std::fill(keys.begin(), keys.end(), emptyKey());
+         numKeys = 0;
+     }
+
+
+     /**
+      *   @brief  Add a key
+      *
+      *   @param  key in uint64_t, not max uint64_t
+      *   @return true if key is added, false if it is already there
+     */
+     bool insert(uint64_t key) {
+         // keep load factor at most 1/2
+         if ((numKeys + 1) * 2 > keys.size())
+             grow();
+
+         size_t mask = keys.size() - 1;
+
+         for (size_t i = slotOf(key); ; i = (i + 1) & mask) {
+             if (keys[i] == key)
+                 return false;
+
+             if (keys[i] == emptyKey()) {
+                 keys[i] = key;
+                 ++numKeys;
+                 return true;
+             }
+         }
+     }
+
+
+     /**
+      *   @brief  Check if a key is in the table
+      *
+      *   @param  key in uint64_t
+      *   @return true if key is found, false otherwise
+     */
+     bool contains(uint64_t key) const {
+         if (numKeys == 0)
+             return false;
+
+         size_t mask = keys.size() - 1;
+
+         for (size_t i = slotOf(key); ; i = (i + 1) & mask) {
+             if (keys[i] == key)
+                 return true;
+
+             if (keys[i] == emptyKey())
+                 return false;
+         }
+     }
+
+
+     /**
+      *   @brief  Get number of keys
+      *
+      *   @param  none
+      *   @return number of keys in size_t
+     */
+     size_t size(void) const { return numKeys; }
+
+ private:
+     std::vector<uint64_t> keys;                   ///< slots, power of 2
+     size_t numKeys;                               ///< number of keys
+
+
+     /**
+      *   @brief  Get value marking an empty slot
+      *
+      *   @param  none
+      *   @return max uint64_t
+     */
+     static uint64_t emptyKey(void) { return ~static_cast<uint64_t>(0); }
+
+
+     /**
+      *   @brief  Get home slot of a key by Fibonacci hashing
+      *
+      *   @param  key in uint64_t
+      *   @return slot in size_t
+     */
+     size_t slotOf(uint64_t key) const {
+         uint64_t h = key * 0x9E3779B97F4A7C15ULL;
+         return static_cast<size_t>(h ^ (h >> 32)) & (keys.size() - 1);
+     }
+
+
+     /**
+      *   @brief  Double number of slots and insert keys again
+      *
+      *   @param  none
+      *   @return none
+     */
+     void grow(void) {
+         std::vector<uint64_t> old(std::max<size_t>(keys.size() * 2, 64),
+                                   emptyKey());
+
+         old.swap(keys);
+         numKeys = 0;
+
+         for (uint64_t key : old) {
+             if (key != emptyKey())
+                 insert(key);
+         }
+     }
+};
+
+#endif  // INCLUDE_RESERVATIONTABLE_HPP_
@@ -0,0 +1,193 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SIPPAlgorithm.hpp
+ *  @brief Definition of class SIPPAlgorithm
+ *
+ *  This file contains definitions and prototypes of class
+ *  SIPPAlgorithm, safe interval path planning around obstacles that
+ *  move on known schedules.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_SIPPALGORITHM_HPP_
+#define INCLUDE_SIPPALGORITHM_HPP_
+
+#include <vector>
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+
+
+/**
+ *  @brief Time interval [begin, end)
+*/
+struct TimeInterval {
+     double begin;                                 ///< first time inside
+     double end;                                   ///< first time after
+};
+
+
+/**
+ *  @brief Cell of a time-stamped path and the time agent is there
+*/
+struct TimedCell {
+     int index;                                    ///< map index
+     double time;                                  ///< time in cell
+};
+
+
+/**
+ *  @brief Class definition of SIPPAlgorithm class which is derived
+ *         from base class PathFindingAlgorithm for path planning
+ *         around moving obstacles.
+ *
+ *  Each cell has a list of unsafe time intervals, e.g. when a forklift
+ *  passes.  Their complement splits the cell into safe intervals, and
+ *  search runs over (cell, safe interval) states with the earliest
+ *  arrival time as cost, so waiting is only added where it lets the
+ *  agent into a later interval.  A move takes the time of its edge
+ *  cost in graph, and the agent holds the target cell from the start
+ *  of the move.  The agent must reach goal in its last safe interval,
+ *  so it can stay there.
+*/
+class SIPPAlgorithm : public PathFindingAlgorithm {
+ public:
+     /**
+      *   @brief  Constructor of SIPPAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     SIPPAlgorithm() : intervalsBuilt(false) {}
+
+
+     /**
+      *   @brief  Deconstructor of SIPPAlgorithm class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~SIPPAlgorithm() {}
+
+
+     /**
+      *   @brief  Build graph from map and drop unsafe intervals
+      *
+      *   @param  none
+      *   @return true if graph is built, false otherwise
+     */
+     bool buildGraph();
+
+
+     /**
+      *   @brief  Set unsafe time intervals of a cell, replacing earlier
+      *           ones.  Intervals may overlap and come in any order.
+      *
+      *   @param  map index in int
+      *   @param  reference to unsafe intervals, empty if always safe
+      *   @return true if intervals are set, false if index is outside
+      *           map or an interval does not have begin < end
+     */
+     bool setUnsafeIntervals(int, const std::vector<TimeInterval>&);
+
+
+     /**
+      *   @brief  Make every cell safe at all times
+      *
+      *   @param  none
+      *   @return none
+     */
+     void clearUnsafeIntervals(void);
+
+
+     /**
+      *   @brief  Compute earliest arrival path from start at time 0 to
+      *           goal avoiding unsafe intervals.  Total cost is the
+      *           arrival time at goal.  Weights above 1 are not
+      *           guaranteed to give the earliest arrival.
+      *
+      *   @param  weight of heuristic function in double
+      *   @return true if path can be found, false otherwise
+     */
+     bool computPath(double);
+
+
+     /**
+      *   @brief  Get time-stamped path of last computPath.  Each entry
+      *           is a cell and the time agent gets there; a cell that
+      *           repeats holds the time agent leaves after waiting.
+      *
+      *   @param  none
+      *   @return reference to timed cells from start to goal
+     */
+     const std::vector<TimedCell>& getTimedPath(void) const {
+         return timedPath;
+     }
+
+
+     /**
+      *   @brief  Get number of (cell, safe interval) states
+      *
+      *   @param  none
+      *   @return number of states in int
+     */
+     int getNumStates(void);
+
+ private:
+     std::vector<std::vector<TimeInterval>> unsafe;  ///< sorted unsafe
+                                                     ///< intervals per node
+     std::vector<TimeInterval> safe;               ///< safe intervals of
+                                                   ///< all nodes, in order
+     std::vector<int> firstState;                  ///< first state of node
+     std::vector<int> stateNode;                   ///< node of state
+     bool intervalsBuilt;                          ///< safe intervals match
+                                                   ///< unsafe ones
+     SearchContext<BinaryHeap> context;            ///< state search state
+     std::vector<TimedCell> timedPath;             ///< path with times
+
+
+     /**
+      *   @brief  Build safe intervals of every node from unsafe ones
+      *
+      *   @param  none
+      *   @return none
+     */
+     void buildIntervals(void);
+
+
+     /**
+      *   @brief  Compute heuristic cost between two nodes using
+      *           euclidean distance
+      *
+      *   @param  start node id in int
+      *   @param  end node id in int
+      *   @return heuristic cost estimation in double
+     */
+     double getHeuristicCost(int, int) const;
+};
+
+#endif  // INCLUDE_SIPPALGORITHM_HPP_
@@ -0,0 +1,214 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SearchContext.hpp
+ *  @brief Definition of class SearchContext
+ *
+ *  This file contains definitions of class SearchContext which keeps
+ *  the per-search state (cost, estimated cost, parent, open and closed
+ *  sets) of a path finding algorithm apart from the graph.
+ *
+ *  State is stored in flat arrays indexed by node id (0 based).  Every
+ *  entry is tagged with the generation of the search that wrote it, so
+ *  starting a new search only bumps the generation instead of clearing
+ *  the arrays.  Once the arrays have grown to the graph size, a search
+ *  does not allocate memory.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_SEARCHCONTEXT_HPP_
+#define INCLUDE_SEARCHCONTEXT_HPP_
+
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+
+/**
+ *  @brief Class that keeps reusable search state of a path finding
+ *         query.  Queue is the open set priority queue policy.
+*/
+template <class Queue>
+class SearchContext {
+ public:
+     /**
+      *   @brief  Constructor of SearchContext class
+      *
+      *   @param  none
+      *   @return none
+     */
+     SearchContext() : generation(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of SearchContext class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~SearchContext() {}
+
+
+     /**
+      *   @brief  Start a new search over n nodes.  Arrays only grow
+      *           when n exceeds their size, otherwise the previous
+      *           search is discarded by advancing the generation.
+      *
+      *   @param  number of nodes in int
+      *   @return none
+     */
+     void reset(int n) {
+         if (n > static_cast<int>(stamp.size())) {
+             cost.resize(n);
+             estimateCost.resize(n);
+             parent.resize(n);
+             stamp.resize(n, 0);
+         }
+
+         openSet.resize(n);
+         openSet.clear();
+
+         // stamp = generation: open, stamp = generation + 1: closed
+         generation += 2;
+         if (generation >= std::numeric_limits<uint32_t>::max() - 1) {
+             std::fill(stamp.begin(), stamp.end(), 0);
+             generation = 2;
+         }
+     }
+
+
+     /**
+      *   @brief  Check if node has been reached by current search
+      *
+      *   @param  node id in int
+      *   @return true if node is open or closed, false otherwise
+     */
+     bool isVisited(int id) const { return stamp[id] >= generation; }
+
+
+     /**
+      *   @brief  Check if node is in closed set of current search
+      *
+      *   @param  node id in int
+      *   @return true if node is closed, false otherwise
+     */
+     bool isClosed(int id) const { return stamp[id] == generation + 1; }
+
+
+     /**
+      *   @brief  Record a node reached by current search
+      *
+      *   @param  node id in int
+      *   @param  cost from start to node in double
+      *   @param  estimated total cost through node in double
+      *   @param  parent node id in int, -1 for start node
+      *   @return none
+     */
+     void visit(int id, double c, double estimate, int p) {
+         cost[id] = c;
+         estimateCost[id] = estimate;
+         parent[id] = p;
+         stamp[id] = generation;
+     }
+
+
+     /**
+      *   @brief  Move node to closed set
+      *
+      *   @param  node id in int
+      *   @return none
+     */
+     void close(int id) { stamp[id] = generation + 1; }
+
+
+     /**
+      *   @brief  Get cost from start to node
+      *
+      *   @param  node id in int
+      *   @return cost in double, infinity if node is not visited
+     */
+     double getCost(int id) const {
+         return isVisited(id) ? cost[id] :
+                                std::numeric_limits<double>::infinity();
+     }
+
+
+     /**
+      *   @brief  Get estimated total cost through node
+      *
+      *   @param  node id in int, must be visited
+      *   @return estimated cost in double
+     */
+     double getEstimateCost(int id) const { return estimateCost[id]; }
+
+
+     /**
+      *   @brief  Get parent of node
+      *
+      *   @param  node id in int, must be visited
+      *   @return parent node id in int, -1 for start node
+     */
+     int getParent(int id) const { return parent[id]; }
+
+
+     /**
+      *   @brief  Get open set of current search
+      *
+      *   @param  none
+      *   @return reference to open set priority queue
+     */
+     Queue& getOpenSet(void) { return openSet; }
+
+
+     /**
+      *   @brief  Follow parents from node back to start and store
+      *           node ids from start to node.  Path is reused so no
+      *           memory is allocated once it has enough capacity.
+      *
+      *   @param  node id in int
+      *   @param  reference to vector int of node ids
+      *   @return none
+     */
+     void extractPath(int id, std::vector<int> &path) const {
+         path.clear();
+
+         for (int n = id; n >= 0; n = parent[n])
+             path.push_back(n);
+
+         std::reverse(path.begin(), path.end());
+     }
+
+ private:
+     std::vector<double> cost;                     ///< cost from start
+     std::vector<double> estimateCost;             ///< cost + heuristic
+     std::vector<int> parent;                      ///< parent node id
+     std::vector<uint32_t> stamp;                  ///< generation tag
+     uint32_t generation;                          ///< current search
+     Queue openSet;                                ///< open set
+};
+
+#endif  // INCLUDE_SEARCHCONTEXT_HPP_
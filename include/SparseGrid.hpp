@@ -0,0 +1,342 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SparseGrid.hpp
+ *  @brief Definition of class template SparseGrid
+ *
+ *  This file contains definitions of class template SparseGrid which
+ *  keeps map cells in square chunks.  A chunk whose cells all have the
+ *  same cost (all free or all obstacle) is stored as that cost only;
+ *  the other chunks are stored as one byte per cell.  On maps that are
+ *  mostly open space this takes a small fraction of a byte per cell.
+ *
+ *  Neighbors of a cell inside a uniform chunk all lie in that chunk
+ *  and have its cost, so they are generated from fixed index offsets
+ *  without reading any cell.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_SPARSEGRID_HPP_
+#define INCLUDE_SPARSEGRID_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "GridGraph.hpp"
+#include "Map.hpp"
+
+
+/**
+ *  @brief Class that generates neighbors of map cells on the fly from
+ *         chunks stored as a single cost when uniform and densely
+ *         otherwise
+ *
+ *  Node id is map index - 1.  Cells past the map edge in the last
+ *  chunk of a row or column are obstacles.
+*/
+template <int Connectivity>
+class SparseGrid {
+ public:
+     ///< log2 of number of cells on chunk side
+     static const int chunkShift = 4;
+
+     ///< number of cells on chunk side
+     static const int chunkSize = 1 << chunkShift;
+
+
+     /**
+      *   @brief  Constructor of SparseGrid class
+      *
+      *   @param  none
+      *   @return none
+     */
+     SparseGrid() : numRows(0), numCols(0), chunksPerRow(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of SparseGrid class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~SparseGrid() {}
+
+
+     /**
+      *   @brief  Copy cell costs from map into chunks
+      *
+      *   @param  reference to map
+      *   @return true if grid is built, false if map has another
+      *           connectivity or a cell cost does not fit in one byte
+     */
+     bool build(Map &map) {
+         const int mask = chunkSize - 1;
+         const int cellsPerChunk = chunkSize * chunkSize;
+         int *dir = map.getMoveDir();
+
+         if (map.getNumDir() != Connectivity)
+             return false;
+
+         numRows = map.getRow();
+         numCols = map.getCol();
+         chunksPerRow = (numCols + mask) >> chunkShift;
+
+         int numChunkRows = (numRows + mask) >> chunkShift;
+         std::vector<uint8_t> cells(cellsPerChunk);
+
+         chunks.assign(static_cast<size_t>(numChunkRows) * chunksPerRow, 0);
+         dense.clear();
+
+         for (int cr = 0; cr < numChunkRows; ++cr) {
+             for (int cc = 0; cc < chunksPerRow; ++cc) {
+                 bool uniform = true;
+
+                 // cells past the map edge stay 0 (obstacle)
+                 std::fill(cells.begin(), cells.end(), 0);
+
+                 for (int i = 0; i < chunkSize; ++i) {
+                     int r = (cr << chunkShift) + i;
+
+                     for (int j = 0; j < chunkSize; ++j) {
+                         int c = (cc << chunkShift) + j;
+
+                         if ((r < numRows) && (c < numCols)) {
+                             int cost = map.getCost(r * numCols + c + 1);
+
+                             if (cost != std::numeric_limits<int>::max()) {
+                                 if ((cost < 1) || (cost > 255))
+                                     return false;
+
+                                 cells[(i << chunkShift) + j] =
+                                     static_cast<uint8_t>(cost);
+                             }
+                         }
+
+                         uniform = uniform &&
+                                   (cells[(i << chunkShift) + j] == cells[0]);
+                     }
+                 }
+
+                 // uniform chunk keeps -1 - cost, dense chunk its number
+                 int32_t &chunk = chunks[cr * chunksPerRow + cc];
+                 if (uniform) {
+                     chunk = -1 - cells[0];
+                 } else {
+                     chunk = static_cast<int32_t>(dense.size() /
+                                                  cellsPerChunk);
+                     dense.insert(dense.end(), cells.begin(), cells.end());
+                 }
+             }
+         }
+
+         dense.shrink_to_fit();
+
+         for (int k = 0; k < Connectivity; ++k) {
+             int d = GridConnectivity<Connectivity>::direction(k);
+             int dx = dir[d * 2];
+             int dy = dir[d * 2 + 1];
+
+             offset[k] = dy * numCols + dx;
+             stepX[k] = dx;
+             stepY[k] = dy;
+
+             // setting cost to 1.5x for diagonal movement
+             multiplier[k] = ((dx != 0) && (dy != 0)) ? 1.5 : 1.0;
+         }
+
+         return true;
+     }
+
+
+     /**
+      *   @brief  Get number of node ids
+      *
+      *   @param  none
+      *   @return number of cells in int
+     */
+     int getNumNodes(void) const { return numRows * numCols; }
+
+
+     /**
+      *   @brief  Convert map index to node id
+      *
+      *   @param  map index (1 based) in int
+      *   @return node id in int
+     */
+     int toId(int index) const { return index - 1; }
+
+
+     /**
+      *   @brief  Convert node id to map index
+      *
+      *   @param  node id in int
+      *   @return map index (1 based) in int
+     */
+     int toIndex(int id) const { return id + 1; }
+
+
+     /**
+      *   @brief  Get cost of a cell
+      *
+      *   @param  row of cell in int, [0, rows)
+      *   @param  column of cell in int, [0, cols)
+      *   @return cell cost in int, 0 if cell is an obstacle
+     */
+     int getCell(int r, int c) const {
+         int32_t chunk = chunks[(r >> chunkShift) * chunksPerRow +
+                                (c >> chunkShift)];
+
+         if (chunk < 0)
+             return -1 - chunk;
+
+         const int mask = chunkSize - 1;
+         return dense[(static_cast<size_t>(chunk) << (2 * chunkShift)) +
+                      ((r & mask) << chunkShift) + (c & mask)];
+     }
+
+
+     /**
+      *   @brief  Check if node is an obstacle
+      *
+      *   @param  node id in int
+      *   @return true if node cannot be crossed, false otherwise
+     */
+     bool isBlocked(int id) const {
+         return getCell(id / numCols, id % numCols) == 0;
+     }
+
+
+     /**
+      *   @brief  Get x, y (row, column) position of node in map
+      *
+      *   @param  node id in int
+      *   @return x, y position group by tuple in double
+     */
+     std::tuple<double, double> getPos(int id) const {
+         return std::make_tuple(static_cast<double>(id / numCols),
+                                static_cast<double>(id % numCols));
+     }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every passable
+      *           neighbor of a node
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         const int mask = chunkSize - 1;
+         int r = id / numCols;
+         int c = id % numCols;
+         int32_t chunk = chunks[(r >> chunkShift) * chunksPerRow +
+                                (c >> chunkShift)];
+
+         // away from the chunk border every neighbor is in this uniform
+         // chunk, which is inside the map since edge cells are obstacles
+         if ((chunk < 0) &&
+             ((r & mask) != 0) && ((r & mask) != mask) &&
+             ((c & mask) != 0) && ((c & mask) != mask)) {
+             int cost = -1 - chunk;
+
+             if (cost == 0)
+                 return;
+
+             for (int k = 0; k < Connectivity; ++k)
+                 f(id + offset[k], cost * multiplier[k]);
+
+             return;
+         }
+
+         for (int k = 0; k < Connectivity; ++k) {
+             int nr = r + stepY[k];
+             int nc = c + stepX[k];
+
+             if ((nr < 0) || (nr >= numRows) || (nc < 0) || (nc >= numCols))
+                 continue;
+
+             int cost = getCell(nr, nc);
+             if (cost != 0)
+                 f(id + offset[k], cost * multiplier[k]);
+         }
+     }
+
+
+     /**
+      *   @brief  Get number of chunks
+      *
+      *   @param  none
+      *   @return number of chunks in int
+     */
+     int getNumChunks(void) const { return static_cast<int>(chunks.size()); }
+
+
+     /**
+      *   @brief  Get number of chunks stored one byte per cell
+      *
+      *   @param  none
+      *   @return number of mixed chunks in int
+     */
+     int getNumDenseChunks(void) const {
+         return static_cast<int>(dense.size() / (chunkSize * chunkSize));
+     }
+
+
+     /**
+      *   @brief  Get memory used by chunk table and dense chunks
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const {
+         return chunks.capacity() * sizeof(int32_t) + dense.capacity();
+     }
+
+ private:
+     int numRows;                                  ///< number of rows in map
+     int numCols;                                  ///< number of cols in map
+     int chunksPerRow;                             ///< chunks in a row
+
+     std::vector<int32_t> chunks;                  ///< -1 - cost of uniform
+                                                   ///< chunk, or number of
+                                                   ///< dense chunk
+     std::vector<uint8_t> dense;                   ///< cells of mixed
+                                                   ///< chunks, 0 is obstacle
+     int offset[Connectivity];                     ///< id offset of each
+                                                   ///< direction
+     int stepX[Connectivity];                      ///< column change of
+                                                   ///< each direction
+     int stepY[Connectivity];                      ///< row change of each
+                                                   ///< direction
+     double multiplier[Connectivity];              ///< cost multiplier of
+                                                   ///< each direction
+};
+
+#endif  // INCLUDE_SPARSEGRID_HPP_
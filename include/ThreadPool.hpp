@@ -0,0 +1,120 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ThreadPool.hpp
+ *  @brief Definition of class ThreadPool
+ *
+ *  This file contains definitions and prototypes of class ThreadPool,
+ *  a fixed set of worker threads that run loops in parallel.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_THREADPOOL_HPP_
+#define INCLUDE_THREADPOOL_HPP_
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+ *  @brief Class that keeps worker threads alive between parallel loops
+ *         so no thread is created per loop.  Loop iterations are
+ *         handed out one at a time, so workers stay busy when
+ *         iterations take different time.
+*/
+class ThreadPool {
+ public:
+     /**
+      *   @brief  Constructor of ThreadPool class
+      *
+      *   @param  number of worker threads in int, 0 for one per
+      *           hardware thread
+      *   @return none
+     */
+     explicit ThreadPool(int);
+
+
+     /**
+      *   @brief  Deconstructor of ThreadPool class.  Stops and joins
+      *           worker threads.
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~ThreadPool();
+
+
+     /**
+      *   @brief  Get number of worker threads
+      *
+      *   @param  none
+      *   @return number of worker threads in int
+     */
+     int getNumThreads(void) const
+                { return static_cast<int>(threads.size()); }
+
+
+     /**
+      *   @brief  Call f(worker, i) for every i in [0, count) on worker
+      *           threads and wait until all calls return.  worker is
+      *           in [0, getNumThreads()) and no two calls with the
+      *           same worker run at the same time.
+      *
+      *   @param  number of iterations in int
+      *   @param  function to call for each iteration
+      *   @return none
+     */
+     void parallelFor(int, const std::function<void(int, int)>&);
+
+ private:
+     std::vector<std::thread> threads;             ///< worker threads
+     std::mutex mutex;                             ///< guards loop state
+     std::condition_variable startLoop;            ///< signals new loop
+     std::condition_variable loopDone;             ///< signals loop end
+
+     const std::function<void(int, int)> *task;    ///< body of loop
+     int count;                                    ///< iterations of loop
+     std::atomic<int> next;                        ///< next iteration
+     int numBusy;                                  ///< workers in loop
+     uint64_t loopId;                              ///< current loop
+     bool stopping;                                ///< pool is destroyed
+
+
+     /**
+      *   @brief  Wait for loops and run their iterations
+      *
+      *   @param  worker index in int
+      *   @return none
+     */
+     void work(int);
+};
+
+#endif  // INCLUDE_THREADPOOL_HPP_
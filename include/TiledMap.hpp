@@ -0,0 +1,407 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file TiledMap.hpp
+ *  @brief Definition of class TiledMap and TiledGraph
+ *
+ *  This file contains definitions of class TiledMap, which reads map
+ *  cells from a tiled map file through a least recently used cache of
+ *  tiles with a fixed memory budget, and class TiledGraph, which lets
+ *  the generic searches of GraphSearch.hpp run on a tiled map without
+ *  knowing it is paged.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_TILEDMAP_HPP_
+#define INCLUDE_TILEDMAP_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "Map.hpp"
+
+
+/**
+ *  @brief Class definition of TiledMap used for reading maps that do
+ *         not fit in memory.
+ *
+ *  Cells are stored on disk in square tiles of one byte per cell (cost,
+ *  0 for obstacle).  Tiles are read on demand into a fixed number of
+ *  cache slots and the least recently used tile is evicted when a slot
+ *  is needed.  Cells are read only.  Reads update the cache, so a
+ *  TiledMap must not be shared between threads.
+*/
+class TiledMap {
+ public:
+     /**
+      *   @brief  Constructor of TiledMap class
+      *
+      *   @param  none
+      *   @return none
+     */
+     TiledMap() : row(0), col(0), numDir(8), tileSize(0), tileShift(0),
+                  tilesPerRow(0), tileBytes(0), dataOffset(0),
+                  numSlots(0), head(-1), tail(-1),
+                  lastTile(-1), lastData(nullptr),
+                  numHits(0), numMisses(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of TiledMap class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~TiledMap() {}
+
+
+     /**
+      *   @brief  Write cells of a map in tiled map format.  Only one
+      *           row of tiles is kept in memory while writing.
+      *
+      *   @param  reference to map
+      *   @param  output file path in string
+      *   @param  number of cells on each side of a tile in int, power
+      *           of 2 in [8, 4096]
+      *   @return true if file is written, false if map is empty, tile
+      *           size is not valid, or file cannot be written
+     */
+     static bool create(Map&, std::string, int);
+
+
+     /**
+      *   @brief  Open tiled map file.  Only the header is read; tiles
+      *           are read when a cell in them is accessed.
+      *
+      *   @param  input file path in string
+      *   @param  memory budget of tile cache in bytes, at least one
+      *           tile is cached
+      *   @return true if file is a valid tiled map, false otherwise
+     */
+     bool open(std::string, size_t);
+
+
+     /**
+      *   @brief  Get number of rows in map
+      *
+      *   @param  none
+      *   @return number of rows in map in integer
+     */
+     int getRow(void) const { return row; }
+
+
+     /**
+      *   @brief  Get number of columns in map
+      *
+      *   @param  none
+      *   @return number of columns in map in integer
+     */
+     int getCol(void) const { return col; }
+
+
+     /**
+      *   @brief  Get number of moving directions of a node
+      *
+      *   @param  none
+      *   @return 4 or 8
+     */
+     int getNumDir(void) const { return numDir; }
+
+
+     /**
+      *   @brief  Get number of cells on each side of a tile
+      *
+      *   @param  none
+      *   @return tile size in int
+     */
+     int getTileSize(void) const { return tileSize; }
+
+
+     /**
+      *   @brief  Get number of tiles the cache can hold
+      *
+      *   @param  none
+      *   @return number of cache slots in int
+     */
+     int getNumSlots(void) const { return numSlots; }
+
+
+     /**
+      *   @brief  Get cost byte of a cell, reading its tile if it is not
+      *           cached
+      *
+      *   @param  row of cell in int, [0, rows)
+      *   @param  column of cell in int, [0, cols)
+      *   @return cell cost in [1, 255], 0 for obstacle
+     */
+     uint8_t getCell(int r, int c) const {
+         int tile = (r >> tileShift) * tilesPerRow + (c >> tileShift);
+
+         // neighboring reads mostly stay in the same tile
+         if (tile == lastTile) {
+             ++numHits;
+         } else {
+             lastData = fetchTile(tile);
+             lastTile = tile;
+         }
+
+         int mask = tileSize - 1;
+         return lastData[((r & mask) << tileShift) + (c & mask)];
+     }
+
+
+     /**
+      *   @brief  Check if cell is an obstacle
+      *
+      *   @param  map index (1 based) in int, within map
+      *   @return true if cell is an obstacle, false otherwise
+     */
+     bool isBlocked(int index) const {
+         return getCell((index - 1) / col, (index - 1) % col) == 0;
+     }
+
+
+     /**
+      *   @brief  Get cost of moving into a cell
+      *
+      *   @param  map index (1 based) in int, within map
+      *   @return cell cost in int, max int for obstacle
+     */
+     int getCost(int index) const {
+         uint8_t cost = getCell((index - 1) / col, (index - 1) % col);
+         return cost ? cost : std::numeric_limits<int>::max();
+     }
+
+
+     /**
+      *   @brief  Get number of cell reads served from cached tiles
+      *
+      *   @param  none
+      *   @return number of hits in uint64_t
+     */
+     uint64_t getNumHits(void) const { return numHits; }
+
+
+     /**
+      *   @brief  Get number of cell reads that had to read a tile
+      *
+      *   @param  none
+      *   @return number of misses in uint64_t
+     */
+     uint64_t getNumMisses(void) const { return numMisses; }
+
+
+     /**
+      *   @brief  Reset hit and miss counters.  Cached tiles are kept.
+      *
+      *   @param  none
+      *   @return none
+     */
+     void resetCounters(void) { numHits = 0; numMisses = 0; }
+
+
+     /**
+      *   @brief  Get memory used by tile cache
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const { return slots.capacity(); }
+
+ private:
+     int row;                                      ///< number of rows in map
+     int col;                                      ///< number of cols in map
+     int numDir;                                   ///< number of direction
+                                                   ///< a node can move
+     int tileSize;                                 ///< cells on tile side
+     int tileShift;                                ///< log2 of tileSize
+     int tilesPerRow;                              ///< tiles in a tile row
+     size_t tileBytes;                             ///< bytes of a tile
+     uint64_t dataOffset;                          ///< file offset of tiles
+
+     mutable std::ifstream file;                   ///< tiled map file
+     mutable std::vector<uint8_t> slots;           ///< cached tile cells
+     mutable std::vector<int> slotTile;            ///< tile in each slot,
+                                                   ///< -1 if empty
+     mutable std::vector<int> tileSlot;            ///< slot of each tile,
+                                                   ///< -1 if not cached
+     mutable std::vector<int> prev;                ///< more recently used
+                                                   ///< slot, -1 at head
+     mutable std::vector<int> next;                ///< less recently used
+                                                   ///< slot, -1 at tail
+     int numSlots;                                 ///< number of slots
+     mutable int head;                             ///< most recently used
+     mutable int tail;                             ///< least recently used
+
+     mutable int lastTile;                         ///< tile of last read
+     mutable const uint8_t *lastData;              ///< cells of lastTile
+     mutable uint64_t numHits;                     ///< reads from cache
+     mutable uint64_t numMisses;                   ///< reads from file
+
+     /**
+      *   @brief  Get cells of a tile, reading it into the least
+      *           recently used slot if it is not cached
+      *
+      *   @param  tile index in int
+      *   @return pointer to tile cells
+     */
+     const uint8_t* fetchTile(int) const;
+
+     /**
+      *   @brief  Move slot to most recently used end of list
+      *
+      *   @param  slot index in int
+      *   @return none
+     */
+     void touch(int) const;
+
+     // the file stream cannot be copied
+     TiledMap(const TiledMap&) = delete;
+     TiledMap& operator=(const TiledMap&) = delete;
+};
+
+
+/**
+ *  @brief Class that generates neighbors of tiled map cells on the fly,
+ *         for use with the searches in GraphSearch.hpp
+ *
+ *  Node id is map index - 1.  Connectivity follows the tiled map.
+*/
+class TiledGraph {
+ public:
+     /**
+      *   @brief  Constructor of TiledGraph class
+      *
+      *   @param  reference to tiled map, which must outlive the graph
+      *   @return none
+     */
+     explicit TiledGraph(const TiledMap &m) : map(m) {
+         static const int dirs[8][2] = {{-1, -1}, {0, -1}, {1, -1},
+                                        {-1,  0},          {1,  0},
+                                        {-1,  1}, {0,  1}, {1,  1}};
+         numDir = 0;
+
+         for (int k = 0; k < 8; ++k) {
+             int dx = dirs[k][0];
+             int dy = dirs[k][1];
+
+             // 4-connected maps only move straight
+             if ((map.getNumDir() == 4) && (dx != 0) && (dy != 0))
+                 continue;
+
+             stepX[numDir] = dx;
+             stepY[numDir] = dy;
+
+             // setting cost to 1.5x for diagonal movement
+             multiplier[numDir] = ((dx != 0) && (dy != 0)) ? 1.5 : 1.0;
+             ++numDir;
+         }
+     }
+
+
+     /**
+      *   @brief  Get number of node ids
+      *
+      *   @param  none
+      *   @return number of cells in int
+     */
+     int getNumNodes(void) const { return map.getRow() * map.getCol(); }
+
+
+     /**
+      *   @brief  Convert map index to node id
+      *
+      *   @param  map index (1 based) in int
+      *   @return node id in int
+     */
+     int toId(int index) const { return index - 1; }
+
+
+     /**
+      *   @brief  Convert node id to map index
+      *
+      *   @param  node id in int
+      *   @return map index (1 based) in int
+     */
+     int toIndex(int id) const { return id + 1; }
+
+
+     /**
+      *   @brief  Get x, y (row, column) position of node in map
+      *
+      *   @param  node id in int
+      *   @return x, y position group by tuple in double
+     */
+     std::tuple<double, double> getPos(int id) const {
+         return std::make_tuple(static_cast<double>(id / map.getCol()),
+                                static_cast<double>(id % map.getCol()));
+     }
+
+
+     /**
+      *   @brief  Call f(neighbor id, edge cost) for every passable
+      *           neighbor of a node
+      *
+      *   @param  node id in int
+      *   @param  function to call for each neighbor
+      *   @return none
+     */
+     template <class Function>
+     void forEachNeighbor(int id, Function f) const {
+         int numCols = map.getCol();
+         int r = id / numCols;
+         int c = id % numCols;
+
+         for (int k = 0; k < numDir; ++k) {
+             int nr = r + stepY[k];
+             int nc = c + stepX[k];
+
+             if ((nr < 0) || (nr >= map.getRow()) ||
+                 (nc < 0) || (nc >= numCols))
+                 continue;
+
+             uint8_t cost = map.getCell(nr, nc);
+             if (cost != 0)
+                 f(nr * numCols + nc, cost * multiplier[k]);
+         }
+     }
+
+ private:
+     const TiledMap &map;                          ///< paged cells
+     int numDir;                                   ///< number of directions
+     int stepX[8];                                 ///< column change of
+                                                   ///< each direction
+     int stepY[8];                                 ///< row change of each
+                                                   ///< direction
+     double multiplier[8];                         ///< cost multiplier of
+                                                   ///< each direction
+};
+
+#endif  // INCLUDE_TILEDMAP_HPP_
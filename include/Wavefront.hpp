@@ -0,0 +1,235 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file Wavefront.hpp
+ *  @brief Definition of class Wavefront
+ *
+ *  This file contains definitions and prototypes of class Wavefront,
+ *  a breadth first flood over bit-packed map rows that gives hop
+ *  distances and reachability without a priority queue.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#ifndef INCLUDE_WAVEFRONT_HPP_
+#define INCLUDE_WAVEFRONT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "Map.hpp"
+
+
+/**
+ *  @brief Class that floods a map from start cells one hop at a time,
+ *         with one bit per cell so a machine word (or SIMD register)
+ *         advances 64 (or 256) cells per instruction
+ *
+ *  Every passable cell counts as one hop regardless of its cost, so
+ *  hop distances equal shortest path costs only on uniform maps.
+ *  Reachability is exact on any map.
+*/
+class Wavefront {
+ public:
+     /**
+      *  @brief Row kernels that advance the wavefront
+     */
+     enum Kernel {
+         AUTO,                                     ///< widest supported
+         SCALAR,                                   ///< 64 bit words
+         AVX2                                      ///< 256 bit registers
+     };
+
+
+     /**
+      *   @brief  Constructor of Wavefront class
+      *
+      *   @param  none
+      *   @return none
+     */
+     Wavefront() : numRows(0), numCols(0), numWords(0), stride(0),
+                   kernel(AUTO), usedKernel(SCALAR), numSteps(0),
+                   numReached(0) {}
+
+
+     /**
+      *   @brief  Deconstructor of Wavefront class
+      *
+      *   @param  none
+      *   @return none
+     */
+     ~Wavefront() {}
+
+
+     /**
+      *   @brief  Pack passable cells of map into bit rows
+      *
+      *   @param  reference to map
+      *   @return true if map has cells, false otherwise
+     */
+     bool build(Map&);
+
+
+     /**
+      *   @brief  Select row kernel.  AVX2 falls back to SCALAR on CPUs
+      *           without it.
+      *
+      *   @param  kernel
+      *   @return none
+     */
+     void setKernel(Kernel k) { kernel = k; }
+
+
+     /**
+      *   @brief  Get row kernel used by last flood
+      *
+      *   @param  none
+      *   @return kernel, SCALAR or AVX2
+     */
+     Kernel getKernel(void) const { return usedKernel; }
+
+
+     /**
+      *   @brief  Check if CPU running the program supports AVX2
+      *
+      *   @param  none
+      *   @return true if AVX2 kernel can run, false otherwise
+     */
+     static bool hasAvx2(void);
+
+
+     /**
+      *   @brief  Compute hop distance from nearest start cell to every
+      *           cell
+      *
+      *   @param  reference to start indices (1 based)
+      *   @param  connectivity in int, 4 or 8
+      *   @param  reference to hop distances, one per map index - 1,
+      *           -1 for cells that cannot be reached
+      *   @return true if flood is done, false if connectivity is not
+      *           4 or 8 or a start is out of map or blocked
+     */
+     bool computeHops(const std::vector<int>&, int, std::vector<int>&);
+
+
+     /**
+      *   @brief  Compute which cells can be reached from start cells.
+      *           Skips writing hop distances.
+      *
+      *   @param  reference to start indices (1 based)
+      *   @param  connectivity in int, 4 or 8
+      *   @return true if flood is done, false if connectivity is not
+      *           4 or 8 or a start is out of map or blocked
+     */
+     bool computeReachable(const std::vector<int>&, int);
+
+
+     /**
+      *   @brief  Check if cell was reached by last flood
+      *
+      *   @param  map index (1 based) in int
+      *   @return true if cell can be reached, false otherwise
+     */
+     bool isReachable(int index) const {
+         int i = (index - 1) / numCols;
+         int j = (index - 1) % numCols;
+         return (visited[rowOffset(i) + j / 64] >> (j % 64)) & 1;
+     }
+
+
+     /**
+      *   @brief  Get number of cells reached by last flood, including
+      *           start cells
+      *
+      *   @param  none
+      *   @return number of cells in int
+     */
+     int getNumReached(void) const { return numReached; }
+
+
+     /**
+      *   @brief  Get number of hops taken by last flood
+      *
+      *   @param  none
+      *   @return largest hop distance in int
+     */
+     int getNumSteps(void) const { return numSteps; }
+
+
+     /**
+      *   @brief  Get memory used by bit rows
+      *
+      *   @param  none
+      *   @return number of bytes in size_t
+     */
+     size_t getMemoryUsage(void) const;
+
+ private:
+     int numRows;                                  ///< number of rows in map
+     int numCols;                                  ///< number of cols in map
+     int numWords;                                 ///< words per row, a
+                                                   ///< multiple of 4
+     int stride;                                   ///< words between rows,
+                                                   ///< including padding
+     Kernel kernel;                                ///< kernel selected
+     Kernel usedKernel;                            ///< kernel of last flood
+     int numSteps;                                 ///< hops of last flood
+     int numReached;                               ///< cells reached
+
+     std::vector<uint64_t> passable;               ///< 1 bit per passable
+                                                   ///< cell
+     std::vector<uint64_t> visited;                ///< 1 bit per reached
+                                                   ///< cell
+     std::vector<uint64_t> front;                  ///< cells reached by
+                                                   ///< last hop
+     std::vector<uint64_t> next;                   ///< cells reached by
+                                                   ///< current hop
+
+
+     /**
+      *   @brief  Get offset of first word of a row.  A zero row lies
+      *           above and below the map and a zero word on both sides
+      *           of each row.
+      *
+      *   @param  row in int, [-1, numRows]
+      *   @return word offset in size_t
+     */
+     size_t rowOffset(int row) const {
+         return static_cast<size_t>(row + 1) * stride + 1;
+     }
+
+
+     /**
+      *   @brief  Flood from start cells
+      *
+      *   @param  reference to start indices (1 based)
+      *   @param  connectivity in int, 4 or 8
+      *   @param  pointer to hop distances, nullptr to skip them
+      *   @return true if flood is done, false otherwise
+     */
+     bool flood(const std::vector<int>&, int, std::vector<int>*);
+};
+
+#endif  // INCLUDE_WAVEFRONT_HPP_
@@ -0,0 +1,317 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file ALTTest.cpp
+ *  @brief Implementation of unit test for ALTAlgorithm
+ *
+ *  This file contains unit tests of A star with landmark heuristics,
+ *  checked against A star on the provided maps and on aisle maps.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "ALTAlgorithm.hpp"
+
+
+/**
+ *   @brief  Write a map of horizontal walls every fourth row, each
+ *           with a few random gaps
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  random seed in unsigned int
+ *   @return none
+*/
+static void writeAisleMap(const std::string &file, int rows, int cols,
+                          unsigned int seed) {
+    std::ofstream out(file);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> gapDist(0, cols - 1);
+
+    for (int i = 0; i < rows; ++i) {
+        std::vector<bool> open(cols, (i % 4) != 3);
+        for (int g = 0; g < 2; ++g)
+            open[gapDist(rng)] = true;
+
+        for (int j = 0; j < cols; ++j) {
+            out << (open[j] ? "1" : "O");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Compare landmark A star with A star for pairs of indices
+ *
+ *   @param  reference to A star initialized with map
+ *   @param  reference to ALTAlgorithm initialized with same map
+ *   @param  first index and step between start indices in int
+ *   @param  step between goal indices in int
+ *   @param  reference to expanded nodes of A star, accumulated
+ *   @param  reference to expanded nodes of ALT, accumulated
+ *   @return none
+*/
+static void compareWithAStar(AStarAlgorithm &aStar, ALTAlgorithm &alt,
+                             int startStep, int goalStep,
+                             int &aStarExpanded, int &altExpanded) {
+    int numNodes = alt.getGraph().getNumNodes();
+
+    for (int s = 1; s <= numNodes; s += startStep) {
+        for (int g = 1; g <= numNodes; g += goalStep) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            alt.PathFindingAlgorithm::setParam(s, g);
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, alt.computPath(1.0));
+
+            aStarExpanded += aStar.getNumExpanded();
+            altExpanded += alt.getNumExpanded();
+
+            if (!found)
+                continue;
+
+            ASSERT_EQ(aStar.getTotalCost(), alt.getTotalCost());
+            ASSERT_LE(alt.getLandmarks().getLowerBound(s - 1, g - 1),
+                      alt.getTotalCost());
+            ASSERT_EQ(s, alt.getPath().front());
+            ASSERT_EQ(g, alt.getPath().back());
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check both selection strategies give A star costs on the
+ *           provided maps \n
+ *           Test expects equal costs and no path to unreachable goal
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testALT, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (auto strategy : {Landmarks::FARTHEST, Landmarks::AVOID}) {
+        ALTAlgorithm alt(4, strategy);
+        int aStarExpanded = 0;
+        int altExpanded = 0;
+
+        ASSERT_TRUE(alt.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+        ASSERT_EQ(4, alt.getLandmarks().getNumLandmarks());
+
+        compareWithAStar(aStar, alt, 5, 3, aStarExpanded, altExpanded);
+
+        for (double weight : {0.0, 2.0}) {
+            alt.PathFindingAlgorithm::setParam(1, 338);
+            ASSERT_TRUE(alt.computPath(weight));
+        }
+    }
+
+    // unreachable goal
+    ALTAlgorithm alt(2);
+    alt.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    alt.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(alt.computPath(1.0));
+    ASSERT_FALSE(alt.computPath(0.0));
+}
+
+
+/**
+ *   @brief  Check landmark A star on aisle maps, where euclidean
+ *           distance leads A star into dead ends \n
+ *           Test expects equal costs and fewer than three quarters of
+ *           the expanded nodes of A star
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testALT, fewerExpansionsOnAisles) {
+    const char *mapFile = "alt_aisles.csv";
+
+    for (unsigned int seed = 1; seed <= 3; ++seed) {
+        writeAisleMap(mapFile, 24, 30, seed);
+
+        AStarAlgorithm aStar;
+        ALTAlgorithm alt(8);
+        int aStarExpanded = 0;
+        int altExpanded = 0;
+
+        alt.setNumThreads(2);
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(alt.PathFindingAlgorithm::init(mapFile));
+
+        compareWithAStar(aStar, alt, 11, 7, aStarExpanded, altExpanded);
+
+        ASSERT_LT(4 * altExpanded, 3 * aStarExpanded);
+    }
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Check landmark tables written to a file are read back
+ *           instead of recomputed, and rejected for another map or
+ *           a corrupt landmark count \n
+ *           Test expects same landmarks and bounds after loading
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testALT, saveAndLoadTables) {
+    const char *tableFile = "alt_tables.bin";
+    ALTAlgorithm built(6);
+    ALTAlgorithm loaded(6);
+
+    remove(tableFile);
+
+    built.setTableFile(tableFile);
+    ASSERT_TRUE(built.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_GT(built.getLandmarks().getPreprocessTime(), 0);
+
+    loaded.setTableFile(tableFile);
+    ASSERT_TRUE(loaded.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_EQ(0, loaded.getLandmarks().getPreprocessTime());
+
+    const Landmarks &a = built.getLandmarks();
+    const Landmarks &b = loaded.getLandmarks();
+
+    ASSERT_EQ(a.getNumLandmarks(), b.getNumLandmarks());
+    for (int i = 0; i < a.getNumLandmarks(); ++i)
+        ASSERT_EQ(a.getLandmark(i), b.getLandmark(i));
+
+    for (int s = 0; s < 338; s += 7) {
+        for (int g = 0; g < 338; g += 5)
+            ASSERT_EQ(a.getLowerBound(s, g), b.getLowerBound(s, g));
+    }
+
+    // tables of default map do not fit test map
+    ALTAlgorithm other;
+    ASSERT_TRUE(other.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+    Landmarks otherLandmarks;
+    ASSERT_FALSE(otherLandmarks.load(tableFile, other.getGraph()));
+
+    // landmark count above number of nodes, or beyond the file end
+    std::string content;
+    {
+        std::ifstream in(tableFile, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+    }
+
+    Landmarks corrupt;
+    for (int32_t count : {std::numeric_limits<int32_t>::max(), 300}) {
+        std::string bad = content;
+        memcpy(&bad[12], &count, sizeof(count));
+        std::ofstream(tableFile, std::ios::binary) << bad;
+        ASSERT_FALSE(corrupt.load(tableFile, built.getGraph()));
+    }
+
+    std::ofstream(tableFile, std::ios::binary)
+        << content.substr(0, content.size() - 4);
+    ASSERT_FALSE(corrupt.load(tableFile, built.getGraph()));
+
+    std::ofstream(tableFile, std::ios::binary) << content;
+    ASSERT_TRUE(corrupt.load(tableFile, built.getGraph()));
+
+    remove(tableFile);
+}
+
+
+/**
+ *   @brief  Check landmark tables are rejected for a map of the same
+ *           size with one obstacle moved \n
+ *           Test expects load to fail, tables to be recomputed on
+ *           init, and costs to match A star on the changed map
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testALT, rejectTablesOfMovedObstacle) {
+    const char *tableFile = "alt_moved.bin";
+    const char *mapFile = "alt_moved.csv";
+    ALTAlgorithm built(6);
+
+    remove(tableFile);
+    built.setTableFile(tableFile);
+    ASSERT_TRUE(built.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    // move first obstacle of default map to first open cell after it
+    std::ifstream in(DEFAUTL_DEFAULT_MAP);
+    std::string text((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+    size_t obstacle = text.find('O');
+    ASSERT_NE(std::string::npos, obstacle);
+    size_t open = text.find('1', obstacle);
+    ASSERT_NE(std::string::npos, open);
+    text[obstacle] = '1';
+    text[open] = 'O';
+
+    std::ofstream out(mapFile);
+    out << text;
+    out.close();
+
+    ALTAlgorithm moved(6);
+    ASSERT_TRUE(moved.PathFindingAlgorithm::init(mapFile));
+    ASSERT_EQ(built.getGraph().getNumEdges(),
+              moved.getGraph().getNumEdges());
+
+    Landmarks stale;
+    ASSERT_FALSE(stale.load(tableFile, moved.getGraph()));
+
+    // stale file is recomputed instead of used
+    ALTAlgorithm reloaded(6);
+    reloaded.setTableFile(tableFile);
+    ASSERT_TRUE(reloaded.PathFindingAlgorithm::init(mapFile));
+    ASSERT_GT(reloaded.getLandmarks().getPreprocessTime(), 0);
+
+    AStarAlgorithm aStar;
+    int aStarExpanded = 0;
+    int altExpanded = 0;
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+    compareWithAStar(aStar, reloaded, 7, 5, aStarExpanded, altExpanded);
+
+    remove(tableFile);
+    remove(mapFile);
+}
@@ -0,0 +1,184 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file AnytimeTest.cpp
+ *  @brief Implementation of unit test for anytime A star search
+ *
+ *  This file contains unit tests of computPathAnytime of class
+ *  template BasicAStarAlgorithm.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Write random map csv file with given percent of obstacles
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  percent of obstacle cells in int
+ *   @return none
+*/
+static void writeRandomMap(const std::string &file, int rows, int cols,
+                           int percent) {
+    std::ofstream out(file);
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> dist(0, 99);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            out << ((dist(rng) < percent) ? "O" : "1");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Check anytime search without deadline pressure ends with
+ *           the shortest path \n
+ *           Test expects bound 1 and the cost of A star for every
+ *           query, and no path for unreachable ones
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testAnytime, convergeToShortest) {
+    AStarAlgorithm aStar;
+    AStarAlgorithm anytime;
+    auto later = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(anytime.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (int s = 1; s <= 338; s += 11) {
+        for (int g = 338; g >= 1; g -= 23) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+
+            anytime.PathFindingAlgorithm::setParam(s, g);
+            bool found = aStar.computPath(1.0);
+
+            ASSERT_EQ(found, anytime.computPathAnytime(3.0, later));
+
+            if (!found) {
+                ASSERT_EQ(std::numeric_limits<double>::infinity(),
+                          anytime.getSuboptimalityBound());
+                continue;
+            }
+
+            ASSERT_EQ(1, anytime.getSuboptimalityBound());
+            ASSERT_NEAR(aStar.getTotalCost(), anytime.getTotalCost(), 1e-9);
+            ASSERT_EQ(s, anytime.getPath().front());
+            ASSERT_EQ(g, anytime.getPath().back());
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check reported bound holds and rounds reuse earlier work \n
+ *           Test expects cost within bound times shortest after one
+ *           round, and fewer expansions lowering weight from 3 to 1
+ *           than running weighted A star at every weight, and no
+ *           path once deadline has passed
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testAnytime, boundAndReuse) {
+    const char *mapFile = "anytime_random.csv";
+    const int rows = 120;
+    const int cols = 120;
+    auto later = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    writeRandomMap(mapFile, rows, cols, 25);
+
+    AStarAlgorithm aStar;
+    AStarAlgorithm anytime;
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(anytime.PathFindingAlgorithm::init(mapFile));
+
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    int numQueries = 0;
+    long anytimeExpanded = 0;
+    long restartExpanded = 0;
+
+    while (numQueries < 20) {
+        int s = indexDist(rng);
+        int g = indexDist(rng);
+
+        if (!aStar.PathFindingAlgorithm::setParam(s, g) ||
+            !aStar.computPath(1.0))
+            continue;
+
+        ++numQueries;
+        double shortest = aStar.getTotalCost();
+        anytime.PathFindingAlgorithm::setParam(s, g);
+
+        // one round
+        ASSERT_TRUE(anytime.computPathAnytime(3.0, later, 0));
+        ASSERT_LE(anytime.getSuboptimalityBound(), 3.0);
+        ASSERT_LE(anytime.getTotalCost(),
+                  anytime.getSuboptimalityBound() * shortest + 1e-9);
+
+        // all rounds against searching again at each weight
+        ASSERT_TRUE(anytime.computPathAnytime(3.0, later, 0.5));
+        ASSERT_NEAR(shortest, anytime.getTotalCost(), 1e-9);
+        anytimeExpanded += anytime.getNumExpanded();
+
+        for (double w = 3.0; w >= 1.0; w -= 0.5) {
+            aStar.computPath(w);
+            restartExpanded += aStar.getNumExpanded();
+        }
+    }
+
+    ASSERT_LT(anytimeExpanded, restartExpanded);
+
+    // deadline passes before first round ends
+    ASSERT_FALSE(anytime.computPathAnytime(
+                     1.0, std::chrono::steady_clock::now()));
+    ASSERT_TRUE(anytime.getPath().empty());
+    ASSERT_EQ(std::numeric_limits<double>::infinity(),
+              anytime.getSuboptimalityBound());
+
+    remove(mapFile);
+}
@@ -0,0 +1,131 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file BatchQueryTest.cpp
+ *  @brief Implementation of unit test for batch path queries
+ *
+ *  This file contains unit tests of ThreadPool and of answering many
+ *  path queries in parallel over one graph.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "ThreadPool.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check every loop iteration runs once on a valid worker \n
+ *           Test expects each index to be visited exactly once over
+ *           several loops on the same pool
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testThreadPool, parallelForVisitsEachIndexOnce) {
+    ThreadPool pool(4);
+    const int n = 10000;
+
+    ASSERT_EQ(4, pool.getNumThreads());
+
+    for (int loop = 0; loop < 3; ++loop) {
+        vector<std::atomic<int>> hits(n);
+        std::atomic<int> badWorker(0);
+
+        for (auto& h : hits)
+            h = 0;
+
+        pool.parallelFor(n, [&](int worker, int i) {
+            if ((worker < 0) || (worker >= pool.getNumThreads()))
+                ++badWorker;
+            ++hits[i];
+        });
+
+        ASSERT_EQ(0, badWorker);
+        for (auto& h : hits)
+            ASSERT_EQ(1, h);
+    }
+
+    // empty loop returns immediately
+    pool.parallelFor(0, [](int, int) {});
+}
+
+
+/**
+ *   @brief  Check batch results match single queries in order \n
+ *           Test expects the same found flag, cost and path as
+ *           computPath for every query, including invalid ones
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testBatchQuery, matchSingleQueries) {
+    AStarAlgorithm aStar;
+    vector<PathQuery> queries;
+    vector<PathResult> results;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (int s = 1; s <= 338; s += 7) {
+        for (int g = 338; g >= 1; g -= 29)
+            queries.push_back({s, g, (s % 2 == 0) ? 1.0 : 0.0});
+    }
+
+    // out of map and obstacle queries
+    queries.push_back({0, 338, 1.0});
+    queries.push_back({1, 339, 1.0});
+    queries.push_back({1, 53, 1.0});
+
+    for (int numThreads : {1, 4}) {
+        int numFound = aStar.computPaths(queries, results, numThreads);
+
+        ASSERT_EQ(queries.size(), results.size());
+
+        int expectFound = 0;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            bool found = aStar.PathFindingAlgorithm::setParam(
+                             queries[i].start, queries[i].goal) &&
+                         aStar.computPath(queries[i].weight);
+
+            ASSERT_EQ(found, results[i].found);
+
+            if (found) {
+                ++expectFound;
+                ASSERT_EQ(aStar.getTotalCost(), results[i].totalCost);
+                ASSERT_EQ(aStar.getPath(), results[i].path);
+                ASSERT_EQ(aStar.getNumExpanded(), results[i].numExpanded);
+            }
+        }
+
+        ASSERT_EQ(expectFound, numFound);
+        ASSERT_FALSE(results[results.size() - 1].found);
+    }
+}
@@ -0,0 +1,156 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file BidirectionalTest.cpp
+ *  @brief Implementation of unit test for bidirectional search
+ *
+ *  This file contains unit tests of bidirectional Dijkstra and
+ *  bidirectional A star, checked against one directional A star.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check bidirectional search finds the same cost as A star
+ *           on default map, with a path that follows graph edges \n
+ *           Test expects equal costs for weight 0 and 1 and a path
+ *           whose edge costs add up to total cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testBidirectional, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+    AStarAlgorithm biAStar;
+    const int queries[][2] = {{1, 338}, {144, 316}, {338, 1}, {29, 312},
+                              {1, 1}, {1, 2}};
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(biAStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (auto& q : queries) {
+        aStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+        biAStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+
+        for (double weight : {0.0, 1.0}) {
+            ASSERT_TRUE(aStar.computPath(weight));
+            ASSERT_TRUE(biAStar.computPathBidirectional(weight));
+            ASSERT_EQ(aStar.getTotalCost(), biAStar.getTotalCost());
+
+            vector<int> path = biAStar.getPath();
+            ASSERT_EQ(q[0], path.front());
+            ASSERT_EQ(q[1], path.back());
+
+            double cost = 0;
+            for (size_t i = 1; i < path.size(); ++i)
+                cost += biAStar.getGraph().getCost(path[i-1] - 1, path[i] - 1);
+            ASSERT_EQ(biAStar.getTotalCost(), cost);
+        }
+    }
+
+    // long query expands fewer nodes than one directional Dijkstra
+    aStar.PathFindingAlgorithm::setParam(1, 338);
+    biAStar.PathFindingAlgorithm::setParam(1, 338);
+    aStar.computPath(0.0);
+    biAStar.computPathBidirectional(0.0);
+
+    ASSERT_LT(biAStar.getNumExpanded(), aStar.getNumExpanded());
+
+    // unreachable goal
+    biAStar.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    biAStar.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(biAStar.computPathBidirectional(1.0));
+    ASSERT_FALSE(biAStar.computPathBidirectional(0.0));
+}
+
+
+/**
+ *   @brief  Check bidirectional search against A star on random maps \n
+ *           Test expects a path exactly when A star finds one, with the
+ *           same cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testBidirectional, randomMaps) {
+    const char *mapFile = "bidirectional_random.csv";
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 20; ++m) {
+        const int rows = 27;
+        const int cols = 22;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 30) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        AStarAlgorithm biAStar;
+
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(biAStar.PathFindingAlgorithm::init(mapFile));
+
+        std::uniform_int_distribution<int> indexDist(1, rows * cols);
+
+        for (int q = 0; q < 50; ++q) {
+            int s = indexDist(rng);
+            int g = indexDist(rng);
+
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            biAStar.PathFindingAlgorithm::setParam(s, g);
+
+            for (double weight : {0.0, 1.0}) {
+                bool found = aStar.computPath(weight);
+                ASSERT_EQ(found, biAStar.computPathBidirectional(weight));
+
+                if (found) {
+                    ASSERT_EQ(aStar.getTotalCost(), biAStar.getTotalCost());
+                }
+            }
+        }
+    }
+
+    remove(mapFile);
+}
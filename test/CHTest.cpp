@@ -0,0 +1,149 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file CHTest.cpp
+ *  @brief Implementation of unit test for CHAlgorithm
+ *
+ *  This file contains unit tests of contraction hierarchy queries,
+ *  checked against A star on the provided maps and on random maps.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "CHAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Compare hierarchy queries with A star for pairs of indices
+ *           and check every path follows graph edges
+ *
+ *   @param  reference to A star initialized with map
+ *   @param  reference to CHAlgorithm initialized with same map
+ *   @param  first index and step between start indices in int
+ *   @param  step between goal indices in int
+ *   @return none
+*/
+static void compareWithAStar(AStarAlgorithm &aStar, CHAlgorithm &ch,
+                             int startStep, int goalStep) {
+    int numNodes = ch.getGraph().getNumNodes();
+
+    for (int s = 1; s <= numNodes; s += startStep) {
+        for (int g = 1; g <= numNodes; g += goalStep) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            ch.PathFindingAlgorithm::setParam(s, g);
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, ch.computPath(1.0));
+
+            if (!found)
+                continue;
+
+            ASSERT_EQ(aStar.getTotalCost(), ch.getTotalCost());
+
+            vector<int> path = ch.getPath();
+            ASSERT_EQ(s, path.front());
+            ASSERT_EQ(g, path.back());
+
+            double cost = 0;
+            for (size_t i = 1; i < path.size(); ++i)
+                cost += ch.getGraph().getCost(path[i-1] - 1, path[i] - 1);
+            ASSERT_EQ(ch.getTotalCost(), cost);
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check hierarchy queries on default map match A star \n
+ *           Test expects equal costs and connected paths
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testCH, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+    CHAlgorithm ch;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(ch.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    compareWithAStar(aStar, ch, 5, 2);
+
+    // unreachable goal
+    ch.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    ch.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(ch.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check hierarchy queries against A star on random maps \n
+ *           Test expects a path exactly when A star finds one, with the
+ *           same cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testCH, randomMaps) {
+    const char *mapFile = "ch_random.csv";
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 5; ++m) {
+        const int rows = 19;
+        const int cols = 23;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 10 + 5 * m) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        CHAlgorithm ch;
+
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(ch.PathFindingAlgorithm::init(mapFile));
+
+        compareWithAStar(aStar, ch, 7, 5);
+    }
+
+    remove(mapFile);
+}
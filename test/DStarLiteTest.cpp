@@ -0,0 +1,207 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DStarLiteTest.cpp
+ *  @brief Implementation of unit test for DStarLiteAlgorithm
+ *
+ *  This file contains unit tests of incremental replanning after cell
+ *  changes and start moves, checked against searches from scratch.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "DStarLiteAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Write map csv file with obstacle cells marked
+ *
+ *   @param  output file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  reference to obstacle flag of each cell
+ *   @return none
+*/
+static void writeMap(const std::string &file, int rows, int cols,
+                     const vector<bool> &blocked) {
+    std::ofstream out(file);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            out << (blocked[i * cols + j] ? "O" : "1");
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Check replanned paths after obstacles appear and disappear
+ *           match A star on the changed map \n
+ *           Test expects equal costs, paths avoiding obstacles, and
+ *           fewer expansions than searching from scratch
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDStarLite, repairAfterObstacleChanges) {
+    const char *mapFile = "dstar_random.csv";
+    const int rows = 20;
+    const int cols = 25;
+    const int obstacle = std::numeric_limits<int>::max();
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+    std::uniform_int_distribution<int> indexDist(1, rows * cols);
+    vector<bool> blocked(rows * cols);
+
+    for (int i = 0; i < rows * cols; ++i)
+        blocked[i] = cellDist(rng) < 20;
+    blocked[0] = false;
+    blocked[rows * cols - 1] = false;
+    writeMap(mapFile, rows, cols, blocked);
+
+    DStarLiteAlgorithm dStar;
+    ASSERT_TRUE(dStar.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(dStar.PathFindingAlgorithm::setParam(1, rows * cols));
+    dStar.computPath(1.0);
+
+    int repairExpanded = 0;
+    int scratchExpanded = 0;
+
+    for (int round = 0; round < 30; ++round) {
+        vector<CellChange> changes;
+
+        for (int c = 0; c < 3; ++c) {
+            int index = indexDist(rng);
+            if ((index == 1) || (index == rows * cols))
+                continue;
+
+            blocked[index - 1] = !blocked[index - 1];
+            changes.push_back({index, blocked[index - 1] ? obstacle : 1});
+        }
+
+        ASSERT_TRUE(dStar.updateCells(changes));
+        writeMap(mapFile, rows, cols, blocked);
+
+        AStarAlgorithm aStar;
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::setParam(1, rows * cols));
+
+        bool found = aStar.computPath(1.0);
+        ASSERT_EQ(found, dStar.computPath(1.0));
+        repairExpanded += dStar.getNumExpanded();
+
+        DStarLiteAlgorithm scratch;
+        scratch.PathFindingAlgorithm::init(mapFile);
+        scratch.PathFindingAlgorithm::setParam(1, rows * cols);
+        scratch.computPath(1.0);
+        scratchExpanded += scratch.getNumExpanded();
+
+        if (!found)
+            continue;
+
+        ASSERT_EQ(aStar.getTotalCost(), dStar.getTotalCost());
+
+        vector<int> path = dStar.getPath();
+        ASSERT_EQ(1, path.front());
+        ASSERT_EQ(rows * cols, path.back());
+
+        double cost = 0;
+        for (size_t i = 1; i < path.size(); ++i)
+            cost += aStar.getGraph().getCost(path[i-1] - 1, path[i] - 1);
+        ASSERT_EQ(dStar.getTotalCost(), cost);
+    }
+
+    ASSERT_LT(repairExpanded, scratchExpanded);
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Check replanning while start moves along its path and cell
+ *           costs change ahead of it \n
+ *           Test expects costs of a search from scratch on the same
+ *           map
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDStarLite, movingStartAndCostChanges) {
+    DStarLiteAlgorithm dStar;
+    const int goal = 338;
+    int start = 1;
+
+    ASSERT_TRUE(dStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    dStar.PathFindingAlgorithm::setParam(start, goal);
+    ASSERT_TRUE(dStar.computPath(1.0));
+
+    vector<CellChange> history;
+
+    for (int step = 0; step < 10; ++step) {
+        vector<int> path = dStar.getPath();
+        if (path.size() < 4)
+            break;
+
+        // move two cells and make the cell after next expensive
+        start = path[2];
+        vector<CellChange> changes = {{path[3], 9}};
+        if (path[3] == goal)
+            changes.clear();
+
+        history.insert(history.end(), changes.begin(), changes.end());
+        ASSERT_TRUE(dStar.updateCells(changes));
+        ASSERT_TRUE(dStar.PathFindingAlgorithm::setParam(start, goal));
+        ASSERT_TRUE(dStar.computPath(1.0));
+
+        DStarLiteAlgorithm scratch;
+        scratch.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP);
+        ASSERT_TRUE(scratch.updateCells(history));
+        scratch.PathFindingAlgorithm::setParam(start, goal);
+        ASSERT_TRUE(scratch.computPath(1.0));
+
+        ASSERT_EQ(scratch.getTotalCost(), dStar.getTotalCost());
+        ASSERT_EQ(start, dStar.getPath().front());
+        ASSERT_EQ(goal, dStar.getPath().back());
+    }
+
+    // invalid changes
+    ASSERT_FALSE(dStar.updateCells({{0, 1}}));
+    ASSERT_FALSE(dStar.updateCells({{339, 1}}));
+    ASSERT_FALSE(dStar.updateCells({{5, 256}}));
+}
@@ -0,0 +1,153 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DeltaSteppingTest.cpp
+ *  @brief Implementation of unit test for DeltaStepping
+ *
+ *  This file contains unit tests of parallel delta-stepping against
+ *  Dijkstra over the whole map graph.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "DeltaStepping.hpp"
+#include "GraphSearch.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+
+
+/**
+ *   @brief  Compare delta-stepping costs with Dijkstra from several
+ *           start nodes and bucket widths
+ *
+ *   @param  reference to graph
+ *   @param  reference to delta-stepping
+ *   @param  step between start node ids in int
+ *   @return none
+*/
+static void compareWithDijkstra(const Graph &graph, DeltaStepping &delta,
+                                int startStep) {
+    SearchContext<BinaryHeap> context;
+    std::vector<double> costs;
+    auto zero = [](int) { return 0.0; };
+    int numExpanded = 0;
+
+    for (int s = 0; s < graph.getNumNodes(); s += startStep) {
+        aStarSearch(graph, context, s, -1, 0, zero, numExpanded);
+
+        for (double width : {0.0, 0.5, 1.0, 2.5, 50.0}) {
+            delta.setDelta(width);
+            delta.compute(graph, s, costs);
+
+            ASSERT_EQ(static_cast<size_t>(graph.getNumNodes()),
+                      costs.size());
+
+            for (int v = 0; v < graph.getNumNodes(); ++v)
+                ASSERT_EQ(context.getCost(v), costs[v]);
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check delta-stepping on provided maps \n
+ *           Test expects every cost to equal Dijkstra's, infinity for
+ *           unreachable nodes
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDeltaStepping, costShouldMatchDijkstra) {
+    AStarAlgorithm aStar;
+    DeltaStepping delta(2);
+
+    ASSERT_EQ(2, delta.getNumThreads());
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    compareWithDijkstra(aStar.getGraph(), delta, 23);
+
+    // automatic width is the largest edge cost
+    delta.setDelta(0);
+    std::vector<double> costs;
+    delta.compute(aStar.getGraph(), 0, costs);
+    ASSERT_EQ(1.5, delta.getDelta());
+    ASSERT_GT(delta.getNumBuckets(), 0);
+
+    // node 15 cannot be reached from node 1
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+    compareWithDijkstra(aStar.getGraph(), delta, 5);
+    delta.compute(aStar.getGraph(), 0, costs);
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), costs[14]);
+}
+
+
+/**
+ *   @brief  Check delta-stepping on random maps large enough to split
+ *           buckets over workers \n
+ *           Test expects costs to equal Dijkstra's for any number of
+ *           threads
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDeltaStepping, randomMaps) {
+    const char *mapFile = "delta_random.csv";
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 3; ++m) {
+        const int rows = 70;
+        const int cols = 90;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 10 + 10 * m) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+
+        for (int numThreads : {1, 3}) {
+            DeltaStepping delta(numThreads);
+            compareWithDijkstra(aStar.getGraph(), delta, 1501);
+        }
+    }
+
+    remove(mapFile);
+}
@@ -0,0 +1,129 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file DistanceMatrixTest.cpp
+ *  @brief Implementation of unit test for many-to-many cost matrices
+ *
+ *  This file contains unit tests of computing costs from many sources
+ *  to many targets at once, against single Dijkstra queries.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check matrix matches single queries \n
+ *           Test expects every cost to match computPath with weight 0,
+ *           infinity for obstacles and indices outside map, and paths
+ *           from source to target when asked for
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDistanceMatrix, matchSingleQueries) {
+    const double inf = std::numeric_limits<double>::infinity();
+    AStarAlgorithm aStar;
+    AStarAlgorithm single;
+
+    // repeated sources and targets, an obstacle (53) and outside map
+    const vector<int> sources = {1, 144, 338, 29, 144, 53, 0};
+    const vector<int> targets = {338, 316, 1, 29, 316, 200, 53, 339, 144};
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(single.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (int numThreads : {1, 4}) {
+        vector<double> costs;
+        vector<vector<int>> paths;
+        int numFound = aStar.computCostMatrix(sources, targets, costs,
+                                              &paths, numThreads);
+
+        ASSERT_EQ(sources.size() * targets.size(), costs.size());
+        ASSERT_EQ(costs.size(), paths.size());
+
+        int expectFound = 0;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            for (size_t j = 0; j < targets.size(); ++j) {
+                size_t entry = i * targets.size() + j;
+                bool found =
+                    single.PathFindingAlgorithm::setParam(sources[i],
+                                                          targets[j]) &&
+                    single.computPath(0.0);
+
+                if (!found) {
+                    ASSERT_EQ(inf, costs[entry]);
+                    ASSERT_TRUE(paths[entry].empty());
+                    continue;
+                }
+
+                ++expectFound;
+                ASSERT_EQ(single.getTotalCost(), costs[entry]);
+                ASSERT_EQ(sources[i], paths[entry].front());
+                ASSERT_EQ(targets[j], paths[entry].back());
+            }
+        }
+
+        ASSERT_EQ(expectFound, numFound);
+    }
+
+    // costs only
+    vector<double> costs;
+    aStar.computCostMatrix(sources, targets, costs);
+    ASSERT_EQ(0, costs[3 * targets.size() + 3]);
+    ASSERT_EQ(inf, costs[targets.size() + 6]);
+}
+
+
+/**
+ *   @brief  Check unreachable targets and empty inputs \n
+ *           Test expects infinity for a target behind walls, and empty
+ *           matrices for empty sources or targets
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testDistanceMatrix, unreachableAndEmpty) {
+    AStarAlgorithm aStar;
+    vector<double> costs;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+
+    ASSERT_EQ(1, aStar.computCostMatrix({1}, {15, 36}, costs));
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), costs[0]);
+    ASSERT_EQ(9.5, costs[1]);
+
+    ASSERT_EQ(0, aStar.computCostMatrix({}, {15, 36}, costs));
+    ASSERT_TRUE(costs.empty());
+    ASSERT_EQ(0, aStar.computCostMatrix({1, 2}, {}, costs));
+    ASSERT_TRUE(costs.empty());
+}
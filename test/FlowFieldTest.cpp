@@ -0,0 +1,139 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file FlowFieldTest.cpp
+ *  @brief Implementation of unit test for FlowFieldAlgorithm
+ *
+ *  This file contains unit tests of paths read from flow fields and of
+ *  the per goal field cache.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "FlowFieldAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check paths of many starts to one goal match A star \n
+ *           Test expects equal costs, connected paths, and the field to
+ *           be computed once
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testFlowField, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+    FlowFieldAlgorithm flow;
+    const Graph &graph = aStar.getGraph();
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(flow.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (int g : {338, 144, 29}) {
+        int numBuilt = 0;
+
+        for (int s = 1; s <= 338; s += 3) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            flow.PathFindingAlgorithm::setParam(s, g);
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, flow.computPath(1.0));
+
+            if (flow.getNumExpanded() > 0)
+                ++numBuilt;
+
+            if (!found)
+                continue;
+
+            ASSERT_EQ(aStar.getTotalCost(), flow.getTotalCost());
+
+            vector<int> path = flow.getPath();
+            ASSERT_EQ(s, path.front());
+            ASSERT_EQ(g, path.back());
+
+            double cost = 0;
+            for (size_t i = 1; i < path.size(); ++i)
+                cost += graph.getCost(path[i-1] - 1, path[i] - 1);
+            ASSERT_EQ(flow.getTotalCost(), cost);
+        }
+
+        ASSERT_EQ(1, numBuilt);
+    }
+
+    ASSERT_EQ(3, flow.getNumCached());
+
+    // unreachable goal
+    flow.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    ASSERT_EQ(0, flow.getNumCached());
+    flow.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(flow.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check least recently used fields are dropped from cache \n
+ *           Test expects a field to be rebuilt only after it was
+ *           dropped
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testFlowField, cacheEviction) {
+    FlowFieldAlgorithm flow(2);
+
+    ASSERT_TRUE(flow.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    auto isBuilt = [&](int s, int g) {
+        flow.PathFindingAlgorithm::setParam(s, g);
+        flow.computPath(0.0);
+        return flow.getNumExpanded() > 0;
+    };
+
+    ASSERT_TRUE(isBuilt(1, 338));
+    ASSERT_TRUE(isBuilt(1, 144));
+    ASSERT_FALSE(isBuilt(2, 338));
+
+    // 144 is least recently used and dropped
+    ASSERT_TRUE(isBuilt(1, 29));
+    ASSERT_FALSE(isBuilt(3, 338));
+    ASSERT_TRUE(isBuilt(3, 144));
+    ASSERT_EQ(2, flow.getNumCached());
+
+    flow.setCacheSize(1);
+    ASSERT_EQ(1, flow.getNumCached());
+    ASSERT_FALSE(isBuilt(5, 144));
+
+    // field of goal reads its own cost as 0
+    const FlowField &field = flow.getFlowField(144);
+    ASSERT_EQ(0, field.getCost(flow.getGrid().toId(144)));
+    ASSERT_EQ(-1, field.getNextHop(flow.getGrid().toId(144)));
+}
@@ -0,0 +1,132 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file GraphTest.cpp
+ *  @brief Implementation of unit test for Graph
+ *
+ *  This file contains unit tests of the compressed sparse row graph
+ *  built from a map.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "Graph.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check graph built from test map has one row of edges per
+ *           node with costs taken from destination cell \n
+ *           Test expects neighbors and costs of corner and inner nodes
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGraph, buildCompressedRows) {
+    AStarAlgorithm aStar;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+
+    const Graph &graph = aStar.getGraph();
+    ASSERT_EQ(36, graph.getNumNodes());
+
+    // 4 corners with 3 neighbors, 16 border nodes with 5, 16 inner with 8
+    ASSERT_EQ(4 * 3 + 16 * 5 + 16 * 8, graph.getNumEdges());
+
+    // node 1 (id 0) connects to 2, 7 and 8
+    vector<int> targets;
+    for (int e = graph.beginEdge(0); e < graph.endEdge(0); ++e)
+        targets.push_back(graph.getTarget(e));
+    ASSERT_EQ(vector<int>({1, 6, 7}), targets);
+
+    // straight, diagonal and obstacle costs
+    ASSERT_EQ(1.0, graph.getCost(0, 1));
+    ASSERT_EQ(1.5, graph.getCost(14, 21));
+    ASSERT_EQ(Graph::infinity(), graph.getCost(0, 7));
+
+    // no edge between nodes that are not adjacent
+    ASSERT_EQ(Graph::infinity(), graph.getCost(0, 2));
+}
+
+
+/**
+ *   @brief  Check graph memory footprint per map cell \n
+ *           Test expects less than 100 bytes per cell for an
+ *           8-connected grid
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGraph, memoryPerCell) {
+    AStarAlgorithm aStar;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    const Graph &graph = aStar.getGraph();
+    double bytesPerCell = static_cast<double>(graph.getMemoryUsage()) /
+                          graph.getNumNodes();
+
+    ASSERT_LT(bytesPerCell, 100);
+}
+
+
+/**
+ *   @brief  Check reversed graph holds every passable edge backward
+ *           with the same cost \n
+ *           Test expects each passable edge to appear reversed once and
+ *           edges into obstacles to be dropped
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGraph, buildReverse) {
+    AStarAlgorithm aStar;
+    Graph reversed;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+
+    const Graph &graph = aStar.getGraph();
+    graph.buildReverse(reversed);
+
+    int numPassable = 0;
+    for (int n = 0; n < graph.getNumNodes(); ++n) {
+        graph.forEachNeighbor(n, [&](int m, double cost) {
+            ++numPassable;
+            ASSERT_EQ(cost, reversed.getCost(m, n));
+        });
+    }
+
+    ASSERT_EQ(numPassable, reversed.getNumEdges());
+    ASSERT_EQ(graph.getNumNodes(), reversed.getNumNodes());
+
+    // edge from 15 into obstacle 9 is dropped, 16 to 15 is kept
+    ASSERT_EQ(Graph::infinity(), reversed.getCost(8, 14));
+    ASSERT_EQ(1, reversed.getCost(14, 15));
+}
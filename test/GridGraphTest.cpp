@@ -0,0 +1,131 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file GridGraphTest.cpp
+ *  @brief Implementation of unit test for GridAStarAlgorithm
+ *
+ *  This file contains unit tests of A star running directly on the
+ *  padded cell grid with 4 and 8 connectivity.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "GridAStarAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check 8-connected grid search finds the same cost as
+ *           graph based A star \n
+ *           Test expects costs to match for every query
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGridAStar, costShouldMatchGraph) {
+    AStarAlgorithm aStar;
+    Grid8AStarAlgorithm grid;
+    const int queries[][2] = {{1, 338}, {144, 316}, {338, 1}, {29, 312},
+                              {1, 1}};
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(grid.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    // no edge is built for the grid search
+    ASSERT_EQ(0, grid.getGraph().getNumEdges());
+
+    for (auto& q : queries) {
+        aStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+        grid.PathFindingAlgorithm::setParam(q[0], q[1]);
+
+        for (double weight : {0.0, 1.0}) {
+            ASSERT_TRUE(aStar.computPath(weight));
+            ASSERT_TRUE(grid.computPath(weight));
+            ASSERT_EQ(aStar.getTotalCost(), grid.getTotalCost());
+            ASSERT_EQ(q[0], grid.getPath().front());
+            ASSERT_EQ(q[1], grid.getPath().back());
+        }
+    }
+
+    // unreachable goal
+    grid.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    grid.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(grid.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check 4-connected grid search only moves straight \n
+ *           Test expects corner to corner cost of test map to be 10
+ *           with 4 connectivity and 9.5 with 8 connectivity
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGridAStar, fourConnectivity) {
+    Grid4AStarAlgorithm grid4;
+    Grid8AStarAlgorithm grid8;
+
+    grid4.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    grid4.PathFindingAlgorithm::setParam(1, 36);
+    grid8.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    grid8.PathFindingAlgorithm::setParam(1, 36);
+
+    ASSERT_TRUE(grid4.computPath(1.0));
+    ASSERT_TRUE(grid8.computPath(1.0));
+    ASSERT_EQ(10, grid4.getTotalCost());
+    ASSERT_EQ(9.5, grid8.getTotalCost());
+
+    // consecutive cells differ by one row or one column
+    vector<int> path = grid4.getPath();
+    for (size_t i = 1; i < path.size(); ++i) {
+        int diff = path[i] - path[i - 1];
+        ASSERT_TRUE(diff == 1 || diff == -1 || diff == 6 || diff == -6);
+    }
+}
+
+
+/**
+ *   @brief  Check grid memory footprint per map cell \n
+ *           Test expects less than 2 bytes per cell including padding
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testGridAStar, memoryPerCell) {
+    Grid8AStarAlgorithm grid;
+
+    ASSERT_TRUE(grid.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    double bytesPerCell = static_cast<double>(grid.getGrid().getMemoryUsage())
+                          / 338;
+
+    ASSERT_LT(bytesPerCell, 2);
+}
@@ -0,0 +1,280 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file HPATest.cpp
+ *  @brief Implementation of unit test for HPAAlgorithm
+ *
+ *  This file contains unit tests of hierarchical path finding, checked
+ *  against A star on the provided maps and on random maps.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "HPAAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Compare hierarchical paths with A star for pairs of indices
+ *           and check every path moves between neighboring cells
+ *
+ *   @param  reference to A star initialized with map
+ *   @param  reference to HPAAlgorithm initialized with same map
+ *   @param  first index and step between start indices in int
+ *   @param  step between goal indices in int
+ *   @param  reference to worst ratio of path cost to A star cost
+ *   @return none
+*/
+static void compareWithAStar(AStarAlgorithm &aStar, HPAAlgorithm &hpa,
+                             int startStep, int goalStep, double &worst) {
+    int numNodes = hpa.getGraph().getNumNodes();
+    const Graph &graph = aStar.getGraph();
+
+    for (int s = 1; s <= numNodes; s += startStep) {
+        for (int g = 1; g <= numNodes; g += goalStep) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            hpa.PathFindingAlgorithm::setParam(s, g);
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, hpa.computPath(1.0));
+
+            if (!found)
+                continue;
+
+            ASSERT_GE(hpa.getTotalCost(), aStar.getTotalCost());
+            if (aStar.getTotalCost() > 0) {
+                worst = std::max(worst,
+                                 hpa.getTotalCost() / aStar.getTotalCost());
+            }
+
+            vector<int> path = hpa.getPath();
+            ASSERT_EQ(s, path.front());
+            ASSERT_EQ(g, path.back());
+
+            double cost = 0;
+            for (size_t i = 1; i < path.size(); ++i)
+                cost += graph.getCost(path[i-1] - 1, path[i] - 1);
+            ASSERT_EQ(hpa.getTotalCost(), cost);
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check hierarchical paths on default map against A star
+ *           for several cluster sizes \n
+ *           Test expects a path whenever A star finds one, no cheaper
+ *           than A star and within 1.5x of its cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testHPA, nearOptimalOnDefaultMap) {
+    AStarAlgorithm aStar;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (int size : {3, 4, 8}) {
+        HPAAlgorithm hpa(size);
+        double worst = 1;
+
+        ASSERT_TRUE(hpa.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+        ASSERT_GT(hpa.getNumAbstractNodes(), 0);
+
+        compareWithAStar(aStar, hpa, 5, 3, worst);
+
+        ASSERT_LE(worst, 1.5);
+    }
+
+    // unreachable goal
+    HPAAlgorithm hpa(2);
+    hpa.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    hpa.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(hpa.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check hierarchical paths against A star on random maps,
+ *           with and without smoothing \n
+ *           Test expects a path exactly when A star finds one, and
+ *           smoothing to never raise the cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testHPA, randomMaps) {
+    const char *mapFile = "hpa_random.csv";
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 5; ++m) {
+        const int rows = 21;
+        const int cols = 26;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 10 + 6 * m) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        HPAAlgorithm hpa(5);
+        HPAAlgorithm smooth(5);
+        double worst = 1;
+        double worstSmooth = 1;
+
+        smooth.setSmoothing(true);
+
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(hpa.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(smooth.PathFindingAlgorithm::init(mapFile));
+
+        compareWithAStar(aStar, hpa, 7, 5, worst);
+        compareWithAStar(aStar, smooth, 7, 5, worstSmooth);
+
+        for (int s = 1; s <= rows * cols; s += 11) {
+            for (int g = 1; g <= rows * cols; g += 13) {
+                if (!hpa.PathFindingAlgorithm::setParam(s, g))
+                    continue;
+                smooth.PathFindingAlgorithm::setParam(s, g);
+
+                if (hpa.computPath(1.0)) {
+                    ASSERT_TRUE(smooth.computPath(1.0));
+                    ASSERT_LE(smooth.getTotalCost(), hpa.getTotalCost());
+                }
+            }
+        }
+    }
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Write a map of given size to a csv file
+ *
+ *   @param  map file path in string
+ *   @param  number of rows in int
+ *   @param  number of columns in int
+ *   @param  function returning cost of each cell
+ *   @return none
+*/
+template <class Function>
+static void writeMap(const std::string &mapFile, int rows, int cols,
+                     Function cellCost) {
+    std::ofstream out(mapFile);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j)
+            out << ((j > 0) ? "," : "") << cellCost();
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Check paths between the same or neighboring clusters do
+ *           not detour through entrances \n
+ *           Test expects a straight path across a cluster border to
+ *           cost the same as A star, and such paths on a weighted map
+ *           to stay within 1 percent of A star on average
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testHPA, directPathBetweenNeighbors) {
+    const char *tmp = getenv("TMPDIR");
+    std::string mapFile = std::string(tmp ? tmp : "/tmp") + "/hpa_near_" +
+                          std::to_string(std::random_device()()) + ".csv";
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int> costDist(1, 9);
+    AStarAlgorithm aStar;
+
+    // open map, entrances only at the ends of each cluster border
+    writeMap(mapFile, 32, 32, []() { return 1; });
+
+    HPAAlgorithm hpa(16);
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(hpa.PathFindingAlgorithm::init(mapFile));
+
+    aStar.PathFindingAlgorithm::setParam(7 * 32 + 13, 7 * 32 + 21);
+    hpa.PathFindingAlgorithm::setParam(7 * 32 + 13, 7 * 32 + 21);
+    ASSERT_TRUE(aStar.computPath(1.0));
+    ASSERT_TRUE(hpa.computPath(1.0));
+    ASSERT_EQ(8, hpa.getTotalCost());
+    ASSERT_EQ(aStar.getTotalCost(), hpa.getTotalCost());
+
+    // weighted cells
+    const int size = 64;
+    writeMap(mapFile, size, size, [&]() { return costDist(rng); });
+
+    HPAAlgorithm weighted(8);
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(weighted.PathFindingAlgorithm::init(mapFile));
+
+    double sumRatio = 0;
+    int numQueries = 0;
+
+    for (int s = 1; s <= size * size; s += 97) {
+        for (int g = 1; g <= size * size; g += 7) {
+            int rowDiff = abs((s - 1) / size / 8 - (g - 1) / size / 8);
+            int colDiff = abs((s - 1) % size / 8 - (g - 1) % size / 8);
+
+            if ((s == g) || (rowDiff > 1) || (colDiff > 1))
+                continue;
+
+            aStar.PathFindingAlgorithm::setParam(s, g);
+            weighted.PathFindingAlgorithm::setParam(s, g);
+            ASSERT_TRUE(aStar.computPath(1.0));
+            ASSERT_TRUE(weighted.computPath(1.0));
+            ASSERT_GE(weighted.getTotalCost(), aStar.getTotalCost());
+
+            sumRatio += weighted.getTotalCost() / aStar.getTotalCost();
+            ++numQueries;
+        }
+    }
+
+    ASSERT_GT(numQueries, 100);
+    ASSERT_LT(sumRatio / numQueries, 1.01);
+
+    remove(mapFile.c_str());
+}
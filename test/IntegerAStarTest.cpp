@@ -0,0 +1,148 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file IntegerAStarTest.cpp
+ *  @brief Implementation of unit test for IntegerAStarAlgorithm
+ *
+ *  This file contains unit tests of A star over fixed-point integer
+ *  costs with a radix heap open set.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "IntegerAStarAlgorithm.hpp"
+
+
+/**
+ *   @brief  Compare integer cost search with A star for pairs of
+ *           indices, with Dijkstra and A star weights
+ *
+ *   @param  reference to A star initialized with map
+ *   @param  reference to IntegerAStarAlgorithm initialized with same map
+ *   @param  first index and step between start indices in int
+ *   @param  step between goal indices in int
+ *   @return none
+*/
+static void compareWithAStar(AStarAlgorithm &aStar,
+                             IntegerAStarAlgorithm &integer,
+                             int startStep, int goalStep) {
+    int numNodes = integer.getGraph().getNumNodes();
+
+    for (int s = 1; s <= numNodes; s += startStep) {
+        for (int g = 1; g <= numNodes; g += goalStep) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            integer.PathFindingAlgorithm::setParam(s, g);
+
+            for (double weight : {0.0, 1.0}) {
+                bool found = aStar.computPath(weight);
+                ASSERT_EQ(found, integer.computPath(weight));
+
+                if (!found)
+                    continue;
+
+                ASSERT_EQ(aStar.getTotalCost(), integer.getTotalCost());
+                ASSERT_EQ(s, integer.getPath().front());
+                ASSERT_EQ(g, integer.getPath().back());
+            }
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check integer cost search on provided maps \n
+ *           Test expects costs of A star converted back exactly
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testIntegerAStar, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+    IntegerAStarAlgorithm integer;
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(integer.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    compareWithAStar(aStar, integer, 5, 3);
+
+    // weight above 1 would break radix heap order
+    integer.PathFindingAlgorithm::setParam(1, 338);
+    ASSERT_FALSE(integer.computPath(3.0));
+    ASSERT_TRUE(integer.getPath().empty());
+
+    // unreachable goal
+    integer.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    integer.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(integer.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check integer cost search on random maps \n
+ *           Test expects a path exactly when A star finds one, with the
+ *           same cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testIntegerAStar, randomMaps) {
+    const char *mapFile = "integer_random.csv";
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 4; ++m) {
+        const int rows = 17;
+        const int cols = 22;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 10 + 8 * m) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        IntegerAStarAlgorithm integer;
+
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(integer.PathFindingAlgorithm::init(mapFile));
+
+        compareWithAStar(aStar, integer, 9, 7);
+    }
+
+    remove(mapFile);
+}
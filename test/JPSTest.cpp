@@ -0,0 +1,184 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file JPSTest.cpp
+ *  @brief Implementation of unit test for JPSAlgorithm
+ *
+ *  This file contains unit tests of Jump Point Search, checked against
+ *  A star on the provided maps and on random maps.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "JPSAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check path returned by a search moves one cell at a time,
+ *           avoids obstacles, and adds up to its total cost
+ *
+ *   @param  reference to path indices
+ *   @param  number of columns in map
+ *   @param  reference to map
+ *   @return cost of moving along path in double
+*/
+static double walkPath(const vector<int> &path, int cols, const Map &map) {
+    double cost = 0;
+
+    for (size_t i = 1; i < path.size(); ++i) {
+        int dx = abs((path[i] - 1) % cols - (path[i - 1] - 1) % cols);
+        int dy = abs((path[i] - 1) / cols - (path[i - 1] - 1) / cols);
+
+        EXPECT_LE(dx, 1);
+        EXPECT_LE(dy, 1);
+        EXPECT_FALSE(map.isBlocked(path[i]));
+
+        cost += map.getCost(path[i]) * (((dx != 0) && (dy != 0)) ? 1.5 : 1);
+    }
+
+    return cost;
+}
+
+
+/**
+ *   @brief  Check JPS finds the same cost as A star on default map and
+ *           returns every cell of the path \n
+ *           Test expects equal costs, a connected path, and fewer
+ *           expanded nodes than A star
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testJPS, costShouldMatchAStar) {
+    AStarAlgorithm aStar;
+    JPSAlgorithm jps;
+    Map map;
+    const int queries[][2] = {{1, 338}, {144, 316}, {338, 1}, {29, 312},
+                              {1, 1}, {1, 2}};
+    int aStarExpanded = 0;
+    int jpsExpanded = 0;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(jps.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(jps.isUniform());
+
+    for (auto& q : queries) {
+        aStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+        jps.PathFindingAlgorithm::setParam(q[0], q[1]);
+
+        ASSERT_TRUE(aStar.computPath(1.0));
+        ASSERT_TRUE(jps.computPath(1.0));
+        ASSERT_EQ(aStar.getTotalCost(), jps.getTotalCost());
+
+        vector<int> path = jps.getPath();
+        ASSERT_EQ(q[0], path.front());
+        ASSERT_EQ(q[1], path.back());
+        ASSERT_EQ(jps.getTotalCost(),
+                  walkPath(path, map.getCol(), map));
+
+        aStarExpanded += aStar.getNumExpanded();
+        jpsExpanded += jps.getNumExpanded();
+    }
+
+    ASSERT_LT(jpsExpanded, aStarExpanded);
+
+    // unreachable goal
+    jps.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    jps.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(jps.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check JPS against A star on random maps with obstacles \n
+ *           Test expects JPS to find a path exactly when A star does,
+ *           with the same cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testJPS, randomMaps) {
+    const char *mapFile = "jps_random.csv";
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 20; ++m) {
+        const int rows = 24;
+        const int cols = 31;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 30) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        AStarAlgorithm aStar;
+        JPSAlgorithm jps;
+        Map map;
+
+        ASSERT_TRUE(map.createMap(mapFile));
+        ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+        ASSERT_TRUE(jps.PathFindingAlgorithm::init(mapFile));
+
+        std::uniform_int_distribution<int> indexDist(1, rows * cols);
+
+        for (int q = 0; q < 50; ++q) {
+            int s = indexDist(rng);
+            int g = indexDist(rng);
+
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+            jps.PathFindingAlgorithm::setParam(s, g);
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, jps.computPath(1.0));
+
+            if (found) {
+                ASSERT_EQ(aStar.getTotalCost(), jps.getTotalCost());
+                ASSERT_EQ(jps.getTotalCost(),
+                          walkPath(jps.getPath(), cols, map));
+            }
+        }
+    }
+
+    remove(mapFile);
+}
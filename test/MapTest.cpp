@@ -0,0 +1,536 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file MapTest.cpp
+ *  @brief Implementation of unit test for Map
+ *
+ *  This file contains unit tests of the obstacle bitmap and cost layer
+ *  of Map, of parsing csv maps, and of saving and opening the binary
+ *  map format.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "GridAStarAlgorithm.hpp"
+#include "JPSAlgorithm.hpp"
+#include "Map.hpp"
+#include "PathFindAlgorithm.hpp"
+
+
+/**
+ *   @brief  Check two maps have the same size and cells
+ *
+ *   @param  reference to first map
+ *   @param  reference to second map
+ *   @return none
+*/
+static void expectSameCells(Map &a, Map &b) {
+    ASSERT_EQ(a.getRow(), b.getRow());
+    ASSERT_EQ(a.getCol(), b.getCol());
+    ASSERT_EQ(a.getNumDir(), b.getNumDir());
+    ASSERT_EQ(a.hasCostLayer(), b.hasCostLayer());
+
+    for (int i = 1; i <= a.getRow() * a.getCol(); ++i) {
+        ASSERT_EQ(a.isBlocked(i), b.isBlocked(i));
+        ASSERT_EQ(a.getCost(i), b.getCost(i));
+    }
+}
+
+
+/**
+ *   @brief  Write a 64 bit header field into file content
+ *
+ *   @param  reference to file content
+ *   @param  byte offset of field in size_t
+ *   @param  field value in uint64_t
+ *   @return none
+*/
+static void setField(std::string &content, size_t offset, uint64_t value) {
+    memcpy(&content[offset], &value, sizeof(value));
+}
+
+
+/**
+ *   @brief  Read whole file
+ *
+ *   @param  file path in string
+ *   @return file content in string
+*/
+static std::string readFile(const std::string &file) {
+    std::ifstream in(file, std::ios::binary);
+    std::ostringstream content;
+
+    content << in.rdbuf();
+    return content.str();
+}
+
+
+/**
+ *   @brief  Check obstacle bits against cells of csv file \n
+ *           Test expects a cell to be blocked exactly when it is 'O'
+ *           and no cost layer for a map of cost 1 cells
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, obstacleBitsMatchFile) {
+    Map map;
+    std::ifstream in(DEFAUTL_DEFAULT_MAP);
+    std::string line;
+    std::string cell;
+    int index = 0;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_EQ(338, map.getRow() * map.getCol());
+
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+
+        while (std::getline(fields, cell, ',')) {
+            ++index;
+            bool blocked = (cell == "O") || (cell == "o");
+
+            ASSERT_EQ(blocked, map.isBlocked(index));
+            ASSERT_EQ(blocked ? std::numeric_limits<int>::max() : 1,
+                      map.getCost(index));
+        }
+    }
+
+    ASSERT_EQ(338, index);
+    ASSERT_FALSE(map.hasCostLayer());
+
+    // one bit per cell, rounded up to whole words
+    ASSERT_LE(map.getMemoryUsage(), (338 + 63) / 64 * 8u);
+}
+
+
+/**
+ *   @brief  Check changing cell costs \n
+ *           Test expects cost layer to be allocated for costs above 1,
+ *           obstacles to be set and cleared, and start or goal on an
+ *           obstacle to be rejected
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, setCost) {
+    Map map;
+    const int blocked = std::numeric_limits<int>::max();
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_TEST_MAP));
+    ASSERT_TRUE(map.setStartGoal(1, 36));
+
+    // cost 1 keeps map without cost layer
+    ASSERT_TRUE(map.setCost(2, 1));
+    ASSERT_FALSE(map.hasCostLayer());
+
+    ASSERT_TRUE(map.setCost(2, 7));
+    ASSERT_TRUE(map.hasCostLayer());
+    ASSERT_EQ(7, map.getCost(2));
+    ASSERT_EQ(1, map.getCost(1));
+    ASSERT_LE(map.getMemoryUsage(), 8u + 36u);
+
+    // obstacle keeps its cost underneath until cleared
+    ASSERT_TRUE(map.setCost(36, blocked));
+    ASSERT_TRUE(map.isBlocked(36));
+    ASSERT_EQ(blocked, map.getCost(36));
+    ASSERT_FALSE(map.setStartGoal(1, 36));
+
+    ASSERT_TRUE(map.setCost(36, 255));
+    ASSERT_FALSE(map.isBlocked(36));
+    ASSERT_EQ(255, map.getCost(36));
+    ASSERT_TRUE(map.setStartGoal(1, 36));
+
+    // costs that do not fit in one byte
+    ASSERT_FALSE(map.setCost(3, 0));
+    ASSERT_FALSE(map.setCost(3, 256));
+    ASSERT_EQ(1, map.getCost(3));
+}
+
+
+/**
+ *   @brief  Check parsing numeric cell costs \n
+ *           Test expects costs, obstacles, blanks around cells, CRLF
+ *           line breaks and blank lines to be read
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, parseCosts) {
+    const char *mapFile = "map_costs.csv";
+    Map map;
+
+    std::ofstream(mapFile) << "1,2,O\r\n 17 , o,255\r\n\n3,1,1\n\n";
+
+    ASSERT_TRUE(map.createMap(mapFile));
+    ASSERT_EQ(3, map.getRow());
+    ASSERT_EQ(3, map.getCol());
+    ASSERT_TRUE(map.hasCostLayer());
+
+    const int blocked = std::numeric_limits<int>::max();
+    const int expected[] = {1, 2, blocked, 17, blocked, 255, 3, 1, 1};
+
+    for (int i = 1; i <= 9; ++i)
+        ASSERT_EQ(expected[i - 1], map.getCost(i));
+
+    // only way around obstacles is through cost 17: 1, 4, 8, 9
+    AStarAlgorithm aStar;
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(mapFile));
+    aStar.PathFindingAlgorithm::setParam(1, 9);
+    ASSERT_TRUE(aStar.computPath(1.0));
+    ASSERT_EQ(17 + 1.5 + 1, aStar.getTotalCost());
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Check csv files that are not valid maps \n
+ *           Test expects createMap to fail on rows of different
+ *           lengths, unknown cells, costs out of [1, 255], empty cells
+ *           and files with no cell
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, rejectInvalidCsv) {
+    const char *mapFile = "map_invalid.csv";
+    const char *contents[] = {"1,1,1\n1,1\n", "1,1\n1,1,1\n",
+                              "1,x\n", "1,0\n", "1,256\n", "1,,1\n",
+                              "1,1,\n", "1 1\n", "", "\n\n"};
+    Map map;
+
+    for (auto content : contents) {
+        std::ofstream(mapFile) << content;
+        ASSERT_FALSE(map.createMap(mapFile)) << content;
+    }
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Check parsing a file split into several chunks \n
+ *           Test expects every cell to be read for any number of
+ *           threads
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, parseChunks) {
+    const char *mapFile = "map_chunks.csv";
+    const int rows = 1100;
+    const int cols = 1201;
+    std::mt19937 rng(8);
+    std::uniform_int_distribution<int> cellDist(0, 299);
+    std::vector<int> expected;
+    std::ofstream out(mapFile);
+
+    // about 4 MB, so several chunks of 1 MB
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            int c = cellDist(rng);
+
+            if (c >= 255) {
+                out << "O";
+                expected.push_back(std::numeric_limits<int>::max());
+            } else {
+                out << c + 1;
+                expected.push_back(c + 1);
+            }
+
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+    out.close();
+
+    for (int numThreads : {1, 3}) {
+        Map map;
+
+        map.setNumThreads(numThreads);
+        ASSERT_TRUE(map.createMap(mapFile));
+        ASSERT_EQ(rows, map.getRow());
+        ASSERT_EQ(cols, map.getCol());
+
+        for (int i = 1; i <= rows * cols; ++i)
+            ASSERT_EQ(expected[i - 1], map.getCost(i));
+    }
+
+    remove(mapFile);
+}
+
+
+/**
+ *   @brief  Check saving and opening binary map \n
+ *           Test expects opened map to be memory mapped with the same
+ *           cells and connectivity, and saving it again to give the
+ *           same file
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, binaryRoundTrip) {
+    const char *binFile = "map_roundtrip.map";
+    const char *binFile2 = "map_roundtrip2.map";
+    Map csv;
+
+    ASSERT_TRUE(csv.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_FALSE(csv.isMapped());
+
+    for (int pass = 0; pass < 2; ++pass) {
+        // second pass with a cost layer and 4 connectivity
+        if (pass == 1) {
+            ASSERT_TRUE(csv.setCost(30, 9));
+            ASSERT_TRUE(csv.setCost(338, 200));
+            ASSERT_TRUE(csv.setNumDir(4));
+        }
+
+        ASSERT_TRUE(csv.saveBinaryMap(binFile));
+
+        // createMap recognizes binary files
+        Map bin;
+        ASSERT_TRUE(bin.createMap(binFile));
+        ASSERT_TRUE(bin.isMapped());
+        expectSameCells(csv, bin);
+
+        ASSERT_TRUE(bin.saveBinaryMap(binFile2));
+        ASSERT_EQ(readFile(binFile), readFile(binFile2));
+    }
+
+    ASSERT_FALSE(csv.setNumDir(6));
+
+    remove(binFile);
+    remove(binFile2);
+}
+
+
+/**
+ *   @brief  Check changing cells of a memory mapped map \n
+ *           Test expects changes to be seen by the map but not by the
+ *           file or other maps opening it
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, mappedChangesStayPrivate) {
+    const char *binFile = "map_private.map";
+    Map csv;
+    Map a;
+    Map b;
+
+    ASSERT_TRUE(csv.createMap(DEFAUTL_TEST_MAP));
+    ASSERT_TRUE(csv.saveBinaryMap(binFile));
+    std::string before = readFile(binFile);
+
+    ASSERT_TRUE(a.openMap(binFile));
+    ASSERT_TRUE(b.openMap(binFile));
+
+    ASSERT_TRUE(a.setCost(1, std::numeric_limits<int>::max()));
+    ASSERT_TRUE(a.setCost(2, 5));
+    ASSERT_TRUE(a.isBlocked(1));
+    ASSERT_EQ(5, a.getCost(2));
+
+    ASSERT_FALSE(b.isBlocked(1));
+    ASSERT_EQ(1, b.getCost(2));
+    ASSERT_EQ(before, readFile(binFile));
+
+    remove(binFile);
+}
+
+
+/**
+ *   @brief  Check opening files that are not valid binary maps \n
+ *           Test expects openMap to fail on csv, truncated, and wrong
+ *           version files, on offsets that wrap around or make
+ *           sections overlap, on zero cell costs, and on missing files
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, rejectInvalidBinary) {
+    const char *binFile = "map_invalid.map";
+    Map map;
+
+    ASSERT_FALSE(map.openMap("unknown.map"));
+    ASSERT_FALSE(map.openMap(DEFAUTL_TEST_MAP));
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(map.saveBinaryMap(binFile));
+    std::string content = readFile(binFile);
+
+    std::ofstream(binFile, std::ios::binary) << content.substr(0, 80);
+    ASSERT_FALSE(map.openMap(binFile));
+    ASSERT_FALSE(map.createMap(binFile));
+
+    content[4] = 2;
+    std::ofstream(binFile, std::ios::binary) << content;
+    ASSERT_FALSE(map.openMap(binFile));
+
+    content[4] = 1;
+    std::ofstream(binFile, std::ios::binary) << content;
+    ASSERT_TRUE(map.openMap(binFile));
+
+    // obstacle offset wraps around to the start of the file, which
+    // needs more than one 64 byte block of obstacle words
+    const char *csvFile = "map_invalid.csv";
+    std::ofstream csv(csvFile);
+    for (int i = 0; i < 24; ++i) {
+        for (int j = 0; j < 24; ++j)
+            csv << ((j > 0) ? ",1" : "1");
+        csv << "\n";
+    }
+    csv.close();
+
+    ASSERT_TRUE(map.createMap(csvFile));
+    ASSERT_TRUE(map.saveBinaryMap(binFile));
+    std::string wrapped = readFile(binFile);
+    setField(wrapped, 24, ~uint64_t(63));
+    std::ofstream(binFile, std::ios::binary) << wrapped;
+    ASSERT_FALSE(map.openMap(binFile));
+    remove(csvFile);
+
+    // cost section overlapping obstacle words, wrapping around, or
+    // holding a zero cost
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(map.setCost(2, 5));
+    ASSERT_TRUE(map.saveBinaryMap(binFile));
+    content = readFile(binFile);
+    uint64_t costOffset = 0;
+    memcpy(&costOffset, &content[32], sizeof(costOffset));
+    ASSERT_TRUE(map.openMap(binFile));
+
+    std::string overlapping = content;
+    setField(overlapping, 32, 64);
+    std::ofstream(binFile, std::ios::binary) << overlapping;
+    ASSERT_FALSE(map.openMap(binFile));
+
+    setField(overlapping, 32, ~uint64_t(63));
+    std::ofstream(binFile, std::ios::binary) << overlapping;
+    ASSERT_FALSE(map.openMap(binFile));
+
+    std::string zeroCost = content;
+    zeroCost[costOffset + 1] = 0;
+    std::ofstream(binFile, std::ios::binary) << zeroCost;
+    ASSERT_FALSE(map.openMap(binFile));
+
+    remove(binFile);
+}
+
+
+/**
+ *   @brief  Check searches on a binary map \n
+ *           Test expects the same costs as on the csv map, and
+ *           4-connected binary maps to match 4-connected grid search
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, searchBinaryMap) {
+    const char *binFile = "map_search.map";
+    const char *binFile4 = "map_search4.map";
+    const int queries[][2] = {{1, 338}, {144, 316}, {338, 1}, {29, 312}};
+    Map map;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(map.saveBinaryMap(binFile));
+    ASSERT_TRUE(map.setNumDir(4));
+    ASSERT_TRUE(map.saveBinaryMap(binFile4));
+
+    AStarAlgorithm csv;
+    AStarAlgorithm bin;
+    AStarAlgorithm bin4;
+    Grid4AStarAlgorithm grid4;
+
+    ASSERT_TRUE(csv.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(bin.PathFindingAlgorithm::init(binFile));
+    ASSERT_TRUE(bin4.PathFindingAlgorithm::init(binFile4));
+    ASSERT_TRUE(grid4.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    for (auto& q : queries) {
+        csv.PathFindingAlgorithm::setParam(q[0], q[1]);
+        ASSERT_TRUE(bin.PathFindingAlgorithm::setParam(q[0], q[1]));
+        ASSERT_TRUE(bin4.PathFindingAlgorithm::setParam(q[0], q[1]));
+        grid4.PathFindingAlgorithm::setParam(q[0], q[1]);
+
+        ASSERT_TRUE(csv.computPath(1.0));
+        ASSERT_TRUE(bin.computPath(1.0));
+        ASSERT_EQ(csv.getTotalCost(), bin.getTotalCost());
+
+        ASSERT_EQ(grid4.computPath(1.0), bin4.computPath(1.0));
+        ASSERT_EQ(grid4.getTotalCost(), bin4.getTotalCost());
+    }
+
+    remove(binFile);
+    remove(binFile4);
+}
+
+
+/**
+ *   @brief  Check searches of fixed connectivity reject binary maps
+ *           stored with another connectivity 
+
+ *           Test expects 8-connected searches to fail to build on a
+ *           4-connected map, and csv maps to take either
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMap, rejectOtherConnectivity) {
+    const char *binFile4 = "map_connect4.map";
+    Map map;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_FALSE(map.hasNumDir());
+    ASSERT_TRUE(map.setNumDir(4));
+    ASSERT_TRUE(map.saveBinaryMap(binFile4));
+
+    Grid8AStarAlgorithm grid8;
+    Sparse8AStarAlgorithm sparse8;
+    JPSAlgorithm jps;
+    Grid4AStarAlgorithm grid4;
+
+    ASSERT_FALSE(grid8.PathFindingAlgorithm::init(binFile4));
+    ASSERT_FALSE(sparse8.PathFindingAlgorithm::init(binFile4));
+    ASSERT_FALSE(jps.PathFindingAlgorithm::init(binFile4));
+    ASSERT_TRUE(grid4.PathFindingAlgorithm::init(binFile4));
+
+    ASSERT_TRUE(grid8.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(grid4.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    remove(binFile4);
+}
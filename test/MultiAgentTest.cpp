@@ -0,0 +1,237 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file MultiAgentTest.cpp
+ *  @brief Implementation of unit test for multi-agent planning
+ *
+ *  This file contains unit tests of ReservationTable and of class
+ *  MultiAgentPlanner.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "MultiAgentPlanner.hpp"
+#include "ReservationTable.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check planned paths are valid and free of conflicts
+ *
+ *   @param  reference to agent tasks
+ *   @param  reference to paths, empty for unplanned agents
+ *   @param  number of map columns in int
+ *   @return none
+*/
+static void checkPaths(const vector<AgentTask> &tasks,
+                       const vector<vector<int>> &paths, int cols) {
+    size_t makespan = 0;
+
+    ASSERT_EQ(tasks.size(), paths.size());
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (paths[i].empty())
+            continue;
+
+        ASSERT_EQ(tasks[i].start, paths[i].front());
+        ASSERT_EQ(tasks[i].goal, paths[i].back());
+        makespan = std::max(makespan, paths[i].size());
+
+        // each step waits or moves to a 4-connected neighbor
+        for (size_t t = 1; t < paths[i].size(); ++t) {
+            int a = paths[i][t - 1] - 1;
+            int b = paths[i][t] - 1;
+            ASSERT_LE(abs(a / cols - b / cols) + abs(a % cols - b % cols),
+                      1);
+        }
+    }
+
+    // agents stay at goal after arrival
+    auto at = [&](size_t i, size_t t) {
+        return paths[i][std::min(t, paths[i].size() - 1)];
+    };
+
+    for (size_t t = 0; t < makespan; ++t) {
+        for (size_t i = 0; i < paths.size(); ++i) {
+            if (paths[i].empty())
+                continue;
+
+            for (size_t j = i + 1; j < paths.size(); ++j) {
+                if (paths[j].empty())
+                    continue;
+
+                ASSERT_NE(at(i, t), at(j, t));
+
+                if (t > 0) {
+                    ASSERT_FALSE((at(i, t) == at(j, t - 1)) &&
+                                 (at(j, t) == at(i, t - 1)));
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check hashed keys are found after insertion and growth \n
+ *           Test expects every inserted key found, duplicates rejected
+ *           and an empty table after clear
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testReservationTable, insertAndClear) {
+    ReservationTable table;
+    std::mt19937_64 rng(3);
+    vector<uint64_t> keys;
+
+    ASSERT_FALSE(table.contains(0));
+
+    for (int i = 0; i < 5000; ++i) {
+        keys.push_back(rng() >> 1);
+        ASSERT_TRUE(table.insert(keys.back()));
+    }
+
+    ASSERT_EQ(5000u, table.size());
+
+    for (uint64_t key : keys) {
+        ASSERT_TRUE(table.contains(key));
+        ASSERT_FALSE(table.insert(key));
+        ASSERT_FALSE(table.contains(key + 1));
+    }
+
+    table.clear();
+    ASSERT_EQ(0u, table.size());
+    ASSERT_FALSE(table.contains(keys[0]));
+    ASSERT_TRUE(table.insert(keys[0]));
+}
+
+
+/**
+ *   @brief  Check two agents pass each other in a corridor \n
+ *           Test expects one agent to step into the side pocket, no
+ *           conflicts, and the horizon to bound arrival
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMultiAgentPlanner, passInCorridor) {
+    // unique name, so runs sharing a temp directory do not collide
+    const char *tmp = getenv("TMPDIR");
+    std::string mapFile = std::string(tmp ? tmp : "/tmp") +
+                          "/mapf_corridor_" +
+                          std::to_string(std::random_device()()) + ".csv";
+    std::ofstream out(mapFile);
+
+    out << "O,O,O,1,O\n1,1,1,1,1\n";
+    out.close();
+
+    MultiAgentPlanner planner;
+    vector<AgentTask> tasks = {{6, 10}, {10, 6}, {1, 7}};
+    vector<vector<int>> paths;
+
+    ASSERT_TRUE(planner.PathFindingAlgorithm::init(mapFile));
+    ASSERT_EQ(2, planner.planAgents(tasks, paths));
+    checkPaths(tasks, paths, 5);
+
+    // obstacle start is not planned
+    ASSERT_TRUE(paths[2].empty());
+
+    // first agent goes straight, second dodges through the pocket
+    ASSERT_EQ(5u, paths[0].size());
+    ASSERT_NE(paths[1].end(), std::find(paths[1].begin(), paths[1].end(), 4));
+    ASSERT_EQ(paths[0].size() + paths[1].size() - 2,
+              static_cast<size_t>(planner.getTotalCost()));
+
+    // too short a horizon
+    planner.setHorizon(3);
+    ASSERT_EQ(0, planner.planAgents(tasks, paths));
+    ASSERT_TRUE(paths[0].empty());
+
+    remove(mapFile.c_str());
+}
+
+
+/**
+ *   @brief  Check many agents on default map get conflict free paths \n
+ *           Test expects most agents planned with valid paths and no
+ *           vertex or swap conflicts, waiting where needed
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testMultiAgentPlanner, noConflictsOnDefaultMap) {
+    MultiAgentPlanner planner;
+    vector<int> open;
+    vector<AgentTask> tasks;
+    vector<vector<int>> paths;
+    std::mt19937 rng(11);
+
+    ASSERT_TRUE(planner.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    Map map;
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+
+    for (int i = 1; i <= 338; ++i) {
+        if (!map.isBlocked(i))
+            open.push_back(i);
+    }
+
+    vector<int> goals = open;
+    std::shuffle(open.begin(), open.end(), rng);
+    std::shuffle(goals.begin(), goals.end(), rng);
+
+    for (int i = 0; i < 60; ++i)
+        tasks.push_back({open[i], goals[i]});
+
+    int numPlanned = planner.planAgents(tasks, paths);
+    int numNonEmpty = 0;
+    bool waited = false;
+
+    for (auto &p : paths) {
+        if (p.empty())
+            continue;
+
+        ++numNonEmpty;
+        for (size_t t = 1; t < p.size(); ++t)
+            waited = waited || (p[t] == p[t - 1]);
+    }
+
+    ASSERT_EQ(numNonEmpty, numPlanned);
+    ASSERT_GE(numPlanned, 55);
+    ASSERT_TRUE(waited);
+    checkPaths(tasks, paths, 26);
+}
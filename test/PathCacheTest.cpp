@@ -0,0 +1,297 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PathCacheTest.cpp
+ *  @brief Implementation of unit test for PathCache
+ *
+ *  This file contains unit tests of the least recently used path
+ *  cache, of serving A star queries from it, and of dropping cached
+ *  paths when map cells change.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "PathCache.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Make a found result with a straight path
+ *
+ *   @param  first index of path in int
+ *   @param  number of cells in path in int
+ *   @return result
+*/
+static PathResult makeResult(int first, int length) {
+    PathResult result {true, static_cast<double>(length - 1), 0, {}};
+
+    for (int i = 0; i < length; ++i)
+        result.path.push_back(first + i);
+
+    return result;
+}
+
+
+/**
+ *   @brief  Check cache keeps results within its budget and evicts the
+ *           least recently used one \n
+ *           Test expects hits for cached queries, misses for other
+ *           weights or versions, and one eviction per extra result
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testPathCache, evictLeastRecentlyUsed) {
+    PathCache probe;
+    PathResult result;
+
+    // memory of one result with a 10 cell path
+    probe.insert({1, 10, 1.0}, 0, makeResult(1, 10));
+    size_t entryBytes = probe.getMemoryUsage();
+    ASSERT_GT(entryBytes, 10 * sizeof(int));
+
+    PathCache cache(3 * entryBytes);
+    cache.insert({1, 10, 1.0}, 0, makeResult(1, 10));
+    cache.insert({2, 11, 1.0}, 0, makeResult(2, 10));
+    cache.insert({3, 12, 1.0}, 0, makeResult(3, 10));
+    ASSERT_EQ(3u, cache.getNumEntries());
+    ASSERT_EQ(3 * entryBytes, cache.getMemoryUsage());
+
+    ASSERT_TRUE(cache.find({1, 10, 1.0}, 0, result));
+    ASSERT_EQ(makeResult(1, 10).path, result.path);
+    ASSERT_EQ(9, result.totalCost);
+
+    // same cells, other weight or map version
+    ASSERT_FALSE(cache.find({1, 10, 2.0}, 0, result));
+    ASSERT_FALSE(cache.find({1, 10, 1.0}, 1, result));
+    cache.insert({4, 13, 1.0}, 1, makeResult(4, 10));
+    ASSERT_EQ(3u, cache.getNumEntries());
+
+    // {2, 11} is least recently used
+    cache.insert({4, 13, 1.0}, 0, makeResult(4, 10));
+    ASSERT_EQ(1u, cache.getNumEvictions());
+    ASSERT_LE(cache.getMemoryUsage(), cache.getMaxBytes());
+    ASSERT_FALSE(cache.find({2, 11, 1.0}, 0, result));
+    ASSERT_TRUE(cache.find({1, 10, 1.0}, 0, result));
+    ASSERT_TRUE(cache.find({3, 12, 1.0}, 0, result));
+    ASSERT_TRUE(cache.find({4, 13, 1.0}, 0, result));
+
+    // result larger than the whole budget is not kept
+    cache.insert({5, 100, 1.0}, 0, makeResult(5, 1000));
+    ASSERT_FALSE(cache.find({5, 100, 1.0}, 0, result));
+    ASSERT_EQ(3u, cache.getNumEntries());
+
+    ASSERT_EQ(4u, cache.getNumHits());
+    ASSERT_EQ(4u, cache.getNumMisses());
+    ASSERT_DOUBLE_EQ(0.5, cache.getHitRate());
+}
+
+
+/**
+ *   @brief  Check cell changes drop only cached paths crossing a
+ *           changed cell when no cell gets cheaper \n
+ *           Test expects the crossing query to search again with the
+ *           same cost as a fresh search, the other to be served from
+ *           cache, and every result to be dropped when a cell opens
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testPathCache, invalidateCrossingPaths) {
+    AStarAlgorithm aStar;
+    AStarAlgorithm rebuilt;
+    std::shared_ptr<PathCache> cache(new PathCache());
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(rebuilt.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    aStar.setPathCache(cache);
+
+    // top left to bottom right, and along the top rows
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::setParam(1, 338));
+    ASSERT_TRUE(aStar.computPath(1.0));
+    vector<int> crossing = aStar.getPath();
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::setParam(27, 50));
+    ASSERT_TRUE(aStar.computPath(1.0));
+    vector<int> other = aStar.getPath();
+    double otherCost = aStar.getTotalCost();
+    ASSERT_EQ(2u, cache->getNumEntries());
+
+    // raise cost of a cell on the first path only
+    int cell = crossing[crossing.size() / 2];
+    ASSERT_EQ(other.end(), std::find(other.begin(), other.end(), cell));
+
+    uint64_t version = aStar.getMapVersion();
+    vector<CellChange> changes = {{cell, 9}};
+    ASSERT_TRUE(aStar.updateCells(changes));
+    ASSERT_TRUE(rebuilt.updateCells(changes));
+    ASSERT_NE(version, aStar.getMapVersion());
+    ASSERT_EQ(rebuilt.getMapVersion(), aStar.getMapVersion());
+    ASSERT_EQ(1u, cache->getNumEntries());
+    ASSERT_EQ(1u, cache->getNumInvalidated());
+
+    // edges changed in place match a graph built from the changed map
+    ASSERT_TRUE(rebuilt.buildGraph());
+    const Graph &graph = aStar.getGraph();
+    for (int n = 0; n < graph.getNumNodes(); ++n) {
+        for (int e = graph.beginEdge(n); e < graph.endEdge(n); ++e) {
+            ASSERT_EQ(rebuilt.getGraph().getCost(n, graph.getTarget(e)),
+                      graph.getCost(e));
+        }
+    }
+
+    ASSERT_TRUE(aStar.computPath(1.0));
+    ASSERT_EQ(0, aStar.getNumExpanded());
+    ASSERT_EQ(other, aStar.getPath());
+    ASSERT_EQ(otherCost, aStar.getTotalCost());
+
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::setParam(1, 338));
+    ASSERT_TRUE(rebuilt.PathFindingAlgorithm::setParam(1, 338));
+    ASSERT_TRUE(aStar.computPath(1.0));
+    ASSERT_TRUE(rebuilt.computPath(1.0));
+    ASSERT_GT(aStar.getNumExpanded(), 0);
+    ASSERT_EQ(rebuilt.getTotalCost(), aStar.getTotalCost());
+
+    // bad change leaves map and cache as they are
+    version = aStar.getMapVersion();
+    ASSERT_FALSE(aStar.updateCells({{cell, 1}, {339, 1}}));
+    ASSERT_FALSE(aStar.updateCells({{cell, 256}}));
+    ASSERT_EQ(version, aStar.getMapVersion());
+    ASSERT_EQ(2u, cache->getNumEntries());
+
+    // opening an obstacle may shorten any path
+    ASSERT_TRUE(aStar.updateCells({{53, 1}}));
+    ASSERT_EQ(0u, cache->getNumEntries());
+    ASSERT_EQ(3u, cache->getNumInvalidated());
+}
+
+
+/**
+ *   @brief  Check cache shared by batch workers and by two searches
+ *           on the same map \n
+ *           Test expects repeated batches to be served from cache
+ *           with the same results
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testPathCache, sharedCache) {
+    AStarAlgorithm first;
+    AStarAlgorithm second;
+    std::shared_ptr<PathCache> cache(new PathCache());
+    vector<PathQuery> queries;
+    vector<PathResult> results;
+    vector<PathResult> cached;
+
+    ASSERT_TRUE(first.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(second.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    first.setPathCache(cache);
+    second.setPathCache(cache);
+
+    for (int s = 1; s <= 338; s += 11) {
+        for (int g = 338; g >= 1; g -= 37)
+            queries.push_back({s, g, 1.0});
+    }
+
+    first.computPaths(queries, results, 4);
+    uint64_t numMisses = cache->getNumMisses();
+    second.computPaths(queries, cached, 4);
+
+    ASSERT_EQ(numMisses, cache->getNumMisses());
+    ASSERT_EQ(cache->getNumHits(), cache->getNumMisses());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        ASSERT_EQ(results[i].found, cached[i].found);
+        ASSERT_EQ(results[i].totalCost, cached[i].totalCost);
+        ASSERT_EQ(results[i].path, cached[i].path);
+        ASSERT_EQ(0, cached[i].numExpanded);
+    }
+
+    // both searches report the same change, applied once
+    ASSERT_TRUE(first.updateCells({{100, 4}}));
+    uint64_t numInvalidated = cache->getNumInvalidated();
+    ASSERT_TRUE(second.updateCells({{100, 4}}));
+    ASSERT_EQ(numInvalidated, cache->getNumInvalidated());
+    ASSERT_EQ(first.getMapVersion(), cache->getVersion());
+}
+
+
+/**
+ *   @brief  Check cache shared by two searches of different maps, one
+ *           attached before its map is loaded 
+
+ *           Test expects neither search to be served a result of the
+ *           other map
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testPathCache, cacheAcrossMaps) {
+    AStarAlgorithm first;
+    AStarAlgorithm second;
+    AStarAlgorithm fresh;
+    std::shared_ptr<PathCache> cache(new PathCache());
+
+    first.setPathCache(cache);
+    ASSERT_TRUE(first.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(second.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+    ASSERT_TRUE(fresh.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP));
+    ASSERT_NE(first.getMapVersion(), second.getMapVersion());
+
+    ASSERT_TRUE(first.PathFindingAlgorithm::setParam(1, 36));
+    ASSERT_TRUE(first.computPath(1.0));
+    vector<int> firstPath = first.getPath();
+    ASSERT_EQ(1u, cache->getNumEntries());
+
+    // same query on the other map is searched again
+    second.setPathCache(cache);
+    ASSERT_EQ(0u, cache->getNumEntries());
+    ASSERT_TRUE(second.PathFindingAlgorithm::setParam(1, 36));
+    ASSERT_TRUE(fresh.PathFindingAlgorithm::setParam(1, 36));
+    ASSERT_TRUE(second.computPath(1.0));
+    ASSERT_TRUE(fresh.computPath(1.0));
+    ASSERT_GT(second.getNumExpanded(), 0);
+    ASSERT_EQ(fresh.getPath(), second.getPath());
+    ASSERT_NE(firstPath, second.getPath());
+
+    // cache now follows the other map
+    ASSERT_TRUE(first.computPath(1.0));
+    ASSERT_GT(first.getNumExpanded(), 0);
+    ASSERT_EQ(firstPath, first.getPath());
+
+    // same cell change on both maps keeps them apart
+    ASSERT_TRUE(first.updateCells({{8, 4}}));
+    ASSERT_TRUE(second.updateCells({{8, 4}}));
+    ASSERT_NE(first.getMapVersion(), second.getMapVersion());
+    ASSERT_TRUE(first.computPath(1.0));
+    ASSERT_GT(first.getNumExpanded(), 0);
+}
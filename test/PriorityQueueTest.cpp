@@ -0,0 +1,283 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file PriorityQueueTest.cpp
+ *  @brief Implementation of unit test for indexed priority queues
+ *
+ *  This file contains unit tests of the open set priority queues and
+ *  of AStarAlgorithm running with each queue policy.  Expansion rate
+ *  of each policy is reported on screen.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+
+using std::vector;
+
+
+template <class Queue>
+class testQueue : public ::testing::Test {
+ protected:
+     Queue queue;
+};
+
+typedef ::testing::Types<BinaryHeap, QuaternaryHeap, PairingHeap> QueueTypes;
+TYPED_TEST_CASE(testQueue, QueueTypes);
+
+
+/**
+ *   @brief  Check queue pops random keys in ascending order and
+ *           tracks membership of each node \n
+ *           Test expects keys popped in sorted order
+ *
+ *   @param  none
+ *   @return none
+*/
+TYPED_TEST(testQueue, popInKeyOrder) {
+    const int n = 1000;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(0.0, 100.0);
+    vector<double> keys;
+
+    this->queue.resize(n);
+
+    for (int i = 0; i < n; ++i) {
+        keys.push_back(dist(rng));
+        this->queue.push(i, keys.back());
+        ASSERT_TRUE(this->queue.contains(i));
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(keys[i], this->queue.topKey());
+        int id = this->queue.pop();
+        ASSERT_FALSE(this->queue.contains(id));
+    }
+
+    ASSERT_TRUE(this->queue.empty());
+}
+
+
+/**
+ *   @brief  Check decreaseKey moves node to the front and clear
+ *           empties queue so it can be reused \n
+ *           Test expects decreased node to be popped first
+ *
+ *   @param  none
+ *   @return none
+*/
+TYPED_TEST(testQueue, decreaseKeyAndClear) {
+    this->queue.resize(10);
+
+    for (int i = 0; i < 10; ++i)
+        this->queue.push(i, 10.0 + i);
+
+    this->queue.decreaseKey(7, 1.0);
+    this->queue.decreaseKey(3, 2.0);
+    ASSERT_EQ(1.0, this->queue.getKey(7));
+
+    ASSERT_EQ(7, this->queue.pop());
+    ASSERT_EQ(3, this->queue.pop());
+    ASSERT_EQ(0, this->queue.pop());
+
+    this->queue.clear();
+    ASSERT_TRUE(this->queue.empty());
+    for (int i = 0; i < 10; ++i)
+        ASSERT_FALSE(this->queue.contains(i));
+
+    this->queue.push(5, 3.0);
+    ASSERT_EQ(1, this->queue.size());
+    ASSERT_EQ(5, this->queue.top());
+}
+
+
+/**
+ *   @brief  Check indexed heap with lexicographic keys after keys are
+ *           raised, lowered, and nodes removed from the middle 
+
+ *           Test expects remaining nodes popped in key order
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testIndexedHeap, updateAndRemovePairKeys) {
+    typedef std::pair<double, double> Key;
+    IndexedHeap<2, Key> queue;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> dist(0, 9);
+    vector<Key> keys(200);
+
+    queue.resize(200);
+
+    for (int i = 0; i < 200; ++i) {
+        keys[i] = Key(dist(rng), dist(rng));
+        queue.push(i, keys[i]);
+    }
+
+    for (int i = 0; i < 200; i += 3) {
+        keys[i] = Key(dist(rng), dist(rng));
+        queue.update(i, keys[i]);
+    }
+
+    for (int i = 1; i < 200; i += 5) {
+        queue.remove(i);
+        ASSERT_FALSE(queue.contains(i));
+    }
+
+    Key last(-1, -1);
+    while (!queue.empty()) {
+        Key key = queue.topKey();
+        int id = queue.pop();
+
+        ASSERT_EQ(keys[id], key);
+        ASSERT_FALSE(key < last);
+        ASSERT_NE(1, id % 5);
+        last = key;
+    }
+}
+
+
+/**
+ *   @brief  Check radix heap pops integer keys in order while keys
+ *           pushed and decreased never drop below the last popped key,
+ *           as in Dijkstra \n
+ *           Test expects popped keys to be non-decreasing and equal to
+ *           the lowest key left
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testRadixHeap, monotonePopOrder) {
+    const int n = 2000;
+    RadixHeap queue;
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> stepDist(0, 300);
+    std::uniform_int_distribution<int> idDist(0, n - 1);
+    vector<double> keys(n, -1);
+
+    queue.resize(n);
+
+    for (int i = 0; i < 50; ++i) {
+        int id = idDist(rng);
+        if (!queue.contains(id)) {
+            keys[id] = stepDist(rng);
+            queue.push(id, keys[id]);
+        }
+    }
+
+    double last = 0;
+    while (!queue.empty()) {
+        double lowest = -1;
+        for (int id = 0; id < n; ++id) {
+            if (queue.contains(id) && ((lowest < 0) || (keys[id] < lowest)))
+                lowest = keys[id];
+        }
+
+        ASSERT_EQ(lowest, queue.topKey());
+        int id = queue.pop();
+        ASSERT_EQ(lowest, keys[id]);
+        ASSERT_GE(keys[id], last);
+        last = keys[id];
+
+        // relax a few random nodes from popped key
+        for (int r = 0; r < 3; ++r) {
+            int m = idDist(rng);
+            double key = last + stepDist(rng);
+
+            if (!queue.contains(m) && (keys[m] < 0)) {
+                keys[m] = key;
+                queue.push(m, key);
+            } else if (queue.contains(m) && (key < keys[m])) {
+                keys[m] = key;
+                queue.decreaseKey(m, key);
+            }
+        }
+    }
+
+    queue.clear();
+    queue.push(3, 7.0);
+    ASSERT_EQ(3, queue.top());
+    ASSERT_EQ(7.0, queue.topKey());
+}
+
+
+/*
+ *   @brief  Helper function, run Dijkstra's search from corner to
+ *           corner of default map and report expansion rate
+ *
+ *   @param  name of open set policy to report
+ *   @return total cost of shortest path in double
+*/
+template <class Algorithm>
+double measurePolicy(const char *name) {
+    Algorithm aStar;
+    long expanded = 0;
+    double secs = 0;
+
+    aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP);
+    aStar.PathFindingAlgorithm::setParam(1, 338);
+
+    for (int i = 0; i < 20; ++i) {
+        auto begin = std::chrono::steady_clock::now();
+        EXPECT_TRUE(aStar.computPath(0.0));
+        secs += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin).count();
+
+        expanded += aStar.getNumExpanded();
+    }
+
+    std::cout << "[ policy ] " << name << ": " << expanded / secs
+              << " expansions/sec" << std::endl;
+
+    return aStar.getTotalCost();
+}
+
+
+/**
+ *   @brief  Check all open set policies find the same shortest path
+ *           cost on default map and report expansions per second \n
+ *           Test expects cost of each policy to match
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testQueuePolicy, computeCostShouldMatch) {
+    double cost = measurePolicy<AStarAlgorithm>("binary heap");
+
+    ASSERT_EQ(32, cost);
+    ASSERT_EQ(cost, measurePolicy<QuaternaryAStarAlgorithm>("4-ary heap"));
+    ASSERT_EQ(cost, measurePolicy<PairingAStarAlgorithm>("pairing heap"));
+}
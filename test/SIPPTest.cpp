@@ -0,0 +1,154 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SIPPTest.cpp
+ *  @brief Implementation of unit test for class SIPPAlgorithm
+ *
+ *  This file contains unit tests of safe interval path planning around
+ *  cells with unsafe time intervals.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "SIPPAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Check search without unsafe intervals matches A star \n
+ *           Test expects the same costs as A star and a timed path
+ *           without waits whose last time is the cost
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSIPP, matchAStarWhenAlwaysSafe) {
+    SIPPAlgorithm sipp;
+    AStarAlgorithm aStar;
+
+    ASSERT_TRUE(sipp.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_EQ(338, sipp.getNumStates());
+
+    for (int s = 1; s <= 338; s += 13) {
+        for (int g = 338; g >= 1; g -= 31) {
+            if (!aStar.PathFindingAlgorithm::setParam(s, g))
+                continue;
+
+            ASSERT_TRUE(sipp.PathFindingAlgorithm::setParam(s, g));
+
+            bool found = aStar.computPath(1.0);
+            ASSERT_EQ(found, sipp.computPath(1.0));
+
+            if (!found)
+                continue;
+
+            ASSERT_DOUBLE_EQ(aStar.getTotalCost(), sipp.getTotalCost());
+            ASSERT_EQ(sipp.getPath().size(), sipp.getTimedPath().size());
+            ASSERT_EQ(0, sipp.getTimedPath().front().time);
+            ASSERT_EQ(sipp.getTotalCost(), sipp.getTimedPath().back().time);
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check agent waits for a forklift crossing a corridor \n
+ *           Test expects waits before cells become safe, skipped safe
+ *           intervals too short for a move, and no path when start or
+ *           goal are never safe
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSIPP, waitForForklift) {
+    // unique name, so runs sharing a temp directory do not collide
+    const char *tmp = getenv("TMPDIR");
+    std::string mapFile = std::string(tmp ? tmp : "/tmp") +
+                          "/sipp_corridor_" +
+                          std::to_string(std::random_device()()) + ".csv";
+    const double inf = std::numeric_limits<double>::infinity();
+    std::ofstream out(mapFile);
+
+    out << "1,1,1,1,1\nO,O,O,O,O\n";
+    out.close();
+
+    SIPPAlgorithm sipp;
+    ASSERT_TRUE(sipp.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(sipp.PathFindingAlgorithm::setParam(1, 5));
+
+    // forklift holds cell 3 until time 4
+    ASSERT_TRUE(sipp.setUnsafeIntervals(3, {{0.5, 4}}));
+    ASSERT_TRUE(sipp.computPath(1.0));
+    ASSERT_EQ(7, sipp.getTotalCost());
+
+    vector<int> expectIndex = {1, 2, 2, 3, 4, 5};
+    vector<double> expectTime = {0, 1, 4, 5, 6, 7};
+    ASSERT_EQ(expectIndex.size(), sipp.getTimedPath().size());
+
+    for (size_t i = 0; i < expectIndex.size(); ++i) {
+        ASSERT_EQ(expectIndex[i], sipp.getTimedPath()[i].index);
+        ASSERT_EQ(expectTime[i], sipp.getTimedPath()[i].time);
+    }
+
+    ASSERT_EQ(vector<int>({1, 2, 3, 4, 5}), sipp.getPath());
+
+    // window [2, 2.5) is shorter than a move, so agent waits until 10
+    ASSERT_TRUE(sipp.setUnsafeIntervals(3, {{2.5, 10}, {0, 2}, {1, 2}}));
+    ASSERT_EQ(11, sipp.getNumStates());
+    ASSERT_TRUE(sipp.computPath(1.0));
+    ASSERT_EQ(13, sipp.getTotalCost());
+
+    // goal never safe again, then start taken at time 0
+    ASSERT_TRUE(sipp.setUnsafeIntervals(3, {}));
+    ASSERT_TRUE(sipp.setUnsafeIntervals(5, {{3, inf}}));
+    ASSERT_FALSE(sipp.computPath(1.0));
+
+    sipp.clearUnsafeIntervals();
+    ASSERT_TRUE(sipp.setUnsafeIntervals(1, {{0, 1}}));
+    ASSERT_FALSE(sipp.computPath(1.0));
+
+    // invalid intervals and indices
+    ASSERT_FALSE(sipp.setUnsafeIntervals(2, {{2, 2}}));
+    ASSERT_FALSE(sipp.setUnsafeIntervals(0, {{0, 1}}));
+    ASSERT_FALSE(sipp.setUnsafeIntervals(11, {{0, 1}}));
+
+    remove(mapFile.c_str());
+
+    sipp.clearUnsafeIntervals();
+    ASSERT_TRUE(sipp.computPath(1.0));
+    ASSERT_EQ(4, sipp.getTotalCost());
+}
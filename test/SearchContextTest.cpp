@@ -0,0 +1,166 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SearchContextTest.cpp
+ *  @brief Implementation of unit test for SearchContext
+ *
+ *  This file contains unit tests of SearchContext reuse.  Global
+ *  operator new is replaced here to count heap allocations made by
+ *  repeated path queries.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include <vector>
+
+#include "AStarAlgorithm.hpp"
+#include "SearchContext.hpp"
+
+using std::vector;
+
+
+///< number of calls to global operator new
+static std::atomic<long> allocationCount(0);
+
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+
+    void *p = malloc(size ? size : 1);
+    if (p == nullptr)
+        throw std::bad_alloc();
+
+    return p;
+}
+
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+
+void operator delete(void *p, std::size_t) noexcept {
+    free(p);
+}
+
+
+/**
+ *   @brief  Check reset discards state of previous search \n
+ *           Test expects no node visited after reset
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSearchContext, resetClearsState) {
+    SearchContext<BinaryHeap> context;
+
+    context.reset(10);
+    context.visit(3, 1.0, 2.0, -1);
+    context.visit(4, 2.0, 3.0, 3);
+    context.close(3);
+    context.getOpenSet().push(4, 3.0);
+
+    ASSERT_TRUE(context.isClosed(3));
+    ASSERT_TRUE(context.isVisited(4));
+    ASSERT_FALSE(context.isClosed(4));
+
+    vector<int> path;
+    context.extractPath(4, path);
+    ASSERT_EQ(vector<int>({3, 4}), path);
+
+    context.reset(10);
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(context.isVisited(i));
+        ASSERT_FALSE(context.isClosed(i));
+    }
+    ASSERT_TRUE(context.getOpenSet().empty());
+}
+
+
+/**
+ *   @brief  Check Dijkstra's and A star can run back to back without
+ *           init the map again \n
+ *           Test expects same cost and path as running after init
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSearchContext, reuseWithoutInit) {
+    AStarAlgorithm aStar;
+    AStarAlgorithm fresh;
+
+    aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP);
+    aStar.PathFindingAlgorithm::setParam(1, 338);
+
+    ASSERT_TRUE(aStar.computPath(0.0));
+    ASSERT_EQ(32, aStar.getTotalCost());
+
+    ASSERT_TRUE(aStar.computPath(1.0));
+    ASSERT_EQ(32, aStar.getTotalCost());
+
+    fresh.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP);
+    fresh.PathFindingAlgorithm::setParam(1, 338);
+    ASSERT_TRUE(fresh.computPath(1.0));
+
+    ASSERT_EQ(fresh.getPath(), aStar.getPath());
+}
+
+
+/**
+ *   @brief  Check steady state path queries make no heap allocation \n
+ *           Test expects allocation count unchanged after warm-up
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSearchContext, steadyStateAllocationFree) {
+    AStarAlgorithm aStar;
+    const int queries[][2] = {{1, 338}, {144, 316}, {338, 1}, {29, 312}};
+
+    aStar.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP);
+
+    // warm-up grows search context and path to their final size
+    for (auto& q : queries) {
+        aStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+        ASSERT_TRUE(aStar.computPath(0.0));
+        ASSERT_TRUE(aStar.computPath(1.0));
+    }
+
+    long before = allocationCount;
+    for (int i = 0; i < 10; ++i) {
+        for (auto& q : queries) {
+            aStar.PathFindingAlgorithm::setParam(q[0], q[1]);
+            aStar.computPath(i % 2 ? 1.0 : 0.0);
+        }
+    }
+    long after = allocationCount;
+
+    ASSERT_EQ(before, after);
+}
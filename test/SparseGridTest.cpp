@@ -0,0 +1,195 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file SparseGridTest.cpp
+ *  @brief Implementation of unit test for SparseGrid
+ *
+ *  This file contains unit tests of A star running on the sparse
+ *  chunked grid, against A star on the padded cell grid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "GridAStarAlgorithm.hpp"
+#include "Map.hpp"
+#include "PathFindAlgorithm.hpp"
+
+using std::vector;
+
+
+/**
+ *   @brief  Write map csv file of open yard with a few rectangular
+ *           buildings, one of them with cost 3 around it
+ *
+ *   @param  file path in string
+ *   @param  number of rows in int
+ *   @param  number of cols in int
+ *   @return none
+*/
+static void writeYard(const std::string &file, int rows, int cols) {
+    // top, left, bottom, right of each building
+    const int buildings[][4] = {{5, 5, 20, 40}, {30, 50, 33, 120},
+                                {60, 10, 90, 14}, {70, 70, 95, 100}};
+    vector<int> cells(rows * cols, 1);
+
+    for (int i = 62; i < 88; ++i)
+        for (int j = 20; j < 60; ++j)
+            cells[i * cols + j] = 3;
+
+    for (auto& b : buildings)
+        for (int i = b[0]; i < b[2]; ++i)
+            for (int j = b[1]; j < b[3]; ++j)
+                cells[i * cols + j] = 0;
+
+    std::ofstream out(file);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            if (cells[i * cols + j] == 0)
+                out << "O";
+            else
+                out << cells[i * cols + j];
+
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Run queries on grid and sparse grid search and check both
+ *           find the same costs
+ *
+ *   @param  reference to grid search, initialized
+ *   @param  reference to sparse grid search, initialized
+ *   @param  reference to start, goal pairs of map indices
+ *   @return none
+*/
+template <class Grid, class Sparse>
+static void expectSameCosts(Grid &grid, Sparse &sparse,
+                            const vector<vector<int> > &queries) {
+    for (auto& q : queries) {
+        grid.PathFindingAlgorithm::setParam(q[0], q[1]);
+        sparse.PathFindingAlgorithm::setParam(q[0], q[1]);
+
+        for (double weight : {0.0, 1.0}) {
+            bool found = grid.computPath(weight);
+
+            ASSERT_EQ(found, sparse.computPath(weight));
+            if (!found)
+                continue;
+
+            ASSERT_EQ(grid.getTotalCost(), sparse.getTotalCost());
+            ASSERT_EQ(q[0], sparse.getPath().front());
+            ASSERT_EQ(q[1], sparse.getPath().back());
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check sparse grid search finds the same cost as padded
+ *           grid search on the default map \n
+ *           Test expects costs to match for every query with 4 and 8
+ *           connectivity
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSparseGrid, costShouldMatchGrid) {
+    Grid8AStarAlgorithm grid8;
+    Grid4AStarAlgorithm grid4;
+    Sparse8AStarAlgorithm sparse8;
+    Sparse4AStarAlgorithm sparse4;
+    const vector<vector<int> > queries = {{1, 338}, {144, 316}, {338, 1},
+                                          {29, 312}, {1, 1}};
+
+    ASSERT_TRUE(grid8.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(grid4.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(sparse8.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(sparse4.PathFindingAlgorithm::init(DEFAUTL_DEFAULT_MAP));
+
+    expectSameCosts(grid8, sparse8, queries);
+    expectSameCosts(grid4, sparse4, queries);
+
+    // unreachable goal
+    sparse8.PathFindingAlgorithm::init(DEFAUTL_TEST_MAP);
+    sparse8.PathFindingAlgorithm::setParam(1, 15);
+    ASSERT_FALSE(sparse8.computPath(1.0));
+}
+
+
+/**
+ *   @brief  Check uniform chunks of a yard map are not stored per
+ *           cell \n
+ *           Test expects cells to match the map, few dense chunks,
+ *           less memory than the padded grid, and the same costs for
+ *           queries crossing chunks of several kinds
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testSparseGrid, yardMap) {
+    const char *mapFile = "sparse_yard.csv";
+    const int rows = 128;
+    const int cols = 144;
+    Map map;
+    Grid8AStarAlgorithm grid;
+    Sparse8AStarAlgorithm sparse;
+
+    writeYard(mapFile, rows, cols);
+    ASSERT_TRUE(map.createMap(mapFile));
+    ASSERT_TRUE(grid.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(sparse.PathFindingAlgorithm::init(mapFile));
+
+    const SparseGrid<8> &chunks = sparse.getGrid();
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            int cost = map.getCost(i * cols + j + 1);
+            ASSERT_EQ(map.isBlocked(i * cols + j + 1) ? 0 : cost,
+                      chunks.getCell(i, j));
+        }
+    }
+
+    // 8x9 chunks, only those on building and cost area borders dense
+    ASSERT_EQ(72, chunks.getNumChunks());
+    ASSERT_LT(chunks.getNumDenseChunks(), 36);
+    ASSERT_LT(chunks.getMemoryUsage(), grid.getGrid().getMemoryUsage());
+
+    const vector<vector<int> > queries = {{1, rows * cols}, {rows * cols, 1},
+                                          {2 * cols + 60, 97 * cols + 85},
+                                          {45 * cols + 3, 75 * cols + 125},
+                                          {80 * cols + 30, 10 * cols + 50}};
+    expectSameCosts(grid, sparse, queries);
+
+    remove(mapFile);
+}
@@ -0,0 +1,275 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file TiledMapTest.cpp
+ *  @brief Implementation of unit test for TiledMap
+ *
+ *  This file contains unit tests of writing and reading tiled maps and
+ *  of searching a tiled map whose cache holds a small part of it.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "GraphSearch.hpp"
+#include "GridAStarAlgorithm.hpp"
+#include "Map.hpp"
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "TiledMap.hpp"
+
+
+/**
+ *   @brief  Write random map with costs in [1, 9] to csv file
+ *
+ *   @param  file path in string
+ *   @param  number of rows in int
+ *   @param  number of cols in int
+ *   @param  random seed in int
+ *   @return none
+*/
+static void writeCostMap(const std::string &file, int rows, int cols,
+                         int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+    std::ofstream out(file);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            int c = cellDist(rng);
+
+            // about 20% obstacles
+            if (c < 20)
+                out << "o";
+            else
+                out << 1 + c % 9;
+
+            if (j < cols - 1)
+                out << ",";
+        }
+        out << "\n";
+    }
+}
+
+
+/**
+ *   @brief  Check tiled map holds the same cells as map \n
+ *           Test expects every cell to match with a two tile cache,
+ *           including tiles past the map edge
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testTiledMap, cellsMatchMap) {
+    const char *tileFile = "tiled_cells.tiles";
+    Map map;
+    TiledMap tiled;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    ASSERT_TRUE(map.setCost(30, 7));
+    ASSERT_TRUE(map.setCost(338, 255));
+    ASSERT_TRUE(TiledMap::create(map, tileFile, 8));
+
+    // 13x26 map in 8x8 tiles, 64 bytes each
+    ASSERT_TRUE(tiled.open(tileFile, 128));
+    ASSERT_EQ(13, tiled.getRow());
+    ASSERT_EQ(26, tiled.getCol());
+    ASSERT_EQ(8, tiled.getNumDir());
+    ASSERT_EQ(8, tiled.getTileSize());
+    ASSERT_EQ(2, tiled.getNumSlots());
+    ASSERT_LE(tiled.getMemoryUsage(), 128u);
+
+    for (int i = 1; i <= 338; ++i) {
+        ASSERT_EQ(map.isBlocked(i), tiled.isBlocked(i));
+        ASSERT_EQ(map.getCost(i), tiled.getCost(i));
+    }
+
+    // row by row reads cross 4 tiles per row
+    ASSERT_GT(tiled.getNumMisses(), 13u);
+    ASSERT_EQ(2 * 338u, tiled.getNumHits() + tiled.getNumMisses());
+
+    // first tile was evicted, last tile and first tile are now cached
+    tiled.resetCounters();
+    tiled.getCost(1);
+    tiled.getCost(338);
+    tiled.getCost(1);
+    ASSERT_EQ(2u, tiled.getNumHits());
+    ASSERT_EQ(1u, tiled.getNumMisses());
+
+    remove(tileFile);
+}
+
+
+/**
+ *   @brief  Search tiled map with a small cache and grid search on
+ *           the loaded map, and check both find the same costs
+ *
+ *   @param  reference to loaded map, connectivity set
+ *   @param  csv map file path in string
+ *   @param  tiled map file path in string
+ *   @param  memory budget of tile cache in bytes
+ *   @return none
+*/
+template <int Connectivity>
+static void checkTiledSearch(Map &map, const std::string &mapFile,
+                             const std::string &tileFile, size_t budget) {
+    const int queries[][2] = {{1, 90000}, {150, 89850}, {45150, 1},
+                              {300, 89701}, {1234, 1234}};
+    GridAStarAlgorithm<Connectivity> grid;
+    TiledMap tiled;
+
+    ASSERT_TRUE(grid.PathFindingAlgorithm::init(mapFile));
+    ASSERT_TRUE(map.setNumDir(Connectivity));
+    ASSERT_TRUE(TiledMap::create(map, tileFile, 16));
+    ASSERT_TRUE(tiled.open(tileFile, budget));
+
+    // map does not fit in the cache
+    ASSERT_LE(tiled.getMemoryUsage(), budget);
+    ASSERT_GT(static_cast<size_t>(map.getRow() * map.getCol()),
+              10 * budget);
+
+    TiledGraph graph(tiled);
+    SearchContext<BinaryHeap> context;
+
+    for (auto& q : queries) {
+        int startId = graph.toId(q[0]);
+        int goalId = graph.toId(q[1]);
+        int numExpanded = 0;
+
+        // start and goal may be obstacles in a random map
+        if (tiled.isBlocked(q[0]) || tiled.isBlocked(q[1]))
+            continue;
+
+        auto heuristic = [&](int id) {
+            double x0, y0, x1, y1;
+            std::tie(x0, y0) = graph.getPos(id);
+            std::tie(x1, y1) = graph.getPos(goalId);
+            return sqrt((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1));
+        };
+
+        grid.PathFindingAlgorithm::setParam(q[0], q[1]);
+        bool found = grid.computPath(1.0);
+
+        ASSERT_EQ(found, aStarSearch(graph, context, startId, goalId, 1.0,
+                                     heuristic, numExpanded));
+
+        if (found) {
+            std::vector<int> path;
+
+            ASSERT_EQ(grid.getTotalCost(), context.getCost(goalId));
+            context.extractPath(goalId, path);
+            ASSERT_EQ(q[0], graph.toIndex(path.front()));
+            ASSERT_EQ(q[1], graph.toIndex(path.back()));
+        }
+    }
+
+    ASSERT_GT(tiled.getNumMisses(), 0u);
+    ASSERT_GT(tiled.getNumHits(), tiled.getNumMisses());
+}
+
+
+/**
+ *   @brief  Check search on a tiled map larger than its cache \n
+ *           Test expects the same costs as grid search on the loaded
+ *           map with 4 and 8 connectivity
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testTiledMap, searchLargerThanBudget) {
+    const char *mapFile = "tiled_search.csv";
+    const char *tileFile = "tiled_search.tiles";
+    Map map;
+
+    writeCostMap(mapFile, 300, 300, 11);
+    ASSERT_TRUE(map.createMap(mapFile));
+
+    checkTiledSearch<8>(map, mapFile, tileFile, 4096);
+    checkTiledSearch<4>(map, mapFile, tileFile, 4096);
+
+    remove(mapFile);
+    remove(tileFile);
+}
+
+
+/**
+ *   @brief  Check invalid tile sizes and files are rejected \n
+ *           Test expects create and open to return false, also for
+ *           a data offset that wraps around
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testTiledMap, rejectInvalid) {
+    const char *tileFile = "tiled_invalid.tiles";
+    Map map;
+    TiledMap tiled;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_TEST_MAP));
+    ASSERT_FALSE(TiledMap::create(map, tileFile, 4));
+    ASSERT_FALSE(TiledMap::create(map, tileFile, 12));
+    ASSERT_FALSE(TiledMap::create(map, tileFile, 8192));
+
+    ASSERT_FALSE(tiled.open("no_such_file.tiles", 4096));
+    ASSERT_FALSE(tiled.open(DEFAUTL_TEST_MAP, 4096));
+
+    // header without tile data
+    ASSERT_TRUE(TiledMap::create(map, tileFile, 8));
+    ASSERT_TRUE(tiled.open(tileFile, 4096));
+    {
+        std::ifstream in(tileFile, std::ios::binary);
+        std::vector<char> header(64);
+        in.read(header.data(), header.size());
+        std::ofstream out(tileFile, std::ios::binary);
+        out.write(header.data(), header.size());
+    }
+    ASSERT_FALSE(tiled.open(tileFile, 4096));
+    ASSERT_EQ(0, tiled.getRow());
+
+    // data offset wrapping around to the start of the file
+    ASSERT_TRUE(TiledMap::create(map, tileFile, 8));
+    {
+        uint64_t offset = ~uint64_t(31);
+        std::fstream io(tileFile,
+                        std::ios::binary | std::ios::in | std::ios::out);
+        io.seekp(24);
+        io.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+    ASSERT_FALSE(tiled.open(tileFile, 4096));
+    ASSERT_EQ(0, tiled.getRow());
+
+    remove(tileFile);
+}
@@ -0,0 +1,219 @@
+/********************************************************************
+ *   MIT License
+ *  
+ *   Copyright (c) 2017 Huei-Tzu Tsai
+ *  
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ ********************************************************************/
+
+/** @file WavefrontTest.cpp
+ *  @brief Implementation of unit test for Wavefront
+ *
+ *  This file contains unit tests of bit-parallel wavefront hop
+ *  distances and reachability against Dijkstra on the cell grid.
+ *
+ *  @author Huei Tzu Tsai
+ *  @date   10/18/2026
+*/
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "GraphSearch.hpp"
+#include "GridGraph.hpp"
+#include "Map.hpp"
+#include "PathFindAlgorithm.hpp"
+#include "PriorityQueue.hpp"
+#include "SearchContext.hpp"
+#include "Wavefront.hpp"
+
+
+/**
+ *  @brief Grid whose every move costs 1, so Dijkstra costs are hops
+*/
+template <int Connectivity>
+struct UnitGrid {
+    const GridGraph<Connectivity> &grid;           ///< cells of map
+
+    int getNumNodes(void) const { return grid.getNumNodes(); }
+
+    template <class Function>
+    void forEachNeighbor(int id, Function f) const {
+        grid.forEachNeighbor(id, [&](int n, double) { f(n, 1.0); });
+    }
+};
+
+
+/**
+ *   @brief  Compare wavefront hops with Dijkstra over unit moves for
+ *           several start cells and both kernels
+ *
+ *   @param  reference to map
+ *   @param  step between start indices in int
+ *   @return none
+*/
+template <int Connectivity>
+static void compareWithDijkstra(Map &map, int startStep) {
+    GridGraph<Connectivity> grid;
+    UnitGrid<Connectivity> unit = {grid};
+    SearchContext<BinaryHeap> context;
+    Wavefront wavefront;
+    std::vector<int> hops;
+    auto zero = [](int) { return 0.0; };
+    int numExpanded = 0;
+    int numCells = map.getRow() * map.getCol();
+
+    ASSERT_TRUE(map.setNumDir(Connectivity));
+    ASSERT_TRUE(grid.build(map));
+    ASSERT_TRUE(wavefront.build(map));
+
+    std::vector<Wavefront::Kernel> kernels = {Wavefront::SCALAR};
+    if (Wavefront::hasAvx2())
+        kernels.push_back(Wavefront::AVX2);
+
+    for (int s = 1; s <= numCells; s += startStep) {
+        if (grid.isBlocked(grid.toId(s))) {
+            ASSERT_FALSE(wavefront.computeHops({s}, Connectivity, hops));
+            continue;
+        }
+
+        aStarSearch(unit, context, grid.toId(s), -1, 0, zero, numExpanded);
+
+        for (auto k : kernels) {
+            wavefront.setKernel(k);
+            ASSERT_TRUE(wavefront.computeHops({s}, Connectivity, hops));
+            ASSERT_EQ(k, wavefront.getKernel());
+            ASSERT_EQ(numExpanded, wavefront.getNumReached());
+
+            for (int i = 1; i <= numCells; ++i) {
+                double cost = context.getCost(grid.toId(i));
+                bool reached = context.isVisited(grid.toId(i));
+
+                ASSERT_EQ(reached, wavefront.isReachable(i));
+                ASSERT_EQ(reached ? static_cast<int>(cost) : -1, hops[i - 1]);
+            }
+
+            ASSERT_TRUE(wavefront.computeReachable({s}, Connectivity));
+            ASSERT_EQ(numExpanded, wavefront.getNumReached());
+        }
+    }
+}
+
+
+/**
+ *   @brief  Check wavefront on provided maps \n
+ *           Test expects hops to equal Dijkstra costs of unit moves
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testWavefront, hopsShouldMatchDijkstra) {
+    Map map;
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_DEFAULT_MAP));
+    compareWithDijkstra<4>(map, 7);
+    compareWithDijkstra<8>(map, 7);
+
+    ASSERT_TRUE(map.createMap(DEFAUTL_TEST_MAP));
+    compareWithDijkstra<4>(map, 1);
+    compareWithDijkstra<8>(map, 1);
+
+    // cell 15 cannot be reached from cell 1
+    Wavefront wavefront;
+    ASSERT_TRUE(wavefront.build(map));
+    ASSERT_TRUE(wavefront.computeReachable({1}, 8));
+    ASSERT_TRUE(wavefront.isReachable(36));
+    ASSERT_FALSE(wavefront.isReachable(15));
+
+    // invalid connectivity or start
+    ASSERT_FALSE(wavefront.computeReachable({1}, 6));
+    ASSERT_FALSE(wavefront.computeReachable({0}, 4));
+    ASSERT_FALSE(wavefront.computeReachable({37}, 4));
+}
+
+
+/**
+ *   @brief  Check wavefront on random maps wider than one AVX2
+ *           register, and from several start cells at once \n
+ *           Test expects hops to equal Dijkstra costs of unit moves
+ *
+ *   @param  none
+ *   @return none
+*/
+TEST(testWavefront, randomMaps) {
+    const char *mapFile = "wavefront_random.csv";
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> cellDist(0, 99);
+
+    for (int m = 0; m < 3; ++m) {
+        const int rows = 23;
+        const int cols = 300;
+        std::ofstream out(mapFile);
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                out << ((cellDist(rng) < 10 + 10 * m) ? "O" : "1");
+                if (j < cols - 1)
+                    out << ",";
+            }
+            out << "\n";
+        }
+        out.close();
+
+        Map map;
+        ASSERT_TRUE(map.createMap(mapFile));
+
+        compareWithDijkstra<4>(map, 1201);
+        compareWithDijkstra<8>(map, 1201);
+
+        // nearest of two starts
+        Wavefront wavefront;
+        std::vector<int> both;
+        std::vector<int> first;
+        std::vector<int> second;
+        int a = 0;
+        int b = 0;
+
+        ASSERT_TRUE(wavefront.build(map));
+        for (int s = 1; s <= rows * cols && b == 0; ++s) {
+            if (!wavefront.computeReachable({s}, 8))
+                continue;
+            if (a == 0)
+                a = s;
+            else if (s > a + 200)
+                b = s;
+        }
+
+        ASSERT_TRUE(wavefront.computeHops({a}, 8, first));
+        ASSERT_TRUE(wavefront.computeHops({b}, 8, second));
+        ASSERT_TRUE(wavefront.computeHops({a, b}, 8, both));
+
+        for (int i = 0; i < rows * cols; ++i) {
+            int expected = first[i];
+            if (expected < 0 || (second[i] >= 0 && second[i] < expected))
+                expected = second[i];
+            ASSERT_EQ(expected, both[i]);
+        }
+    }
+
+    remove(mapFile);
+}